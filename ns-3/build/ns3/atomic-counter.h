@@ -0,0 +1,71 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef ATOMIC_COUNTER_H
+#define ATOMIC_COUNTER_H
+
+#include <stdint.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup core
+ * \brief Increment a reference or use counter
+ *
+ * With --enable-multithreading (NS3_MULTITHREADED), the objects shared by the partitions
+ * of ns3::MultithreadedSimulatorImpl (events, packets and their buffers) are referenced
+ * from several threads, so the counter is updated atomically.  Otherwise it is a plain
+ * increment.
+ *
+ * \param counter the counter
+ * \returns the new value of the counter
+ */
+inline uint32_t
+AtomicIncrement (uint32_t &counter)
+{
+#ifdef NS3_MULTITHREADED
+  return __sync_add_and_fetch (&counter, 1);
+#else
+  return ++counter;
+#endif
+}
+
+/**
+ * \ingroup core
+ * \brief Decrement a reference or use counter
+ *
+ * \see AtomicIncrement
+ *
+ * \param counter the counter
+ * \returns the new value of the counter
+ */
+inline uint32_t
+AtomicDecrement (uint32_t &counter)
+{
+#ifdef NS3_MULTITHREADED
+  return __sync_sub_and_fetch (&counter, 1);
+#else
+  return --counter;
+#endif
+}
+
+} // namespace ns3
+
+#endif /* ATOMIC_COUNTER_H */
@@ -0,0 +1,29 @@
+
+#ifdef NS3_MODULE_COMPILATION
+# error "Do not include ns3 module aggregator headers from other modules; these are meant only for end user scripts."
+#endif
+
+#ifndef NS3_MODULE_ENERGY
+    
+
+// Module headers:
+#include "basic-energy-harvester-helper.h"
+#include "basic-energy-harvester.h"
+#include "basic-energy-source-helper.h"
+#include "basic-energy-source.h"
+#include "device-energy-model-container.h"
+#include "device-energy-model.h"
+#include "energy-harvester-container.h"
+#include "energy-harvester-helper.h"
+#include "energy-harvester.h"
+#include "energy-model-helper.h"
+#include "energy-source-container.h"
+#include "energy-source.h"
+#include "li-ion-energy-source.h"
+#include "rv-battery-model-helper.h"
+#include "rv-battery-model.h"
+#include "simple-device-energy-model.h"
+#include "wifi-radio-energy-model-helper.h"
+#include "wifi-radio-energy-model.h"
+#include "wifi-tx-current-model.h"
+#endif
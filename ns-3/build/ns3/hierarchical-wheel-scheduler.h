@@ -0,0 +1,101 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef HIERARCHICAL_WHEEL_SCHEDULER_H
+#define HIERARCHICAL_WHEEL_SCHEDULER_H
+
+#include "scheduler.h"
+#include <stdint.h>
+#include <vector>
+#include <map>
+
+namespace ns3 {
+
+class EventImpl;
+
+/**
+ * \ingroup scheduler
+ * \brief a hierarchical timing wheel event scheduler
+ *
+ * Event timestamps are split into 8-bit digits and every digit of the six lowest ones
+ * has its own wheel of 256 slots.  An event is stored in the wheel of the most significant
+ * digit in which its timestamp differs from the current wheel time, in the slot given by
+ * that digit.  When the current wheel time moves into a new slot, the events of this slot
+ * are redistributed into the lower wheels, so every event is moved at most six times
+ * before it becomes due.  Events whose timestamp differs from the current time in the
+ * two most significant digits (i.e., more than 2^48 time units ahead, or about 78 hours
+ * with the default nanosecond resolution) are kept in a std::map.
+ *
+ * Events which are due at the current wheel time are kept in a small binary heap, so the
+ * order of events with identical timestamps (as well as any other events) is exactly the
+ * same as with the other schedulers: by timestamp, and by uid for equal timestamps.
+ *
+ * Insert and RemoveNext have amortized O(1) cost (plus logarithm of the number of events
+ * with the same timestamp).  Remove is linear in the number of events in the same slot.
+ */
+class HierarchicalWheelScheduler : public Scheduler
+{
+public:
+  static TypeId GetTypeId (void);
+
+  HierarchicalWheelScheduler ();
+  virtual ~HierarchicalWheelScheduler ();
+
+  virtual void Insert (const Event &ev);
+  virtual bool IsEmpty (void) const;
+  virtual Event PeekNext (void) const;
+  virtual Event RemoveNext (void);
+  virtual void Remove (const Event &ev);
+
+private:
+  enum
+  {
+    BITS_PER_LEVEL = 8,
+    SLOTS_PER_LEVEL = 1 << BITS_PER_LEVEL,
+    SLOT_MASK = SLOTS_PER_LEVEL - 1,
+    N_LEVELS = 6,
+    WORDS_PER_LEVEL = SLOTS_PER_LEVEL / 64
+  };
+
+  typedef std::vector<Event> Bucket;
+  typedef std::map<EventKey, EventImpl*> Overflow;
+
+  /* Return wheel level for the timestamp, N_LEVELS if it belongs to the overflow map */
+  inline uint32_t GetLevel (uint64_t ts) const;
+  /* Return the first occupied slot of the level starting from the given one, or SLOTS_PER_LEVEL */
+  inline uint32_t FindSlot (uint32_t level, uint32_t from) const;
+
+  void Place (const Event &ev);
+  /* Move wheel time forward until there are due events */
+  void Advance (void);
+
+  uint64_t m_current;
+  uint32_t m_size;
+
+  Bucket m_due; // binary heap of events with ts <= m_current
+  Bucket m_slots[N_LEVELS][SLOTS_PER_LEVEL];
+  uint64_t m_occupied[N_LEVELS][WORDS_PER_LEVEL];
+  uint32_t m_levelSize[N_LEVELS];
+  Overflow m_overflow;
+};
+
+} // namespace ns3
+
+#endif /* HIERARCHICAL_WHEEL_SCHEDULER_H */
@@ -0,0 +1,225 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2011-2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author:  Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef NDN_COLUMNAR_TRACER_H
+#define NDN_COLUMNAR_TRACER_H
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/node-container.h"
+
+#include <vector>
+#include <list>
+#include <string>
+#include <iostream>
+
+namespace ns3 {
+
+class Node;
+
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Consolidated network-layer and content store tracer with compact binary output
+ *
+ * Unlike L3RateTracer/L3AggregateTracer/CsTracer, which install one object (and one
+ * periodic event) per node and format text rows, this tracer keeps all counters in flat
+ * per-face column arrays that are shared by all nodes.  A single global event samples
+ * all columns once per period and appends them, varint-encoded, to an in-memory block.
+ * Full blocks are handed over to a background thread that writes them to the file.
+ *
+ * The resulting file can be converted to the TSV layout of L3RateTracer and CsTracer
+ * using ColumnarTracer::ConvertToTsv (or the ndn-columnar-trace-to-tsv tool).
+ *
+ * File layout (all integers little-endian or LEB128 varints):
+ *
+ *   header:     "NDNCTRC1" uint32 version, int64 period (ns), varint #columns,
+ *               varint #byte columns, then column names (varint length + chars)
+ *   'D' record: varint slot, varint node id, node name, varint face id + 1, face description
+ *   'S' record: int64 time (ns), varint #slots, then for every packet column and then for
+ *               every byte column #slots varints with the per-period counter values
+ *
+ * Slot is a (node, face) pair; face id -1 (stored as 0) denotes node-wide counters
+ * (satisfied/timed out Interests and content store hits/misses).
+ */
+class ColumnarTracer : public SimpleRefCount<ColumnarTracer>
+{
+public:
+  /**
+   * @brief Counter columns, one flat array per column
+   *
+   * Byte counters are maintained only for the first N_BYTE_COLUMNS columns
+   */
+  enum Column
+    {
+      IN_INTERESTS = 0,
+      OUT_INTERESTS,
+      DROP_INTERESTS,
+      IN_NACKS,
+      OUT_NACKS,
+      DROP_NACKS,
+      IN_DATA,
+      OUT_DATA,
+      DROP_DATA,
+      IN_SATISFIED_INTERESTS,
+      IN_TIMED_OUT_INTERESTS,
+      OUT_SATISFIED_INTERESTS,
+      OUT_TIMED_OUT_INTERESTS,
+      CACHE_HITS,
+      CACHE_MISSES,
+
+      N_COLUMNS
+    };
+
+  static const uint32_t N_BYTE_COLUMNS = DROP_DATA + 1;
+
+  /**
+   * @brief Helper method to install tracer on all simulation nodes
+   *
+   * @param file File to which traces will be written (binary, cannot be -)
+   * @param averagingPeriod How often counters are sampled (default, every half second)
+   */
+  static void
+  InstallAll (const std::string &file, Time averagingPeriod = Seconds (0.5));
+
+  /**
+   * @brief Helper method to install tracer on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which traces will be written (binary, cannot be -)
+   * @param averagingPeriod How often counters are sampled (default, every half second)
+   */
+  static void
+  Install (const NodeContainer &nodes, const std::string &file, Time averagingPeriod = Seconds (0.5));
+
+  /**
+   * @brief Explicit request to flush and remove all statically created tracers
+   */
+  static void
+  Destroy ();
+
+  /**
+   * @brief Convert binary trace into the text formats of L3RateTracer and CsTracer
+   *
+   * Rows within one sampling period are ordered by node and face, which may differ
+   * from the (pointer-based) order produced by L3RateTracer itself
+   *
+   * @param is     binary trace produced by ColumnarTracer
+   * @param l3Os   stream for L3RateTracer-formatted output
+   * @param csOs   stream for CsTracer-formatted output
+   * @returns false if input is not a valid trace
+   */
+  static bool
+  ConvertToTsv (std::istream &is, std::ostream &l3Os, std::ostream &csOs);
+
+  /**
+   * @brief Create tracer writing into the file
+   * @param file     name of the output file
+   * @param period   sampling period
+   */
+  ColumnarTracer (const std::string &file, Time period);
+
+  /**
+   * @brief Destructor, flushes all pending data and stops the writer thread
+   */
+  ~ColumnarTracer ();
+
+  /**
+   * @brief Check if output file has been successfully opened
+   */
+  bool
+  IsOpen () const;
+
+  /**
+   * @brief Connect tracer to NDN stack (and content store, if present) of the node
+   */
+  void
+  AddNode (Ptr<Node> node);
+
+  /**
+   * @brief Write out data collected so far and wait until writer thread has stored it
+   */
+  void
+  Flush ();
+
+  /**
+   * @brief Get name of the column
+   */
+  static const char *
+  GetColumnName (uint32_t column);
+
+  /// @cond include_hidden
+  class NodeProbe;
+
+  inline void
+  Count (uint32_t slot, Column column)
+  {
+    m_packets[column][slot] ++;
+  }
+
+  inline void
+  Count (uint32_t slot, Column column, uint32_t bytes)
+  {
+    m_packets[column][slot] ++;
+    m_bytes[column][slot] += bytes;
+  }
+
+  uint32_t
+  AllocateSlot (uint32_t nodeId, const std::string &nodeName, int32_t faceId, const std::string &faceDescr);
+  /// @endcond
+
+private:
+  void
+  Sample ();
+
+  void
+  WriteHeader ();
+
+  void
+  Submit ();
+
+  void
+  WriteBlock (const std::vector<uint8_t> &block);
+
+  void
+  WriterLoop ();
+
+private:
+  Time m_period;
+  EventId m_sampleEvent;
+
+  std::vector<uint32_t> m_packets[N_COLUMNS];
+  std::vector<uint64_t> m_bytes[N_BYTE_COLUMNS];
+
+  std::list< Ptr<NodeProbe> > m_probes;
+
+  std::vector<uint8_t> m_block; ///< @brief block being filled by the simulation thread
+
+  class Writer;
+  Writer *m_writer;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_COLUMNAR_TRACER_H
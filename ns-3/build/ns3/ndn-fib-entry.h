@@ -0,0 +1,420 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2011 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef _NDN_FIB_ENTRY_H_
+#define	_NDN_FIB_ENTRY_H_
+
+#include "ns3/ptr.h"
+#include "ns3/nstime.h"
+#include "ns3/ndn-face.h"
+#include "ns3/ndn-name.h"
+#include "ns3/ndn-limits.h"
+#include "ns3/traced-value.h"
+
+#include <boost/ptr_container/ptr_vector.hpp>
+
+namespace ns3 {
+namespace ndn {
+
+class Name;
+typedef Name NameComponents;
+
+class Fib;
+
+/**
+ * @ingroup ndn-fib
+ * @brief Namespace for FIB operations
+ */
+namespace fib {
+
+/**
+ * @ingroup ndn-fib
+ * \brief Structure holding various parameters associated with a (FibEntry, Face) tuple
+ */
+class FaceMetric
+{
+public:
+  /**
+   * @brief Color codes for FIB face status
+   */
+  enum Status { NDN_FIB_GREEN = 1,
+                NDN_FIB_YELLOW = 2,
+                NDN_FIB_RED = 3 };
+public:
+  /**
+   * \brief Metric constructor
+   *
+   * \param face Face for which metric
+   * \param cost Initial value for routing cost
+   */
+  FaceMetric (Ptr<Face> face, int32_t cost)
+    : m_face (face)
+    , m_status (NDN_FIB_YELLOW)
+    , m_routingCost (cost)
+    , m_sRtt   (Seconds (0))
+    , m_rttVar (Seconds (0))
+    , m_realDelay (Seconds (0))
+  { }
+
+  /**
+   * \brief Comparison operator used by boost::multi_index::identity<>
+   */
+  bool
+  operator< (const FaceMetric &fm) const { return *m_face < *fm.m_face; } // return identity of the face
+
+  /**
+   * @brief Comparison between FaceMetric and Face
+   */
+  bool
+  operator< (const Ptr<Face> &face) const { return *m_face < *face; }
+
+  /**
+   * @brief Return Face associated with FaceMetric
+   */
+  Ptr<Face>
+  GetFace () const { return m_face; }
+
+  /**
+   * \brief Recalculate smoothed RTT and RTT variation
+   * \param rttSample RTT sample
+   */
+  void
+  UpdateRtt (const Time &rttSample);
+
+  /**
+   * @brief Get current status of FIB entry
+   */
+  Status
+  GetStatus () const
+  {
+    return m_status;
+  }
+
+  /**
+   * @brief Set current status of FIB entry
+   */
+  void
+  SetStatus (Status status)
+  {
+    m_status.Set (status);
+  }
+
+  /**
+   * @brief Get current routing cost
+   */
+  int32_t
+  GetRoutingCost () const
+  {
+    return m_routingCost;
+  }
+
+  /**
+   * @brief Set routing cost
+   */
+  void
+  SetRoutingCost (int32_t routingCost)
+  {
+    m_routingCost = routingCost;
+  }
+
+  /**
+   * @brief Get current estimate for smoothed RTT value
+   */
+  Time
+  GetSRtt () const
+  {
+    return m_sRtt;
+  }
+
+  /**
+   * @brief Get current estimate for the RTT variation
+   */
+  Time
+  GetRttVar () const
+  {
+    return m_rttVar;
+  }
+  
+  /**
+   * @brief Get real propagation delay to the producer, calculated based on NS-3 p2p link delays
+   */
+  Time
+  GetRealDelay () const
+  {
+    return m_realDelay;
+  }
+
+  /**
+   * @brief Set real propagation delay to the producer, calculated based on NS-3 p2p link delays
+   */
+  void
+  SetRealDelay (Time realDelay)
+  {
+    m_realDelay = realDelay;
+  }
+
+  /**
+   * @brief Get direct access to status trace
+   */
+  TracedValue<Status> &
+  GetStatusTrace ()
+  {
+    return m_status;
+  }
+
+private:
+  friend std::ostream& operator<< (std::ostream& os, const FaceMetric &metric);
+
+private:
+  Ptr<Face> m_face; ///< Face
+
+  TracedValue<Status> m_status; ///< \brief Status of the next hop:
+				///<		- NDN_FIB_GREEN
+				///<		- NDN_FIB_YELLOW
+				///<		- NDN_FIB_RED
+
+  int32_t m_routingCost; ///< \brief routing protocol cost (interpretation of the value depends on the underlying routing protocol)
+
+  Time m_sRtt;         ///< \brief smoothed round-trip time
+  Time m_rttVar;       ///< \brief round-trip time variation
+
+  Time m_realDelay;    ///< \brief real propagation delay to the producer, calculated based on NS-3 p2p link delays
+};
+
+/// @cond include_hidden
+class i_face {};
+class i_metric {};
+class i_nth {};
+/// @endcond
+
+/**
+ * @ingroup ndn-fib
+ * @brief Compact container of the next hops (FaceMetric records) of Entry
+ *
+ * FIB entries usually have only a few next hops, so they are kept in a small vector
+ * ordered by (status, routing cost), the order in which forwarding strategies try them.
+ * The same ordered vector serves all the views of the container:
+ * - get<i_metric> () (iteration by status and routing cost),
+ * - get<i_nth> () (nth best candidate),
+ * - get<i_face> () (lookup of the record for a face, by linear search).
+ *
+ * Records are updated only through modify (), which moves the updated record only if
+ * it is no longer in order.  A moved or added record is placed after all the records
+ * with the same status and routing cost.  The vector holds pointers to the records, so
+ * reordering does not copy them and sinks connected to the status trace stay with
+ * their records.
+ */
+class FaceMetricVector
+{
+public:
+  typedef boost::ptr_vector<FaceMetric> container;
+  typedef container::const_iterator iterator;
+  typedef container::const_iterator const_iterator;
+
+  /**
+   * @brief Type of the view by the specified tag (all views are the container itself)
+   */
+  template<class Tag>
+  struct index
+  {
+    typedef FaceMetricVector type;
+  };
+
+  /**
+   * @brief Get view by the specified tag (i_face, i_metric, or i_nth)
+   */
+  template<class Tag>
+  const FaceMetricVector &
+  get () const { return *this; }
+
+  const_iterator
+  begin () const { return m_faces.begin (); }
+
+  const_iterator
+  end () const { return m_faces.end (); }
+
+  size_t
+  size () const { return m_faces.size (); }
+
+  bool
+  empty () const { return m_faces.empty (); }
+
+  /**
+   * @brief Get nth record in the (status, routing cost) order
+   */
+  const FaceMetric &
+  operator [] (size_t n) const { return m_faces[n]; }
+
+  /**
+   * @brief Find record for the face
+   * @returns iterator to the record or end ()
+   */
+  const_iterator
+  find (const Ptr<Face> &face) const;
+
+  /**
+   * @brief Add record, if there is no record for the same face yet
+   */
+  std::pair<const_iterator, bool>
+  insert (const FaceMetric &metric);
+
+  /**
+   * @brief Update record using the functor and restore the order, if necessary
+   * @returns new position of the updated record
+   */
+  template<class Modifier>
+  const_iterator
+  modify (const_iterator position, Modifier modifier)
+  {
+    container::iterator record = m_faces.begin () + (position - m_faces.begin ());
+    modifier (*record);
+    return Reorder (record);
+  }
+
+  /**
+   * @brief Remove record for the face
+   * @returns number of removed records
+   */
+  size_t
+  erase (const Ptr<Face> &face);
+
+private:
+  const_iterator
+  Reorder (container::iterator record);
+
+private:
+  container m_faces;
+};
+
+/**
+ * @ingroup ndn-fib
+ * @brief Typedef for indexed face container of Entry
+ */
+struct FaceMetricContainer
+{
+  typedef FaceMetricVector type;
+};
+
+/**
+ * @ingroup ndn-fib
+ * \brief Structure for FIB table entry, holding indexed list of
+ *        available faces and their respective metrics
+ */
+class Entry : public Object
+{
+public:
+  typedef Entry base_type;
+
+public:
+  class NoFaces {}; ///< @brief Exception class for the case when FIB entry is not found
+
+  /**
+   * \brief Constructor
+   * \param prefix smart pointer to the prefix for the FIB entry
+   */
+  Entry (Ptr<Fib> fib, const Ptr<const Name> &prefix)
+  : m_fib (fib)
+  , m_prefix (prefix)
+  , m_needsProbing (false)
+  {
+  }
+
+  /**
+   * \brief Update status of FIB next hop
+   * \param status Status to set on the FIB entry
+   */
+  void UpdateStatus (Ptr<Face> face, FaceMetric::Status status);
+
+  /**
+   * \brief Add or update routing metric of FIB next hop
+   *
+   * Initial status of the next hop is set to YELLOW
+   */
+  void AddOrUpdateRoutingMetric (Ptr<Face> face, int32_t metric);
+
+  /**
+   * \brief Set real delay to the producer
+   */
+  void
+  SetRealDelayToProducer (Ptr<Face> face, Time delay);
+
+  /**
+   * @brief Invalidate face
+   *
+   * Set routing metric on all faces to max and status to RED
+   */
+  void
+  Invalidate ();
+
+  /**
+   * @brief Update RTT averages for the face
+   */
+  void
+  UpdateFaceRtt (Ptr<Face> face, const Time &sample);
+
+  /**
+   * \brief Get prefix for the FIB entry
+   */
+  const Name&
+  GetPrefix () const { return *m_prefix; }
+
+  /**
+   * \brief Find "best route" candidate, skipping `skip' first candidates (modulo # of faces)
+   *
+   * throws Entry::NoFaces if m_faces.size()==0
+   */
+  const FaceMetric &
+  FindBestCandidate (uint32_t skip = 0) const;
+
+  /**
+   * @brief Remove record associated with `face`
+   */
+  void
+  RemoveFace (const Ptr<Face> &face)
+  {
+    m_faces.erase (face);
+  }
+
+  /**
+   * @brief Get pointer to access FIB, to which this entry is added
+   */
+  Ptr<Fib>
+  GetFib ();
+  
+private:
+  friend std::ostream& operator<< (std::ostream& os, const Entry &entry);
+
+public:
+  Ptr<Fib> m_fib; ///< \brief FIB to which entry is added
+
+  Ptr<const Name> m_prefix; ///< \brief Prefix of the FIB entry
+  FaceMetricContainer::type m_faces; ///< \brief Indexed list of faces
+
+  bool m_needsProbing;      ///< \brief flag indicating that probing should be performed
+};
+
+std::ostream& operator<< (std::ostream& os, const Entry &entry);
+std::ostream& operator<< (std::ostream& os, const FaceMetric &metric);
+
+} // namespace fib
+} // namespace ndn
+} // namespace ns3
+
+#endif // _NDN_FIB_ENTRY_H_
@@ -0,0 +1,2 @@
+// backwards compatibility header
+#include "ns3/ndnSIM/ndn.cxx/name.h"
@@ -0,0 +1,188 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef GDSF_POLICY_H_
+#define GDSF_POLICY_H_
+
+#include <boost/intrusive/options.hpp>
+#include <boost/intrusive/set.hpp>
+#include <algorithm>
+
+#include <ns3/ndn-wire.h>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Traits for Greedy-Dual-Size-Frequency (GDSF) replacement policy
+ *
+ * Every item gets priority L + frequency / size, where size is the wire
+ * size of the Data packet and L is the priority of the last evicted
+ * item, and the item with the smallest priority is evicted.  Small and
+ * popular Data packets stay in the cache, while L ages out the items
+ * that are no longer looked up.
+ */
+struct gdsf_policy_traits
+{
+  /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
+  static std::string GetName () { return "Gdsf"; }
+
+  struct policy_hook_type : public boost::intrusive::set_member_hook<> { double priority; uint32_t frequency; uint32_t size; };
+
+  template<class Container>
+  struct container_hook
+  {
+    typedef boost::intrusive::member_hook< Container,
+                                           policy_hook_type,
+                                           &Container::policy_hook_ > type;
+  };
+
+  template<class Base,
+           class Container,
+           class Hook>
+  struct policy
+  {
+    static policy_hook_type& get_hook (typename Container::iterator item)
+    {
+      return *static_cast<policy_hook_type*>
+        (policy_container::value_traits::to_node_ptr(*item));
+    }
+
+    static const policy_hook_type& get_hook (typename Container::const_iterator item)
+    {
+      return *static_cast<const policy_hook_type*>
+        (policy_container::value_traits::to_node_ptr(*item));
+    }
+
+    static double get_order (typename Container::const_iterator item)
+    {
+      return get_hook (item).priority;
+    }
+
+    template<class Key>
+    struct MemberHookLess
+    {
+      bool operator () (const Key &a, const Key &b) const
+      {
+        return get_order (&a) < get_order (&b);
+      }
+    };
+
+    typedef boost::intrusive::multiset< Container,
+                                        boost::intrusive::compare< MemberHookLess< Container > >,
+                                        Hook > policy_container;
+
+    class type : public policy_container
+    {
+    public:
+      typedef policy policy_base; // to get access to get_order methods from outside
+      typedef Container parent_trie;
+
+      type (Base &base)
+        : base_ (base)
+        , max_size_ (100)
+        , inflation_ (0)
+      {
+      }
+
+      inline void
+      update (typename parent_trie::iterator item)
+      {
+        increment (item);
+      }
+
+      inline bool
+      insert (typename parent_trie::iterator item)
+      {
+        if (max_size_ != 0 && policy_container::size () >= max_size_)
+          {
+            base_.erase (&(*policy_container::begin ()));
+          }
+
+        get_hook (item).frequency = 1;
+        get_hook (item).size = std::max<uint32_t> (Wire::FromData (item->payload ()->GetData ())->GetSize (), 1);
+        get_hook (item).priority = inflation_ + 1.0 / get_hook (item).size;
+        policy_container::insert (*item);
+        return true;
+      }
+
+      inline void
+      lookup (typename parent_trie::iterator item)
+      {
+        increment (item);
+      }
+
+      inline void
+      erase (typename parent_trie::iterator item)
+      {
+        typename policy_container::iterator position = policy_container::s_iterator_to (*item);
+        if (position == policy_container::begin ())
+          {
+            // lowest priority item leaves the cache (most likely, it is evicted)
+            inflation_ = std::max (inflation_, get_hook (item).priority);
+          }
+        policy_container::erase (position);
+      }
+
+      inline void
+      clear ()
+      {
+        policy_container::clear ();
+        inflation_ = 0;
+      }
+
+      inline void
+      set_max_size (size_t max_size)
+      {
+        max_size_ = max_size;
+      }
+
+      inline size_t
+      get_max_size () const
+      {
+        return max_size_;
+      }
+
+    private:
+      type () : base_(*((Base*)0)) { };
+
+      inline void
+      increment (typename parent_trie::iterator item)
+      {
+        policy_container::erase (policy_container::s_iterator_to (*item));
+        get_hook (item).frequency ++;
+        get_hook (item).priority = inflation_ + 1.0 * get_hook (item).frequency / get_hook (item).size;
+        policy_container::insert (*item);
+      }
+
+    private:
+      Base &base_;
+      size_t max_size_;
+      double inflation_; ///< @brief L, priority of the last evicted item
+    };
+  };
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+#endif // GDSF_POLICY_H_
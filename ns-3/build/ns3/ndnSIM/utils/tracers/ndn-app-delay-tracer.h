@@ -0,0 +1,260 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef CCNX_APP_DELAY_TRACER_H
+#define CCNX_APP_DELAY_TRACER_H
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include <ns3/nstime.h>
+#include <ns3/event-id.h>
+#include <ns3/node-container.h>
+
+#include "ndn-delay-histogram.h"
+
+#include <boost/tuple/tuple.hpp>
+#include <boost/shared_ptr.hpp>
+#include <list>
+#include <map>
+
+namespace ns3 {
+
+class Node;
+class Packet;
+
+namespace ndn {
+
+class App;
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Tracer to obtain application-level delays
+ */
+class AppDelayTracer : public SimpleRefCount<AppDelayTracer>
+{
+public:
+  /**
+   * @brief Output mode of the tracer
+   *
+   * In aggregated modes, instead of a text row per satisfied Interest, the tracer keeps
+   * delay histograms (see DelayHistogram) together with retransmission and hop count
+   * counters, and writes their quantiles every dump period and at the end of simulation
+   */
+  enum Aggregation
+    {
+      RAW_ROWS = 0, ///< @brief one row per satisfied Interest (default)
+      PER_APP,      ///< @brief aggregate separately for each application
+      PER_NODE      ///< @brief aggregate all applications on a node together
+    };
+
+  /**
+   * @brief Helper method to install tracers on all simulation nodes
+   *
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param aggregation Output mode (by default, one row per satisfied Interest)
+   * @param dumpPeriod How often aggregated data will be written (by default, only at the end of simulation)
+   *
+   * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This tuple needs to be preserved
+   *          for the lifetime of simulation, otherwise SEGFAULTs are inevitable
+   * 
+   */
+  static void
+  InstallAll (const std::string &file, Aggregation aggregation = RAW_ROWS, Time dumpPeriod = Seconds (0));
+
+  /**
+   * @brief Helper method to install tracers on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param aggregation Output mode (by default, one row per satisfied Interest)
+   * @param dumpPeriod How often aggregated data will be written (by default, only at the end of simulation)
+   *
+   * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This tuple needs to be preserved
+   *          for the lifetime of simulation, otherwise SEGFAULTs are inevitable
+   *
+   */
+  static void
+  Install (const NodeContainer &nodes, const std::string &file,
+           Aggregation aggregation = RAW_ROWS, Time dumpPeriod = Seconds (0));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param aggregation Output mode (by default, one row per satisfied Interest)
+   * @param dumpPeriod How often aggregated data will be written (by default, only at the end of simulation)
+   *
+   * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This tuple needs to be preserved
+   *          for the lifetime of simulation, otherwise SEGFAULTs are inevitable
+   *
+   */
+  static void
+  Install (Ptr<Node> node, const std::string &file,
+           Aggregation aggregation = RAW_ROWS, Time dumpPeriod = Seconds (0));
+
+  /**
+   * @brief Helper method to install tracers on a specific simulation node
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param outputStream Smart pointer to a stream
+   * @param aggregation Output mode (by default, one row per satisfied Interest)
+   * @param dumpPeriod How often aggregated data will be written (by default, only at the end of simulation)
+   *
+   * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This tuple needs to be preserved
+   *          for the lifetime of simulation, otherwise SEGFAULTs are inevitable
+   */
+  static Ptr<AppDelayTracer>
+  Install (Ptr<Node> node, boost::shared_ptr<std::ostream> outputStream,
+           Aggregation aggregation = RAW_ROWS, Time dumpPeriod = Seconds (0));
+
+  /**
+   * @brief Explicit request to remove all statically created tracers
+   *
+   * This method can be helpful if simulation scenario contains several independent run,
+   * or if it is desired to do a postprocessing of the resulting data
+   */
+  static void
+  Destroy ();
+  
+  /**
+   * @brief Trace constructor that attaches to all applications on the node using node's pointer
+   * @param os    reference to the output stream
+   * @param node  pointer to the node
+   */
+  AppDelayTracer (boost::shared_ptr<std::ostream> os, Ptr<Node> node);
+
+  /**
+   * @brief Trace constructor that attaches to all applications on the node using node's name
+   * @param os        reference to the output stream
+   * @param nodeName  name of the node registered using Names::Add
+   */
+  AppDelayTracer (boost::shared_ptr<std::ostream> os, const std::string &node);
+
+  /**
+   * @brief Trace constructor with aggregated output
+   * @param os          reference to the output stream
+   * @param node        pointer to the node
+   * @param aggregation output mode
+   * @param dumpPeriod  how often aggregated data is written (zero, only at the end of simulation)
+   */
+  AppDelayTracer (boost::shared_ptr<std::ostream> os, Ptr<Node> node,
+                  Aggregation aggregation, Time dumpPeriod);
+
+  /**
+   * @brief Destructor
+   *
+   * In aggregated modes, data that has not yet been written is written out
+   */
+  ~AppDelayTracer ();
+
+  /**
+   * @brief Print head of the trace (e.g., for post-processing)
+   *
+   * @param os reference to output stream
+   */
+  void
+  PrintHeader (std::ostream &os) const;
+
+  /**
+   * @brief Print aggregated data collected since the last dump (no-op in RAW_ROWS mode)
+   *
+   * @param os reference to output stream
+   */
+  void
+  Print (std::ostream &os) const;
+  
+private:
+  void
+  Connect ();
+
+  void
+  PeriodicPrinter ();
+
+  void
+  FinalPrinter ();
+
+  void
+  Reset ();
+
+  void 
+  LastRetransmittedInterestDataDelay (Ptr<App> app, uint32_t seqno, Time delay, int32_t hopCount);
+  
+  void 
+  FirstInterestDataDelay (Ptr<App> app, uint32_t seqno, Time delay, uint32_t rextCount, int32_t hopCount);
+  
+private:
+  std::string m_node;
+  Ptr<Node> m_nodePtr;
+
+  boost::shared_ptr<std::ostream> m_os;
+
+  Aggregation m_aggregation;
+  Time m_period;
+  EventId m_printEvent;
+  EventId m_finalEvent;
+  bool m_finalPrinted;
+
+  /// @cond include_hidden
+  struct Stats
+  {
+    Stats ()
+    {
+      Reset ();
+    }
+
+    inline void Reset ()
+    {
+      m_delay.Reset ();
+      m_retxCount = 0;
+      m_hopCountSum = 0;
+      m_hopCountSamples = 0;
+      m_maxHopCount = -1;
+    }
+
+    inline void Add (Time delay, uint32_t retxCount, int32_t hopCount)
+    {
+      m_delay.Add (delay);
+      m_retxCount += retxCount;
+      if (hopCount >= 0)
+        {
+          m_hopCountSum += hopCount;
+          m_hopCountSamples ++;
+          if (hopCount > m_maxHopCount)
+            m_maxHopCount = hopCount;
+        }
+    }
+
+    DelayHistogram m_delay;
+    uint64_t m_retxCount;
+    uint64_t m_hopCountSum;
+    uint64_t m_hopCountSamples;
+    int32_t m_maxHopCount;
+  };
+  /// @endcond
+
+  // app id (or 0 for PER_NODE) -> (LastDelay, FullDelay)
+  std::map<uint32_t, boost::tuple<Stats, Stats> > m_stats;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // CCNX_CS_TRACER_H
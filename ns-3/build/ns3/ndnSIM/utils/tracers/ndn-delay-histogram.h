@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2011-2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author:  Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef NDN_DELAY_HISTOGRAM_H
+#define NDN_DELAY_HISTOGRAM_H
+
+#include "ns3/nstime.h"
+
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Log-linear (HDR-style) histogram of delays
+ *
+ * Values (in nanoseconds) below 2^s are counted exactly.  Every larger power-of-two
+ * range [2^k, 2^(k+1)) is split into 2^s equal sub-buckets, so any quantile is reported
+ * with relative error of at most 2^-(s+1) (see GetRelativeError).
+ *
+ * The counter array only grows up to the largest recorded value and never exceeds
+ * (65 - s) * 2^s entries, independent of the number of recorded values.
+ */
+class DelayHistogram
+{
+public:
+  /**
+   * @brief Create histogram
+   * @param subBucketBits number of bits of precision (s), 6 gives <0.8% error
+   */
+  DelayHistogram (uint32_t subBucketBits = 6);
+
+  /**
+   * @brief Record value
+   */
+  void
+  Add (const Time &delay);
+
+  /**
+   * @brief Record value in nanoseconds
+   */
+  void
+  Add (uint64_t value);
+
+  /**
+   * @brief Add all values recorded in other histogram (must have the same precision)
+   */
+  void
+  Merge (const DelayHistogram &other);
+
+  /**
+   * @brief Remove all recorded values
+   */
+  void
+  Reset ();
+
+  /**
+   * @brief Get number of recorded values
+   */
+  inline uint64_t
+  GetCount () const;
+
+  /**
+   * @brief Get exact minimum of recorded values
+   */
+  Time
+  GetMin () const;
+
+  /**
+   * @brief Get exact maximum of recorded values
+   */
+  Time
+  GetMax () const;
+
+  /**
+   * @brief Get exact mean of recorded values
+   */
+  Time
+  GetMean () const;
+
+  /**
+   * @brief Get value at the quantile q (0 <= q <= 1)
+   *
+   * Returned value v' differs from the exact value v (the one at rank ceil (q * count)
+   * of the sorted recorded values) by at most v * GetRelativeError ()
+   */
+  Time
+  GetQuantile (double q) const;
+
+  /**
+   * @brief Get upper bound for the relative error of quantiles
+   */
+  double
+  GetRelativeError () const;
+
+private:
+  inline uint32_t
+  GetIndex (uint64_t value) const;
+
+  inline uint64_t
+  GetLowerBound (uint32_t index) const;
+
+  inline uint64_t
+  GetWidth (uint32_t index) const;
+
+private:
+  uint32_t m_subBucketBits;
+  uint64_t m_subBucketCount;
+
+  uint64_t m_count;
+  uint64_t m_min;
+  uint64_t m_max;
+  double m_sum;
+
+  std::vector<uint64_t> m_counts;
+};
+
+inline uint64_t
+DelayHistogram::GetCount () const
+{
+  return m_count;
+}
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_DELAY_HISTOGRAM_H
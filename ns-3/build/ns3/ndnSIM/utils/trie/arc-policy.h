@@ -0,0 +1,278 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef ARC_POLICY_H_
+#define ARC_POLICY_H_
+
+#include <boost/intrusive/options.hpp>
+#include <boost/intrusive/list.hpp>
+#include <algorithm>
+
+#include "detail/ghost-list.h"
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Traits for Adaptive Replacement Cache (ARC) policy
+ *
+ * Items requested once (T1) and more than once (T2) are kept in LRU order in a
+ * single list, T1 items before T2 items.  The hashes of the items recently
+ * evicted from T1 and T2 are remembered in the ghost lists B1 and B2, and a
+ * miss on B1 (resp. B2) increases (resp. decreases) the target size of T1.
+ */
+struct arc_policy_traits
+{
+  /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
+  static std::string GetName () { return "Arc"; }
+
+  struct policy_hook_type : public boost::intrusive::list_member_hook<> { bool frequent; };
+
+  template<class Container>
+  struct container_hook
+  {
+    typedef boost::intrusive::member_hook< Container,
+                                           policy_hook_type,
+                                           &Container::policy_hook_ > type;
+  };
+
+  template<class Base,
+           class Container,
+           class Hook>
+  struct policy
+  {
+    typedef typename boost::intrusive::list< Container, Hook > policy_container;
+
+    static bool& is_frequent (typename Container::iterator item)
+    {
+      return static_cast<policy_hook_type*>
+        (policy_container::value_traits::to_node_ptr(*item))->frequent;
+    }
+
+    class type : public policy_container
+    {
+    public:
+      typedef policy policy_base; // to get access to is_frequent methods from outside
+      typedef Container parent_trie;
+
+      type (Base &base)
+        : base_ (base)
+        , max_size_ (100)
+        , recent_size_ (0)
+        , target_ (0)
+        , frequent_ (policy_container::end ())
+      {
+        recent_ghosts_.set_max_size (max_size_);
+        frequent_ghosts_.set_max_size (max_size_);
+      }
+
+      inline void
+      update (typename parent_trie::iterator item)
+      {
+        unlink (item);
+        push_frequent (item);
+      }
+
+      inline bool
+      insert (typename parent_trie::iterator item)
+      {
+        if (max_size_ == 0)
+          {
+            push_recent (item);
+            return true;
+          }
+
+        size_t key = full_key_hash (*item);
+        if (recent_ghosts_.contains (key))
+          {
+            size_t delta = std::max<size_t> (frequent_ghosts_.size () / recent_ghosts_.size (), 1);
+            target_ = std::min (target_ + delta, max_size_);
+            recent_ghosts_.erase (key);
+
+            replace (false);
+            push_frequent (item);
+          }
+        else if (frequent_ghosts_.contains (key))
+          {
+            size_t delta = std::max<size_t> (recent_ghosts_.size () / frequent_ghosts_.size (), 1);
+            target_ = target_ > delta ? target_ - delta : 0;
+            frequent_ghosts_.erase (key);
+
+            replace (true);
+            push_frequent (item);
+          }
+        else
+          {
+            if (recent_size_ + recent_ghosts_.size () >= max_size_)
+              {
+                if (recent_size_ < max_size_)
+                  {
+                    recent_ghosts_.pop_front ();
+                    replace (false);
+                  }
+                else
+                  {
+                    // T1 is the whole cache: evict its LRU item without remembering it
+                    base_.erase (&(*policy_container::begin ()));
+                  }
+              }
+            else if (policy_container::size () + recent_ghosts_.size () + frequent_ghosts_.size () >= max_size_)
+              {
+                if (policy_container::size () + recent_ghosts_.size () + frequent_ghosts_.size () >= 2 * max_size_)
+                  {
+                    frequent_ghosts_.pop_front ();
+                  }
+                replace (false);
+              }
+            push_recent (item);
+          }
+        return true;
+      }
+
+      inline void
+      lookup (typename parent_trie::iterator item)
+      {
+        unlink (item);
+        push_frequent (item);
+      }
+
+      inline void
+      erase (typename parent_trie::iterator item)
+      {
+        unlink (item);
+      }
+
+      inline void
+      clear ()
+      {
+        policy_container::clear ();
+        frequent_ = policy_container::end ();
+        recent_size_ = 0;
+        target_ = 0;
+        recent_ghosts_.clear ();
+        frequent_ghosts_.clear ();
+      }
+
+      inline void
+      set_max_size (size_t max_size)
+      {
+        max_size_ = max_size;
+        recent_ghosts_.set_max_size (max_size_);
+        frequent_ghosts_.set_max_size (max_size_);
+        target_ = std::min (target_, max_size_);
+      }
+
+      inline size_t
+      get_max_size () const
+      {
+        return max_size_;
+      }
+
+    private:
+      type () : base_(*((Base*)0)) { };
+
+      /**
+       * @brief Add item to the MRU end of T1
+       */
+      inline void
+      push_recent (typename parent_trie::iterator item)
+      {
+        is_frequent (item) = false;
+        policy_container::insert (frequent_, *item);
+        recent_size_ ++;
+      }
+
+      /**
+       * @brief Add item to the MRU end of T2
+       */
+      inline void
+      push_frequent (typename parent_trie::iterator item)
+      {
+        is_frequent (item) = true;
+        policy_container::push_back (*item);
+        if (frequent_ == policy_container::end ())
+          {
+            frequent_ = policy_container::s_iterator_to (*item);
+          }
+      }
+
+      inline void
+      unlink (typename parent_trie::iterator item)
+      {
+        typename policy_container::iterator position = policy_container::s_iterator_to (*item);
+        if (is_frequent (item))
+          {
+            if (position == frequent_)
+              {
+                frequent_ ++;
+              }
+          }
+        else
+          {
+            recent_size_ --;
+          }
+        policy_container::erase (position);
+      }
+
+      /**
+       * @brief Evict the LRU item of T1 or T2 (if the container is full), remembering it in B1 or B2
+       */
+      inline void
+      replace (bool inFrequentGhosts)
+      {
+        if (policy_container::size () < max_size_)
+          return;
+
+        if (recent_size_ > 0 &&
+            (recent_size_ > target_ || (inFrequentGhosts && recent_size_ == target_) ||
+             frequent_ == policy_container::end ()))
+          {
+            typename parent_trie::iterator victim = &(*policy_container::begin ());
+            recent_ghosts_.push_back (full_key_hash (*victim));
+            base_.erase (victim);
+          }
+        else
+          {
+            typename parent_trie::iterator victim = &(*frequent_);
+            frequent_ghosts_.push_back (full_key_hash (*victim));
+            base_.erase (victim);
+          }
+      }
+
+    private:
+      Base &base_;
+      size_t max_size_;
+
+      size_t recent_size_;                          ///< @brief number of items in T1
+      size_t target_;                               ///< @brief target number of items in T1
+      typename policy_container::iterator frequent_; ///< @brief first (LRU) item of T2, T1 items are before it
+
+      detail::ghost_list recent_ghosts_;   ///< @brief B1
+      detail::ghost_list frequent_ghosts_; ///< @brief B2
+    };
+  };
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+#endif // ARC_POLICY_H_
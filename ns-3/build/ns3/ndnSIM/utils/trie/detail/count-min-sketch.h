@@ -0,0 +1,141 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef COUNT_MIN_SKETCH_H_
+#define COUNT_MIN_SKETCH_H_
+
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+namespace detail {
+
+/**
+ * @brief Approximate access counts of the keys, with aging (TinyLFU frequency sketch)
+ *
+ * Count-min sketch of 4 rows of 4-bit counters (saturating at 15).  After a
+ * sample of 10 times the width of additions, all counters are halved, so the
+ * estimates reflect the recent popularity of the keys.
+ */
+class count_min_sketch
+{
+public:
+  count_min_sketch ()
+    : mask_ (0)
+    , additions_ (0)
+    , sample_size_ (0)
+  {
+    resize (0);
+  }
+
+  /**
+   * @brief Size the sketch for the number of items that the cache can hold (clears all counts)
+   */
+  inline void
+  resize (size_t capacity)
+  {
+    size_t width = 16;
+    while (width < capacity)
+      {
+        width <<= 1;
+      }
+    mask_ = width - 1;
+    sample_size_ = 10 * width;
+    table_.assign (depth * width, 0);
+    additions_ = 0;
+  }
+
+  inline void
+  increment (size_t key)
+  {
+    bool added = false;
+    for (uint32_t row = 0; row < depth; row++)
+      {
+        uint8_t &counter = table_[index (key, row)];
+        if (counter < max_count)
+          {
+            counter++;
+            added = true;
+          }
+      }
+
+    if (added && ++additions_ >= sample_size_)
+      {
+        age ();
+      }
+  }
+
+  inline uint32_t
+  estimate (size_t key) const
+  {
+    uint32_t count = max_count;
+    for (uint32_t row = 0; row < depth; row++)
+      {
+        count = std::min<uint32_t> (count, table_[index (key, row)]);
+      }
+    return count;
+  }
+
+  inline void
+  clear ()
+  {
+    std::fill (table_.begin (), table_.end (), 0);
+    additions_ = 0;
+  }
+
+private:
+  static const uint32_t depth = 4;
+  static const uint8_t max_count = 15;
+
+  inline size_t
+  index (size_t key, uint32_t row) const
+  {
+    // double hashing over a 64-bit mix of the key
+    uint64_t hash = static_cast<uint64_t> (key) * 0x9E3779B97F4A7C15ULL;
+    uint64_t step = (hash >> 32) | 1;
+    return row * (mask_ + 1) + (((hash + row * step) >> 7) & mask_);
+  }
+
+  inline void
+  age ()
+  {
+    for (std::vector<uint8_t>::iterator counter = table_.begin (); counter != table_.end (); counter++)
+      {
+        *counter >>= 1;
+      }
+    additions_ /= 2;
+  }
+
+private:
+  std::vector<uint8_t> table_;
+  size_t mask_;
+  size_t additions_;
+  size_t sample_size_;
+};
+
+} // detail
+} // ndnSIM
+} // ndn
+} // ns3
+
+#endif // COUNT_MIN_SKETCH_H_
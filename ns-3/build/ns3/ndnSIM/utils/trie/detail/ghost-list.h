@@ -0,0 +1,135 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef GHOST_LIST_H_
+#define GHOST_LIST_H_
+
+#include <list>
+#include <boost/unordered_map.hpp>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+namespace detail {
+
+/**
+ * @brief Bounded FIFO of the hashes of recently evicted items (see full_key_hash)
+ *
+ * When more than max_size hashes are in the list, the oldest ones are forgotten
+ */
+class ghost_list
+{
+public:
+  ghost_list ()
+    : max_size_ (0)
+  {
+  }
+
+  inline size_t
+  size () const
+  {
+    return keys_.size ();
+  }
+
+  inline bool
+  contains (size_t key) const
+  {
+    return index_.find (key) != index_.end ();
+  }
+
+  /**
+   * @brief Remove the key from the list
+   * @returns true if the key was in the list
+   */
+  inline bool
+  erase (size_t key)
+  {
+    index_type::iterator item = index_.find (key);
+    if (item == index_.end ())
+      return false;
+
+    keys_.erase (item->second);
+    index_.erase (item);
+    return true;
+  }
+
+  inline void
+  push_back (size_t key)
+  {
+    erase (key);
+    index_[key] = keys_.insert (keys_.end (), key);
+    trim ();
+  }
+
+  inline void
+  pop_front ()
+  {
+    if (keys_.empty ())
+      return;
+
+    index_.erase (keys_.front ());
+    keys_.pop_front ();
+  }
+
+  inline void
+  clear ()
+  {
+    index_.clear ();
+    keys_.clear ();
+  }
+
+  inline void
+  set_max_size (size_t max_size)
+  {
+    max_size_ = max_size;
+    trim ();
+  }
+
+  inline size_t
+  get_max_size () const
+  {
+    return max_size_;
+  }
+
+private:
+  inline void
+  trim ()
+  {
+    while (keys_.size () > max_size_)
+      {
+        pop_front ();
+      }
+  }
+
+private:
+  typedef std::list<size_t> key_list;
+  typedef boost::unordered_map<size_t, key_list::iterator> index_type;
+
+  key_list keys_;
+  index_type index_;
+  size_t max_size_;
+};
+
+} // detail
+} // ndnSIM
+} // ndn
+} // ns3
+
+#endif // GHOST_LIST_H_
@@ -0,0 +1,261 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef LFU_POLICY_H_
+#define LFU_POLICY_H_
+
+#include <boost/intrusive/options.hpp>
+#include <boost/intrusive/list.hpp>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Traits for LFU replacement policy
+ *
+ * Items are kept in a list sorted by frequency, grouped in buckets of the same
+ * frequency (in the order in which they reached it), so that lookups and
+ * evictions take constant time: a looked up item is moved to the end of the
+ * next bucket, and the evicted item is the first of the list.
+ */
+struct lfu_policy_traits
+{
+  /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
+  static std::string GetName () { return "Lfu"; }
+
+  struct frequency_bucket { size_t frequency; };
+
+  struct policy_hook_type : public boost::intrusive::list_member_hook<> { frequency_bucket *bucket; };
+
+  template<class Container>
+  struct container_hook
+  {
+    typedef boost::intrusive::member_hook< Container,
+                                           policy_hook_type,
+                                           &Container::policy_hook_ > type;
+  };
+
+  template<class Base,
+           class Container,
+           class Hook>
+  struct policy
+  {
+    typedef boost::intrusive::list< Container, Hook > policy_container;
+
+    struct bucket : public frequency_bucket, public boost::intrusive::list_base_hook<>
+    {
+      size_t count;    ///< @brief number of items in the bucket
+      Container *last; ///< @brief last item of the bucket in policy_container
+    };
+
+    typedef boost::intrusive::list< bucket > bucket_container;
+
+    struct bucket_disposer
+    {
+      void operator() (bucket *item)
+      {
+        delete item;
+      }
+    };
+
+    static frequency_bucket*& get_bucket (typename Container::iterator item)
+    {
+      return static_cast<policy_hook_type*>
+        (policy_container::value_traits::to_node_ptr(*item))->bucket;
+    }
+
+    static size_t get_order (typename Container::const_iterator item)
+    {
+      return static_cast<const policy_hook_type*>
+        (policy_container::value_traits::to_node_ptr(*item))->bucket->frequency;
+    }
+
+    class type : public policy_container
+    {
+    public:
+      typedef policy policy_base; // to get access to get_order methods from outside
+      typedef Container parent_trie;
+
+      type (Base &base)
+        : base_ (base)
+        , max_size_ (100)
+      {
+      }
+
+      ~type ()
+      {
+        buckets_.clear_and_dispose (bucket_disposer ());
+      }
+
+      inline void
+      update (typename parent_trie::iterator item)
+      {
+        increment (item);
+      }
+
+      inline bool
+      insert (typename parent_trie::iterator item)
+      {
+        if (max_size_ != 0 && policy_container::size () >= max_size_)
+          {
+            // this erases the "least frequently used item" from cache
+            base_.erase (&(*policy_container::begin ()));
+          }
+
+        if (buckets_.empty () || buckets_.front ().frequency != 0)
+          {
+            buckets_.push_front (*create_bucket (0));
+            link (item, buckets_.front (), policy_container::begin ());
+          }
+        else
+          {
+            link (item, buckets_.front (), next (buckets_.front ()));
+          }
+        return true;
+      }
+
+      inline void
+      lookup (typename parent_trie::iterator item)
+      {
+        increment (item);
+      }
+
+      inline void
+      erase (typename parent_trie::iterator item)
+      {
+        unlink (item);
+      }
+
+      inline void
+      clear ()
+      {
+        policy_container::clear ();
+        buckets_.clear_and_dispose (bucket_disposer ());
+      }
+
+      inline void
+      set_max_size (size_t max_size)
+      {
+        max_size_ = max_size;
+      }
+
+      inline size_t
+      get_max_size () const
+      {
+        return max_size_;
+      }
+
+    private:
+      type () : base_(*((Base*)0)) { };
+
+      static bucket *
+      create_bucket (size_t frequency)
+      {
+        bucket *item = new bucket;
+        item->frequency = frequency;
+        item->count = 0;
+        item->last = 0;
+        return item;
+      }
+
+      /**
+       * @brief Position in policy_container just after the last item of the bucket
+       */
+      static typename policy_container::iterator
+      next (bucket &b)
+      {
+        typename policy_container::iterator position = policy_container::s_iterator_to (*b.last);
+        return ++position;
+      }
+
+      /**
+       * @brief Move item to the end of the bucket of the next frequency
+       */
+      inline void
+      increment (typename parent_trie::iterator item)
+      {
+        bucket &current = static_cast<bucket&> (*get_bucket (item));
+        typename bucket_container::iterator following = buckets_.iterator_to (current);
+        following ++;
+
+        bucket *target;
+        typename policy_container::iterator position;
+        if (following != buckets_.end () && following->frequency == current.frequency + 1)
+          {
+            target = &(*following);
+            position = next (*target);
+          }
+        else
+          {
+            target = create_bucket (current.frequency + 1);
+            buckets_.insert (following, *target);
+            position = next (current);
+          }
+
+        // position is not item: it is after the last item of current or target
+        unlink (item);
+        link (item, *target, position);
+      }
+
+      inline void
+      link (typename parent_trie::iterator item, bucket &b, typename policy_container::iterator position)
+      {
+        policy_container::insert (position, *item);
+        get_bucket (item) = &b;
+        b.count ++;
+        b.last = &(*item);
+      }
+
+      inline void
+      unlink (typename parent_trie::iterator item)
+      {
+        bucket &b = static_cast<bucket&> (*get_bucket (item));
+        typename policy_container::iterator position = policy_container::s_iterator_to (*item);
+        if (b.count == 1)
+          {
+            buckets_.erase_and_dispose (buckets_.iterator_to (b), bucket_disposer ());
+          }
+        else
+          {
+            if (b.last == &(*item))
+              {
+                typename policy_container::iterator previous = position;
+                previous --;
+                b.last = &(*previous);
+              }
+            b.count --;
+          }
+        policy_container::erase (position);
+      }
+
+    private:
+      Base &base_;
+      size_t max_size_;
+      bucket_container buckets_; ///< @brief buckets of the items, by increasing frequency
+    };
+  };
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+#endif // LFU_POLICY_H
@@ -0,0 +1,284 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef S3FIFO_POLICY_H_
+#define S3FIFO_POLICY_H_
+
+#include <boost/intrusive/options.hpp>
+#include <boost/intrusive/list.hpp>
+#include <stdint.h>
+#include <algorithm>
+
+#include "detail/ghost-list.h"
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Traits for S3-FIFO replacement policy
+ *
+ * New items enter a small FIFO queue (10% of the container), the items of the
+ * small queue which were looked up before reaching its head are moved to the
+ * main FIFO queue, and the others are evicted and remembered in a ghost queue.
+ * New items found in the ghost queue go directly to the main queue, which
+ * evicts its head items unless they were looked up since their last pass
+ * (up to 3 times), in which case they are reinserted.  Lookups only update a
+ * counter of the item.
+ */
+struct s3fifo_policy_traits
+{
+  /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
+  static std::string GetName () { return "S3Fifo"; }
+
+  struct policy_hook_type : public boost::intrusive::list_member_hook<> { uint8_t frequency; bool main; };
+
+  template<class Container>
+  struct container_hook
+  {
+    typedef boost::intrusive::member_hook< Container,
+                                           policy_hook_type,
+                                           &Container::policy_hook_ > type;
+  };
+
+  template<class Base,
+           class Container,
+           class Hook>
+  struct policy
+  {
+    typedef typename boost::intrusive::list< Container, Hook > policy_container;
+
+    static policy_hook_type& get_hook (typename Container::iterator item)
+    {
+      return *static_cast<policy_hook_type*>
+        (policy_container::value_traits::to_node_ptr(*item));
+    }
+
+    class type : public policy_container
+    {
+    public:
+      typedef policy policy_base; // to get access to get_hook methods from outside
+      typedef Container parent_trie;
+
+      type (Base &base)
+        : base_ (base)
+        , max_size_ (100)
+        , small_size_ (0)
+        , main_ (policy_container::end ())
+      {
+        ghosts_.set_max_size (get_main_max_size ());
+      }
+
+      inline void
+      update (typename parent_trie::iterator item)
+      {
+        touch (item);
+      }
+
+      inline bool
+      insert (typename parent_trie::iterator item)
+      {
+        if (max_size_ == 0)
+          {
+            push_small (item);
+            return true;
+          }
+
+        while (policy_container::size () >= max_size_)
+          {
+            if (small_size_ >= get_small_max_size () || main_ == policy_container::end ())
+              {
+                evict_small ();
+              }
+            else
+              {
+                evict_main ();
+              }
+          }
+
+        if (ghosts_.erase (full_key_hash (*item)))
+          {
+            push_main (item);
+          }
+        else
+          {
+            push_small (item);
+          }
+        return true;
+      }
+
+      inline void
+      lookup (typename parent_trie::iterator item)
+      {
+        touch (item);
+      }
+
+      inline void
+      erase (typename parent_trie::iterator item)
+      {
+        typename policy_container::iterator position = policy_container::s_iterator_to (*item);
+        if (get_hook (item).main)
+          {
+            if (position == main_)
+              {
+                main_ ++;
+              }
+          }
+        else
+          {
+            small_size_ --;
+          }
+        policy_container::erase (position);
+      }
+
+      inline void
+      clear ()
+      {
+        policy_container::clear ();
+        main_ = policy_container::end ();
+        small_size_ = 0;
+        ghosts_.clear ();
+      }
+
+      inline void
+      set_max_size (size_t max_size)
+      {
+        max_size_ = max_size;
+        ghosts_.set_max_size (get_main_max_size ());
+      }
+
+      inline size_t
+      get_max_size () const
+      {
+        return max_size_;
+      }
+
+    private:
+      type () : base_(*((Base*)0)) { };
+
+      inline size_t
+      get_small_max_size () const
+      {
+        return std::max<size_t> (max_size_ / 10, 1);
+      }
+
+      inline size_t
+      get_main_max_size () const
+      {
+        return max_size_ - std::min (max_size_, get_small_max_size ());
+      }
+
+      inline void
+      touch (typename parent_trie::iterator item)
+      {
+        if (get_hook (item).frequency < 3)
+          {
+            get_hook (item).frequency ++;
+          }
+      }
+
+      /**
+       * @brief Add item to the tail of the small queue (small queue items are before the main queue items)
+       */
+      inline void
+      push_small (typename parent_trie::iterator item)
+      {
+        get_hook (item).frequency = 0;
+        get_hook (item).main = false;
+        policy_container::insert (main_, *item);
+        small_size_ ++;
+      }
+
+      /**
+       * @brief Add item to the tail of the main queue
+       */
+      inline void
+      push_main (typename parent_trie::iterator item)
+      {
+        get_hook (item).frequency = 0;
+        get_hook (item).main = true;
+        policy_container::push_back (*item);
+        if (main_ == policy_container::end ())
+          {
+            main_ = policy_container::s_iterator_to (*item);
+          }
+      }
+
+      /**
+       * @brief Move the head of the small queue to the main queue, or evict it if it was not looked up
+       */
+      inline void
+      evict_small ()
+      {
+        typename parent_trie::iterator head = &(*policy_container::begin ());
+        if (get_hook (head).frequency > 0)
+          {
+            erase (head);
+            push_main (head);
+            if (policy_container::size () - small_size_ > get_main_max_size ())
+              {
+                evict_main ();
+              }
+          }
+        else
+          {
+            ghosts_.push_back (full_key_hash (*head));
+            base_.erase (head);
+          }
+      }
+
+      /**
+       * @brief Evict the first item of the main queue which was not looked up since its last reinsertion
+       */
+      inline void
+      evict_main ()
+      {
+        while (true)
+          {
+            typename parent_trie::iterator head = &(*main_);
+            if (get_hook (head).frequency == 0)
+              {
+                base_.erase (head);
+                return;
+              }
+
+            uint8_t frequency = get_hook (head).frequency - 1;
+            erase (head);
+            push_main (head);
+            get_hook (head).frequency = frequency;
+          }
+      }
+
+    private:
+      Base &base_;
+      size_t max_size_;
+
+      size_t small_size_;                        ///< @brief number of items in the small queue
+      typename policy_container::iterator main_; ///< @brief head of the main queue, small queue items are before it
+      detail::ghost_list ghosts_;                ///< @brief items evicted from the small queue
+    };
+  };
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+#endif // S3FIFO_POLICY_H_
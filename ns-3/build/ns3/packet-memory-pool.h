@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef PACKET_MEMORY_POOL_H
+#define PACKET_MEMORY_POOL_H
+
+#include <stdint.h>
+#include <cstddef>
+#include <ostream>
+
+// Packet, Buffer::Data, PacketMetadata::Data, ByteTagListData, PacketTagList::TagData
+// and TypedPacketTagList::Data are taken from PacketMemoryPool, unless ns-3 is built with
+// CXXFLAGS=-DNS3_NO_PACKET_MEMORY_POOL (the old free lists are then used instead)
+#ifndef NS3_NO_PACKET_MEMORY_POOL
+#define PACKET_MEMORY_POOL 1
+#endif
+
+namespace ns3 {
+
+/**
+ * \ingroup packet
+ *
+ * \brief Size-classed memory pool for the packet data structures
+ *
+ * Every packet hop creates several small objects (the Packet itself, copy-on-write
+ * buffer, metadata and tag storage).  The pool rounds the requested sizes up to a
+ * small number of size classes (multiples of 16 bytes up to 256 bytes, then powers of
+ * two up to 16 KB) and keeps the released blocks of each class in a free list, so that
+ * these objects are recycled instead of going through the general heap.  Larger blocks
+ * are always allocated from the heap.
+ *
+ * The free lists are per thread when ns-3 is built with --enable-multithreading: a
+ * block released by another thread than the one which allocated it simply moves to the
+ * cache of the releasing thread.  The caches of the threads which have terminated are
+ * reused by the next threads.
+ *
+ * The pool can be disabled at run time (PacketMemoryPool::Disable, or the
+ * "PacketMemoryPool" global value, read at the first allocation), all blocks then
+ * going to and from the heap.  The counters are maintained in both cases.
+ */
+class PacketMemoryPool
+{
+public:
+  /**
+   * \brief Kinds of objects allocated from the pool, counted separately
+   */
+  enum Kind
+  {
+    PACKET = 0,
+    BUFFER_DATA,
+    PACKET_METADATA,
+    BYTE_TAG_LIST,
+    PACKET_TAG_LIST,
+    TYPED_PACKET_TAG_LIST,
+    N_KINDS
+  };
+
+  /**
+   * \brief Usage counters of a kind of object
+   */
+  struct Stats
+  {
+    uint64_t allocations;   //!< number of blocks allocated
+    uint64_t deallocations; //!< number of blocks released
+    uint64_t reused;        //!< number of allocations served from a free list
+  };
+
+  /**
+   * \brief Allocate a block
+   * \param kind kind of object, for the counters
+   * \param size requested size
+   * \returns a block of at least GetBlockSize (size) bytes
+   */
+  static void *Allocate (enum Kind kind, std::size_t size);
+  /**
+   * \brief Release a block obtained from Allocate
+   * \param kind kind of object, as given to Allocate
+   * \param block the block
+   * \param size the size given to Allocate (or any size with the same block size)
+   */
+  static void Deallocate (enum Kind kind, void *block, std::size_t size);
+  /**
+   * \param size requested size
+   * \returns the usable size of the block allocated for this size
+   */
+  static std::size_t GetBlockSize (std::size_t size);
+
+  /**
+   * \brief Recycle the released blocks (default)
+   */
+  static void Enable (void);
+  /**
+   * \brief Return the released blocks to the heap, and release the cached blocks of
+   * the calling thread
+   */
+  static void Disable (void);
+  /**
+   * \returns true if the released blocks are recycled
+   */
+  static bool IsEnabled (void);
+
+  /**
+   * \brief Release the cached blocks of the calling thread to the heap
+   */
+  static void Trim (void);
+
+  /**
+   * \param kind kind of object
+   * \returns the counters of this kind of object, summed over all threads
+   *
+   * The allocations minus the deallocations is the number of live objects, which
+   * makes it possible to detect leaked packets at the end of a simulation.  With
+   * several threads, the counters should only be read while the simulation is not
+   * running.
+   */
+  static Stats GetStats (enum Kind kind);
+  /**
+   * \brief Reset all counters
+   */
+  static void ResetStats (void);
+  /**
+   * \returns the number of bytes held in the free lists of all threads
+   */
+  static uint64_t GetCachedBytes (void);
+  /**
+   * \brief Print the counters of all kinds of objects
+   * \param os output stream
+   */
+  static void Print (std::ostream &os);
+};
+
+} // namespace ns3
+
+#endif /* PACKET_MEMORY_POOL_H */
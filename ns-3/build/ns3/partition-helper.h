@@ -0,0 +1,87 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+#ifndef VANETMOBILITY_PARTITION_HELPER_H
+#define VANETMOBILITY_PARTITION_HELPER_H
+
+#include "ns3/ptr.h"
+#include "ns3/node-container.h"
+#include "ns3/vector.h"
+#include <vector>
+
+namespace ns3
+{
+namespace vanetmobility
+{
+namespace sumomobility
+{
+class SumoMobility;
+}
+
+/**
+ * \brief Assigns vehicles to the ranks of a distributed simulation by road region
+ *
+ * The bounding box of the vehicle positions is cut across its longer side into as many
+ * strips as there are ranks, each holding the same number of vehicles.  A vehicle is
+ * placed into the strip of the median point of its SUMO trace, so most vehicles stay
+ * in the region of their rank and most of the wireless traffic remains local.
+ *
+ * The vehicles are created as nodes with the system ids of their regions, in the
+ * order of the SUMO vehicles, as expected by SumoMobility::Install:
+ *
+ * \code
+ *   Ptr<sumomobility::SumoMobility> sumo = ...;
+ *   PartitionHelper partition (MpiInterface::GetSize ());
+ *   partition.Partition (sumo);
+ *   NodeContainer vehicles = partition.Create ();
+ *   sumo->Install ();
+ * \endcode
+ */
+class PartitionHelper
+{
+public:
+  /**
+   * \param systemCount number of ranks
+   */
+  PartitionHelper (uint32_t systemCount);
+
+  /**
+   * \brief Partition the vehicles of SUMO traces
+   */
+  void Partition (Ptr<sumomobility::SumoMobility> sumo);
+
+  /**
+   * \brief Partition vehicles given by their representative positions
+   */
+  void Partition (const std::vector<Vector> &positions);
+
+  /**
+   * \return system id assigned to the vehicle
+   */
+  uint32_t GetSystemId (uint32_t vehicle) const;
+
+  /**
+   * \return coordinates along the cut axis where the strips of the ranks meet
+   *         (systemCount - 1 values, unless there are fewer vehicles than ranks)
+   */
+  const std::vector<double>& GetBoundaries () const;
+
+  /**
+   * \return true if the strips are cut along the y axis
+   */
+  bool IsCutAlongY () const;
+
+  /**
+   * \brief Create a node for every vehicle, with the system id of its region
+   */
+  NodeContainer Create () const;
+
+private:
+  uint32_t m_systemCount;
+  std::vector<uint32_t> m_systemIds;
+  std::vector<double> m_boundaries;
+  bool m_alongY;
+};
+
+} /* namespace vanetmobility */
+} /* namespace ns3 */
+
+#endif /* VANETMOBILITY_PARTITION_HELPER_H */
@@ -0,0 +1,14 @@
+
+#ifdef NS3_MODULE_COMPILATION
+# error "Do not include ns3 module aggregator headers from other modules; these are meant only for end user scripts."
+#endif
+
+#ifndef NS3_MODULE_SDN
+    
+
+// Module headers:
+#include "sdn-duplicate-detection.h"
+#include "sdn-header.h"
+#include "sdn-helper.h"
+#include "sdn-routing-protocol.h"
+#endif
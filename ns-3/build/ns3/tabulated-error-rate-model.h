@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef TABULATED_ERROR_RATE_MODEL_H
+#define TABULATED_ERROR_RATE_MODEL_H
+
+#include <stdint.h>
+#include <vector>
+#include "wifi-mode.h"
+#include "error-rate-model.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ *
+ * An error rate model that interpolates precomputed tables of another (reference)
+ * error rate model, by default NistErrorRateModel.
+ *
+ * The analytic models compute the chunk success rate as (1 - pe (snr))^nbits, so for
+ * every OFDM (including ERP-OFDM and HT) WifiMode the table stores y (snr) = log (pe (snr)),
+ * sampled at 64 points per octave of linear SNR (about 0.05 dB apart) from 2^-10 (-30 dB)
+ * to 2^20 (60 dB).  SNR outside this range is clamped to it.  A lookup takes the table cell
+ * directly from the exponent and the leading mantissa bits of the SNR, interpolates y
+ * linearly and returns exp (nbits * log1p (-exp (y))): there are no data-dependent branches
+ * and no calls to erfc or pow on the reception path.
+ *
+ * Since log (pe) is nearly linear in SNR in the region where the chunk success rate is
+ * neither 0 nor 1, the interpolation is accurate: for the 802.11a/g/p OFDM modes with
+ * the NIST and YANS models, the absolute difference from the reference chunk success rate
+ * is below 5e-4 for chunks of 8 bits or more (checked by the devices-wifi-error-rate test
+ * suite).  Chunks of a few bits can be off by up to 0.05 right where the NIST model
+ * saturates pe to 1.
+ *
+ * DSSS modes are passed to the reference model unchanged: the DSSS models are piecewise
+ * with discontinuities that cannot be interpolated.
+ *
+ * The table for a mode is built on its first use (1921 evaluations of the reference model),
+ * so the reference model should not be modified afterwards.
+ */
+class TabulatedErrorRateModel : public ErrorRateModel
+{
+public:
+  static TypeId GetTypeId (void);
+
+  TabulatedErrorRateModel ();
+  virtual ~TabulatedErrorRateModel ();
+
+  /**
+   * \param model the error rate model to tabulate
+   *
+   * Drops all previously built tables.
+   */
+  void SetReferenceModel (Ptr<ErrorRateModel> model);
+  /**
+   * \return the error rate model being tabulated
+   */
+  Ptr<ErrorRateModel> GetReferenceModel (void) const;
+
+  virtual double GetChunkSuccessRate (WifiMode mode, double snr, uint32_t nbits) const;
+
+  /**
+   * Compute chunk success rates for a batch of chunks sent with the same mode.  For OFDM
+   * modes the loop has no branches and all chunks share the same table.
+   *
+   * \param mode the Wi-Fi mode the chunks are sent with
+   * \param snr array of SNR of the chunks
+   * \param nbits array of number of bits in the chunks
+   * \param rates array to store the success rates
+   * \param count number of chunks
+   */
+  void GetChunkSuccessRates (WifiMode mode, const double *snr, const uint32_t *nbits,
+                             double *rates, uint32_t count) const;
+
+private:
+  enum
+  {
+    SUB_CELL_BITS = 6,
+    CELLS_PER_OCTAVE = 1 << SUB_CELL_BITS,
+    MIN_EXPONENT = -10,
+    MAX_EXPONENT = 20,
+    N_CELLS = (MAX_EXPONENT - MIN_EXPONENT) * CELLS_PER_OCTAVE
+  };
+
+  struct Cell
+  {
+    double snr;   // SNR at the start of the cell
+    double y;     // log (pe) at the start of the cell
+    double slope; // dy / dsnr within the cell
+  };
+  typedef std::vector<Cell> Table;
+
+  static bool IsTabulated (WifiMode mode);
+  const Table& GetTable (WifiMode mode) const;
+  void BuildTable (WifiMode mode, Table &table) const;
+  inline double Lookup (const Table &table, double snr, uint32_t nbits) const;
+
+  Ptr<ErrorRateModel> m_reference;
+  double m_minSnr;
+  double m_maxSnr;
+  mutable std::vector<Table> m_tables; // indexed by WifiMode uid
+};
+
+} // namespace ns3
+
+#endif /* TABULATED_ERROR_RATE_MODEL_H */
@@ -0,0 +1,17 @@
+
+#ifdef NS3_MODULE_COMPILATION
+# error "Do not include ns3 module aggregator headers from other modules; these are meant only for end user scripts."
+#endif
+
+#ifndef NS3_MODULE_VANETMOBILITY
+    
+
+// Module headers:
+#include "RouteElement.h"
+#include "SumoMobility.h"
+#include "partition-helper.h"
+#include "tinystr.h"
+#include "tinyxml.h"
+#include "vanetmobility-helper.h"
+#include "vanetmobility.h"
+#endif
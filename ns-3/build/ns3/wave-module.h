@@ -0,0 +1,16 @@
+
+#ifdef NS3_MODULE_COMPILATION
+# error "Do not include ns3 module aggregator headers from other modules; these are meant only for end user scripts."
+#endif
+
+#ifndef NS3_MODULE_WAVE
+    
+
+// Module headers:
+#include "higher-tx-tag.h"
+#include "ocb-wifi-mac.h"
+#include "vendor-specific-action.h"
+#include "wave-mac-helper.h"
+#include "wave-mac-low.h"
+#include "wifi-80211p-helper.h"
+#endif
@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef YANS_WIFI_REMOTE_CHANNEL_H
+#define YANS_WIFI_REMOTE_CHANNEL_H
+
+#include "yans-wifi-channel.h"
+
+namespace ns3 {
+
+/**
+ * \brief A Yans wifi channel spanning several MPI ranks
+ * \ingroup wifi
+ *
+ * Used instead of YansWifiChannel by YansWifiChannelHelper when the simulation is
+ * distributed (see MpiInterface).  Every rank holds the complete list of PHYs and the
+ * mobility of all nodes, so the propagation is calculated by the rank of the sender.
+ * Packets for PHYs of nodes owned by the rank of the sender are delivered as usual,
+ * packets for the other PHYs are sent with MpiInterface::SendPacket to the rank owning
+ * the node, where YansWifiPhyHelper has aggregated an MpiReceiver to the device.
+ *
+ * The channel reports its "LookAhead", the earliest time after a transmission its
+ * first bit can reach a PHY on another rank, to DistributedSimulatorImpl.  It is the
+ * propagation delay over MinimumRemoteDistance, i.e., the smallest distance between
+ * nodes of different ranks the scenario guarantees (e.g., by partitioning the nodes by
+ * road region, see vanetmobility::PartitionHelper).  Should two nodes of different ranks
+ * get closer, the reception is postponed to the lookahead, so that causality is
+ * preserved, and a warning is logged.
+ */
+class YansWifiRemoteChannel : public YansWifiChannel
+{
+public:
+  static TypeId GetTypeId (void);
+
+  YansWifiRemoteChannel ();
+  virtual ~YansWifiRemoteChannel ();
+
+  /**
+   * \return the earliest time after a transmission when its first bit can reach a PHY
+   *         on another rank
+   */
+  Time GetLookAhead (void) const;
+
+  /**
+   * \return number of receptions on other ranks which were postponed to the lookahead
+   */
+  uint32_t GetNLateDeliveries (void) const;
+
+  /**
+   * Receive a packet sent by the rank of the transmitter.  Should be set as the
+   * callback of MpiReceiver aggregated to every device attached to the channel.
+   *
+   * \param packet the packet with the YansWifiRemoteHeader
+   */
+  void ReceiveRemote (Ptr<Packet> packet);
+
+protected:
+  virtual void Deliver (uint32_t i, Ptr<const Packet> packet, Time delay, double rxPowerDbm,
+                        WifiTxVector txVector, WifiPreamble preamble) const;
+
+private:
+  double m_minimumRemoteDistance;
+  double m_remoteRxPowerThreshold;
+  mutable uint32_t m_lateDeliveries;
+};
+
+} // namespace ns3
+
+#endif /* YANS_WIFI_REMOTE_CHANNEL_H */
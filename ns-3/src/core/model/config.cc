@@ -24,8 +24,10 @@
 #include "object-ptr-container.h"
 #include "names.h"
 #include "pointer.h"
+#include "trace-source-accessor.h"
 #include "log.h"
 
+#include <map>
 #include <sstream>
 
 NS_LOG_COMPONENT_DEFINE ("Config");
@@ -147,6 +149,11 @@ class ArrayMatcher
 public:
   ArrayMatcher (std::string element);
   bool Matches (uint32_t i) const;
+  /**
+   * \param index the index designated by the element
+   * \returns true if the element is a plain index, matching this index only
+   */
+  bool GetIndex (uint32_t *index) const;
 private:
   bool StringToUint32 (std::string str, uint32_t *value) const;
   std::string m_element;
@@ -222,6 +229,18 @@ ArrayMatcher::Matches (uint32_t i) const
   return false;
 }
 
+bool
+ArrayMatcher::GetIndex (uint32_t *index) const
+{
+  NS_LOG_FUNCTION (this << index);
+  if (m_element.empty () ||
+      m_element.find_first_not_of ("0123456789") != std::string::npos)
+    {
+      return false;
+    }
+  return StringToUint32 (m_element, index);
+}
+
 bool
 ArrayMatcher::StringToUint32 (std::string str, uint32_t *value) const
 {
@@ -233,52 +252,166 @@ ArrayMatcher::StringToUint32 (std::string str, uint32_t *value) const
 }
 
 
+/**
+ * \brief Element of the configuration paths, parsed once and shared by all the
+ * paths where it appears
+ *
+ * The attributes and trace sources an element designates depend on the type of
+ * the object it is applied to, they are looked up once per TypeId.
+ */
+struct ConfigPathItem
+{
+  /**
+   * \brief Pointer or object container attribute matched by the element
+   */
+  struct Attribute
+  {
+    std::string name;
+    uint32_t flags;
+    Ptr<const AttributeAccessor> accessor;
+    const ObjectPtrContainerAccessor *container; //!< 0 for a pointer attribute
+  };
+  typedef std::vector<Attribute> Attributes;
+
+  ConfigPathItem (std::string name);
+  const Attributes &GetAttributes (TypeId tid);
+  Ptr<const TraceSourceAccessor> GetTraceSource (TypeId tid);
+  TypeId GetObjectTypeId (void);
+
+  std::string name;
+  bool names;       //!< the element starts a /Names path
+  bool getObject;   //!< the element is a call to GetObject ($TypeName)
+  ArrayMatcher matcher;
+  bool isIndex;     //!< the element is a plain index in an object container
+  uint32_t index;
+
+private:
+  bool m_tidResolved;
+  TypeId m_tid;
+  std::map<uint16_t, Attributes> m_attributes;
+  std::map<uint16_t, Ptr<const TraceSourceAccessor> > m_traceSources;
+};
+
+ConfigPathItem::ConfigPathItem (std::string name)
+  : name (name),
+    names (name.find ("Names") == 0),
+    getObject (name.find ("$") == 0),
+    matcher (name),
+    m_tidResolved (false)
+{
+  NS_LOG_FUNCTION (this << name);
+  isIndex = matcher.GetIndex (&index);
+}
+
+const ConfigPathItem::Attributes &
+ConfigPathItem::GetAttributes (TypeId tid)
+{
+  std::map<uint16_t, Attributes>::iterator cached = m_attributes.find (tid.GetUid ());
+  if (cached != m_attributes.end ())
+    {
+      return cached->second;
+    }
+
+  NS_LOG_FUNCTION (this << tid);
+  Attributes &attributes = m_attributes[tid.GetUid ()];
+  TypeId nextTid = tid;
+  do
+    {
+      tid = nextTid;
+      for (uint32_t i = 0; i < tid.GetAttributeN (); i++)
+        {
+          struct TypeId::AttributeInformation info = tid.GetAttribute (i);
+          if (info.name != name && name != "*")
+            {
+              continue;
+            }
+          Attribute attribute;
+          attribute.name = info.name;
+          attribute.flags = info.flags;
+          attribute.accessor = info.accessor;
+          if (dynamic_cast<const PointerChecker *> (PeekPointer (info.checker)) != 0)
+            {
+              attribute.container = 0;
+              attributes.push_back (attribute);
+            }
+          else if (dynamic_cast<const ObjectPtrContainerChecker *> (PeekPointer (info.checker)) != 0)
+            {
+              attribute.container = dynamic_cast<const ObjectPtrContainerAccessor *> (PeekPointer (info.accessor));
+              NS_ASSERT (attribute.container != 0);
+              attributes.push_back (attribute);
+            }
+          // this could be anything else and we don't know what to do with it.
+          // So, we just ignore it.
+        }
+      nextTid = tid.GetParent ();
+    } while (nextTid != tid);
+  return attributes;
+}
+
+Ptr<const TraceSourceAccessor>
+ConfigPathItem::GetTraceSource (TypeId tid)
+{
+  std::map<uint16_t, Ptr<const TraceSourceAccessor> >::iterator cached = m_traceSources.find (tid.GetUid ());
+  if (cached != m_traceSources.end ())
+    {
+      return cached->second;
+    }
+  Ptr<const TraceSourceAccessor> accessor = tid.LookupTraceSourceByName (name);
+  m_traceSources[tid.GetUid ()] = accessor;
+  return accessor;
+}
+
+TypeId
+ConfigPathItem::GetObjectTypeId (void)
+{
+  if (!m_tidResolved)
+    {
+      m_tid = TypeId::LookupByName (name.substr (1, name.size () - 1));
+      m_tidResolved = true;
+    }
+  return m_tid;
+}
+
+
 class Resolver
 {
 public:
-  Resolver (std::string path);
+  Resolver (const std::vector<ConfigPathItem *> &items);
   virtual ~Resolver ();
 
   void Resolve (Ptr<Object> root);
+  /**
+   * \param cache the contents of the object containers read so far, reused by the
+   *        next resolutions instead of reading the containers again
+   */
+  void SetContainerCache (std::map<std::pair<const Object *, const AttributeAccessor *>, ObjectPtrContainerValue> *cache);
 private:
-  void Canonicalize (void);
-  void DoResolve (std::string path, Ptr<Object> root);
-  void DoArrayResolve (std::string path, const ObjectPtrContainerValue &vector);
-  void DoResolveOne (Ptr<Object> object);
-  std::string GetResolvedPath (void) const;
+  void DoResolve (uint32_t i, Ptr<Object> root);
+  void DoArrayResolve (uint32_t i, Ptr<Object> root, const ConfigPathItem::Attribute &attribute);
+  void Push (const std::string &item);
+  void Pop (std::string::size_type size);
   virtual void DoOne (Ptr<Object> object, std::string path) = 0;
-  std::vector<std::string> m_workStack;
-  std::string m_path;
+  const std::vector<ConfigPathItem *> &m_items;
+  std::string m_resolvedPath;
+  std::map<std::pair<const Object *, const AttributeAccessor *>, ObjectPtrContainerValue> *m_containerCache;
 };
 
-Resolver::Resolver (std::string path)
-  : m_path (path)
+Resolver::Resolver (const std::vector<ConfigPathItem *> &items)
+  : m_items (items),
+    m_resolvedPath ("/"),
+    m_containerCache (0)
 {
-  NS_LOG_FUNCTION (this << path);
-  Canonicalize ();
+  NS_LOG_FUNCTION (this << items.size ());
 }
 Resolver::~Resolver ()
 {
   NS_LOG_FUNCTION (this);
 }
+
 void
-Resolver::Canonicalize (void)
+Resolver::SetContainerCache (std::map<std::pair<const Object *, const AttributeAccessor *>, ObjectPtrContainerValue> *cache)
 {
-  NS_LOG_FUNCTION (this);
-
-  // ensure that we start and end with a '/'
-  std::string::size_type tmp = m_path.find ("/");
-  if (tmp != 0)
-    {
-      // no slash at start
-      m_path = "/" + m_path;
-    }
-  tmp = m_path.find_last_of ("/");
-  if (tmp != (m_path.size () - 1))
-    {
-      // no slash at end
-      m_path = m_path + "/";
-    }
+  m_containerCache = cache;
 }
 
 void 
@@ -286,39 +419,28 @@ Resolver::Resolve (Ptr<Object> root)
 {
   NS_LOG_FUNCTION (this << root);
 
-  DoResolve (m_path, root);
+  DoResolve (0, root);
 }
 
-std::string
-Resolver::GetResolvedPath (void) const
+void
+Resolver::Push (const std::string &item)
 {
-  NS_LOG_FUNCTION (this);
-
-  std::string fullPath = "/";
-  for (std::vector<std::string>::const_iterator i = m_workStack.begin (); i != m_workStack.end (); i++)
-    {
-      fullPath += *i + "/";
-    }
-  return fullPath;
+  m_resolvedPath += item;
+  m_resolvedPath += "/";
 }
 
-void 
-Resolver::DoResolveOne (Ptr<Object> object)
+void
+Resolver::Pop (std::string::size_type size)
 {
-  NS_LOG_FUNCTION (this << object);
-
-  NS_LOG_DEBUG ("resolved="<<GetResolvedPath ());
-  DoOne (object, GetResolvedPath ());
+  m_resolvedPath.resize (size);
 }
 
 void
-Resolver::DoResolve (std::string path, Ptr<Object> root)
+Resolver::DoResolve (uint32_t i, Ptr<Object> root)
 {
-  NS_LOG_FUNCTION (this << path << root);
-  NS_ASSERT ((path.find ("/")) == 0);
-  std::string::size_type next = path.find ("/", 1);
+  NS_LOG_FUNCTION (this << i << root);
 
-  if (next == std::string::npos)
+  if (i == m_items.size ())
     {
       //
       // If root is zero, we're beginning to see if we can use the object name 
@@ -330,12 +452,13 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
       // 
       if (root)
         {
-          DoResolveOne (root);
+          NS_LOG_DEBUG ("resolved=" << m_resolvedPath);
+          DoOne (root, m_resolvedPath);
         }
       return;
     }
-  std::string item = path.substr (1, next-1);
-  std::string pathLeft = path.substr (next, path.size ()-next);
+  ConfigPathItem *item = m_items[i];
+  std::string::size_type size = m_resolvedPath.size ();
 
   //
   // If root is zero, we're beginning to see if we can use the object name 
@@ -344,16 +467,12 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
   // the root of the "/Names" namespace, so we just ignore it and move on to 
   // the next segment.
   //
-  if (root == 0)
+  if (root == 0 && item->names)
     {
-      std::string::size_type offset = path.find ("/Names");
-      if (offset == 0)
-        {
-          m_workStack.push_back (item);
-          DoResolve (pathLeft, root);
-          m_workStack.pop_back ();
-          return;
-        }
+      Push (item->name);
+      DoResolve (i + 1, root);
+      Pop (size);
+      return;
     }
 
   //
@@ -362,13 +481,13 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
   // zero, this means to look in the root of the "/Names" name space, otherwise
   // it refers to a name space context (level).
   //
-  Ptr<Object> namedObject = Names::Find<Object> (root, item);
+  Ptr<Object> namedObject = Names::Find<Object> (root, item->name);
   if (namedObject)
     {
-      NS_LOG_DEBUG ("Name system resolved item = " << item << " to " << namedObject);
-      m_workStack.push_back (item);
-      DoResolve (pathLeft, namedObject);
-      m_workStack.pop_back ();
+      NS_LOG_DEBUG ("Name system resolved item = " << item->name << " to " << namedObject);
+      Push (item->name);
+      DoResolve (i + 1, namedObject);
+      Pop (size);
       return;
     }
 
@@ -383,129 +502,138 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
     {
       return;
     }
-  std::string::size_type dollarPos = item.find ("$");
-  if (dollarPos == 0)
+  if (item->getObject)
     {
       // This is a call to GetObject
-      std::string tidString = item.substr (1, item.size () - 1);
-      NS_LOG_DEBUG ("GetObject="<<tidString<<" on path="<<GetResolvedPath ());
-      TypeId tid = TypeId::LookupByName (tidString);
-      Ptr<Object> object = root->GetObject<Object> (tid);
+      NS_LOG_DEBUG ("GetObject="<<item->name<<" on path="<<m_resolvedPath);
+      Ptr<Object> object = root->GetObject<Object> (item->GetObjectTypeId ());
       if (object == 0)
         {
-          NS_LOG_DEBUG ("GetObject ("<<tidString<<") failed on path="<<GetResolvedPath ());
+          NS_LOG_DEBUG ("GetObject ("<<item->name<<") failed on path="<<m_resolvedPath);
           return;
         }
-      m_workStack.push_back (item);
-      DoResolve (pathLeft, object);
-      m_workStack.pop_back ();
+      Push (item->name);
+      DoResolve (i + 1, object);
+      Pop (size);
     }
   else 
     {
       // this is a normal attribute.
-      TypeId tid;
-      TypeId nextTid = root->GetInstanceTypeId ();
-      bool foundMatch = false;
-      
-      do
+      TypeId tid = root->GetInstanceTypeId ();
+      const ConfigPathItem::Attributes &attributes = item->GetAttributes (tid);
+      if (attributes.empty ())
         {
-          tid = nextTid;
-          
-          for (uint32_t i = 0; i < tid.GetAttributeN(); i++)
+          NS_LOG_DEBUG ("Requested item="<<item->name<<" does not exist on path="<<m_resolvedPath);
+          return;
+        }
+      for (ConfigPathItem::Attributes::const_iterator j = attributes.begin (); j != attributes.end (); j++)
+        {
+          if (!(j->flags & TypeId::ATTR_GET) || !j->accessor->HasGetter ())
             {
-              struct TypeId::AttributeInformation info;
-              info = tid.GetAttribute(i);
-              if (info.name != item && item != "*")
+              NS_FATAL_ERROR ("Attribute name="<<j->name<<" is not gettable for this object: tid="<<tid.GetName ());
+            }
+          if (j->container == 0)
+            {
+              NS_LOG_DEBUG ("GetAttribute(ptr)="<<j->name<<" on path="<<m_resolvedPath);
+              PointerValue ptr;
+              j->accessor->Get (PeekPointer (root), ptr);
+              Ptr<Object> object = ptr.Get<Object> ();
+              if (object == 0)
                 {
+                  NS_LOG_ERROR ("Requested object name=\""<<item->name<<
+                                "\" exists on path=\""<<m_resolvedPath<<"\""
+                                " but is null.");
                   continue;
                 }
-              // attempt to cast to a pointer checker.
-              const PointerChecker *ptr = dynamic_cast<const PointerChecker *> (PeekPointer (info.checker));
-              if (ptr != 0)
-                {
-                  NS_LOG_DEBUG ("GetAttribute(ptr)="<<info.name<<" on path="<<GetResolvedPath ());
-                  PointerValue ptr;
-                  root->GetAttribute (info.name, ptr);
-                  Ptr<Object> object = ptr.Get<Object> ();
-                  if (object == 0)
-                    {
-                      NS_LOG_ERROR ("Requested object name=\""<<item<<
-                                    "\" exists on path=\""<<GetResolvedPath ()<<"\""
-                                    " but is null.");
-                      continue;
-                    }
-                  foundMatch = true;
-                  m_workStack.push_back (info.name);
-                  DoResolve (pathLeft, object);
-                  m_workStack.pop_back ();
-                }
-              // attempt to cast to an object vector.
-              const ObjectPtrContainerChecker *vectorChecker = 
-                dynamic_cast<const ObjectPtrContainerChecker *> (PeekPointer (info.checker));
-              if (vectorChecker != 0)
-                {
-                  NS_LOG_DEBUG ("GetAttribute(vector)="<<info.name<<" on path="<<GetResolvedPath () << pathLeft);
-                  foundMatch = true;
-                  ObjectPtrContainerValue vector;
-                  root->GetAttribute (info.name, vector);
-                  m_workStack.push_back (info.name);
-                  DoArrayResolve (pathLeft, vector);
-                  m_workStack.pop_back ();
-                }
-              // this could be anything else and we don't know what to do with it.
-              // So, we just ignore it.
+              Push (j->name);
+              DoResolve (i + 1, object);
+              Pop (size);
+            }
+          else
+            {
+              NS_LOG_DEBUG ("GetAttribute(vector)="<<j->name<<" on path="<<m_resolvedPath);
+              Push (j->name);
+              DoArrayResolve (i + 1, root, *j);
+              Pop (size);
             }
-
-          nextTid = tid.GetParent ();
-        } while (nextTid != tid);
-      
-      if (!foundMatch)
-        {
-          NS_LOG_DEBUG ("Requested item="<<item<<" does not exist on path="<<GetResolvedPath ());
-          return;
         }
     }
 }
 
 void 
-Resolver::DoArrayResolve (std::string path, const ObjectPtrContainerValue &container)
+Resolver::DoArrayResolve (uint32_t i, Ptr<Object> root, const ConfigPathItem::Attribute &attribute)
 {
-  NS_LOG_FUNCTION(this << path << &container);
-  NS_ASSERT (path != "");
-  NS_ASSERT ((path.find ("/")) == 0);
-  std::string::size_type next = path.find ("/", 1);
-  if (next == std::string::npos)
+  NS_LOG_FUNCTION (this << i << root << attribute.name);
+  if (i == m_items.size ())
     {
       return;
     }
-  std::string item = path.substr (1, next-1);
-  std::string pathLeft = path.substr (next, path.size ()-next);
+  ConfigPathItem *item = m_items[i];
+  std::string::size_type size = m_resolvedPath.size ();
 
-  ArrayMatcher matcher = ArrayMatcher (item);
-  ObjectPtrContainerValue::Iterator it;
-  for (it = container.Begin (); it != container.End (); ++it)
+  if (item->isIndex)
     {
-      if (matcher.Matches ((*it).first))
+      // only one object can match: do not read the whole container
+      Ptr<Object> object = attribute.container->GetItem (PeekPointer (root), item->index);
+      if (object != 0)
+        {
+          Push (item->name);
+          DoResolve (i + 1, object);
+          Pop (size);
+        }
+      return;
+    }
+
+  ObjectPtrContainerValue local;
+  ObjectPtrContainerValue *container = &local;
+  if (m_containerCache != 0)
+    {
+      std::pair<const Object *, const AttributeAccessor *> key (PeekPointer (root), PeekPointer (attribute.accessor));
+      std::map<std::pair<const Object *, const AttributeAccessor *>, ObjectPtrContainerValue>::iterator cached = m_containerCache->find (key);
+      if (cached == m_containerCache->end ())
+        {
+          cached = m_containerCache->insert (std::make_pair (key, ObjectPtrContainerValue ())).first;
+          attribute.accessor->Get (PeekPointer (root), cached->second);
+        }
+      container = &cached->second;
+    }
+  else
+    {
+      attribute.accessor->Get (PeekPointer (root), local);
+    }
+
+  for (ObjectPtrContainerValue::Iterator it = container->Begin (); it != container->End (); ++it)
+    {
+      if (item->matcher.Matches ((*it).first))
         {
           std::ostringstream oss;
           oss << (*it).first;
-          m_workStack.push_back (oss.str ());
-          DoResolve (pathLeft, (*it).second);
-          m_workStack.pop_back ();
+          Push (oss.str ());
+          DoResolve (i + 1, (*it).second);
+          Pop (size);
         }
     }
 }
 
 
+/**
+ * \brief Contents of the object containers read while resolving several paths
+ */
+typedef std::map<std::pair<const Object *, const AttributeAccessor *>, ObjectPtrContainerValue> ContainerCache;
+
 class ConfigImpl 
 {
 public:
+  ~ConfigImpl ();
+
   void Set (std::string path, const AttributeValue &value);
   void ConnectWithoutContext (std::string path, const CallbackBase &cb);
   void Connect (std::string path, const CallbackBase &cb);
   void DisconnectWithoutContext (std::string path, const CallbackBase &cb);
   void Disconnect (std::string path, const CallbackBase &cb);
+  void ConnectAll (const std::vector<std::string> &paths, const std::vector<CallbackBase> &cbs, bool context);
   Config::MatchContainer LookupMatches (std::string path);
+  Config::MatchContainer LookupMatches (const std::vector<ConfigPathItem *> &items, std::string path);
 
   void RegisterRootNamespaceObject (Ptr<Object> obj);
   void UnregisterRootNamespaceObject (Ptr<Object> obj);
@@ -513,82 +641,208 @@ public:
   uint32_t GetRootNamespaceObjectN (void) const;
   Ptr<Object> GetRootNamespaceObject (uint32_t i) const;
 
+  void Compile (std::string path, Config::CompiledPath *compiled);
+  void Trace (const Config::CompiledPath &path, const CallbackBase &cb,
+              bool context, bool connect, ContainerCache *cache);
+
 private:
-  void ParsePath (std::string path, std::string *root, std::string *leaf) const;
+  void Split (std::string path, std::vector<ConfigPathItem *> *items);
+  ConfigPathItem *GetItem (const std::string &name);
+  void Resolve (Resolver &resolver) const;
+
   typedef std::vector<Ptr<Object> > Roots;
   Roots m_roots;
+  /// elements of the paths used so far, by name
+  std::map<std::string, ConfigPathItem *> m_items;
 };
 
+ConfigImpl::~ConfigImpl ()
+{
+  for (std::map<std::string, ConfigPathItem *>::iterator i = m_items.begin (); i != m_items.end (); i++)
+    {
+      delete i->second;
+    }
+}
+
+ConfigPathItem *
+ConfigImpl::GetItem (const std::string &name)
+{
+  std::map<std::string, ConfigPathItem *>::iterator i = m_items.find (name);
+  if (i == m_items.end ())
+    {
+      i = m_items.insert (std::make_pair (name, new ConfigPathItem (name))).first;
+    }
+  return i->second;
+}
+
+void
+ConfigImpl::Split (std::string path, std::vector<ConfigPathItem *> *items)
+{
+  NS_LOG_FUNCTION (this << path << items);
+
+  // ensure that we start and end with a '/'
+  std::string::size_type tmp = path.find ("/");
+  if (tmp != 0)
+    {
+      // no slash at start
+      path = "/" + path;
+    }
+  tmp = path.find_last_of ("/");
+  if (tmp != (path.size () - 1))
+    {
+      // no slash at end
+      path = path + "/";
+    }
+  std::string::size_type start = 1;
+  std::string::size_type next;
+  while ((next = path.find ("/", start)) != std::string::npos)
+    {
+      items->push_back (GetItem (path.substr (start, next - start)));
+      start = next + 1;
+    }
+}
+
 void 
-ConfigImpl::ParsePath (std::string path, std::string *root, std::string *leaf) const
+ConfigImpl::Compile (std::string path, Config::CompiledPath *compiled)
 {
-  NS_LOG_FUNCTION (this << path << root << leaf);
+  NS_LOG_FUNCTION (this << path << compiled);
 
   std::string::size_type slash = path.find_last_of ("/");
   NS_ASSERT (slash != std::string::npos);
-  *root = path.substr (0, slash);
-  *leaf = path.substr (slash+1, path.size ()-(slash+1));
-  NS_LOG_FUNCTION (path << *root << *leaf);
+  compiled->m_path = path;
+  compiled->m_root = path.substr (0, slash);
+  compiled->m_leaf = GetItem (path.substr (slash+1, path.size ()-(slash+1)));
+  compiled->m_items.clear ();
+  Split (compiled->m_root, &compiled->m_items);
+}
+
+void
+ConfigImpl::Resolve (Resolver &resolver) const
+{
+  NS_LOG_FUNCTION (this << &resolver);
+  for (Roots::const_iterator i = m_roots.begin (); i != m_roots.end (); i++)
+    {
+      resolver.Resolve (*i);
+    }
+
+  //
+  // See if we can do something with the object name service.  Starting with
+  // the root pointer zeroed indicates to the resolver that it should start
+  // looking at the root of the "/Names" namespace during this go.
+  //
+  resolver.Resolve (0);
 }
 
 void 
 ConfigImpl::Set (std::string path, const AttributeValue &value)
 {
   NS_LOG_FUNCTION (this << path << &value);
-
-  std::string root, leaf;
-  ParsePath (path, &root, &leaf);
-  Config::MatchContainer container = LookupMatches (root);
-  container.Set (leaf, value);
+  Config::CompiledPath (path).Set (value);
 }
 void 
 ConfigImpl::ConnectWithoutContext (std::string path, const CallbackBase &cb)
 {
   NS_LOG_FUNCTION (this << path << &cb);
-  std::string root, leaf;
-  ParsePath (path, &root, &leaf);
-  Config::MatchContainer container = LookupMatches (root);
-  container.ConnectWithoutContext (leaf, cb);
+  Config::CompiledPath (path).ConnectWithoutContext (cb);
 }
 void 
 ConfigImpl::DisconnectWithoutContext (std::string path, const CallbackBase &cb)
 {
   NS_LOG_FUNCTION (this << path << &cb);
-  std::string root, leaf;
-  ParsePath (path, &root, &leaf);
-  Config::MatchContainer container = LookupMatches (root);
-  container.DisconnectWithoutContext (leaf, cb);
+  Config::CompiledPath (path).DisconnectWithoutContext (cb);
 }
 void 
 ConfigImpl::Connect (std::string path, const CallbackBase &cb)
 {
   NS_LOG_FUNCTION (this << path << &cb);
-
-  std::string root, leaf;
-  ParsePath (path, &root, &leaf);
-  Config::MatchContainer container = LookupMatches (root);
-  container.Connect (leaf, cb);
+  Config::CompiledPath (path).Connect (cb);
 }
 void 
 ConfigImpl::Disconnect (std::string path, const CallbackBase &cb)
 {
   NS_LOG_FUNCTION (this << path << &cb);
+  Config::CompiledPath (path).Disconnect (cb);
+}
+
+void
+ConfigImpl::ConnectAll (const std::vector<std::string> &paths, const std::vector<CallbackBase> &cbs, bool context)
+{
+  NS_LOG_FUNCTION (this << paths.size () << cbs.size () << context);
+  NS_ASSERT (paths.size () == cbs.size ());
+  ContainerCache containers;
+  for (uint32_t i = 0; i < paths.size (); i++)
+    {
+      Trace (Config::CompiledPath (paths[i]), cbs[i], context, true, &containers);
+    }
+}
 
-  std::string root, leaf;
-  ParsePath (path, &root, &leaf);
-  Config::MatchContainer container = LookupMatches (root);
-  container.Disconnect (leaf, cb);
+void
+ConfigImpl::Trace (const Config::CompiledPath &path, const CallbackBase &cb,
+                   bool context, bool connect, ContainerCache *cache)
+{
+  NS_LOG_FUNCTION (this << path.GetPath () << &cb << context << connect << cache);
+  class TraceResolver : public Resolver
+  {
+  public:
+    TraceResolver (const std::vector<ConfigPathItem *> &items, ConfigPathItem *leaf,
+                   const CallbackBase &cb, bool context, bool connect)
+      : Resolver (items),
+        m_leaf (leaf),
+        m_cb (cb),
+        m_context (context),
+        m_connect (connect)
+    {}
+    virtual void DoOne (Ptr<Object> object, std::string path) {
+      Ptr<const TraceSourceAccessor> accessor = m_leaf->GetTraceSource (object->GetInstanceTypeId ());
+      if (accessor == 0)
+        {
+          return;
+        }
+      if (m_context)
+        {
+          std::string ctx = path + m_leaf->name;
+          m_connect ? accessor->Connect (PeekPointer (object), ctx, m_cb)
+                    : accessor->Disconnect (PeekPointer (object), ctx, m_cb);
+        }
+      else
+        {
+          m_connect ? accessor->ConnectWithoutContext (PeekPointer (object), m_cb)
+                    : accessor->DisconnectWithoutContext (PeekPointer (object), m_cb);
+        }
+    }
+  private:
+    ConfigPathItem *m_leaf;
+    const CallbackBase &m_cb;
+    bool m_context;
+    bool m_connect;
+  };
+  if (path.m_leaf == 0)
+    {
+      return;
+    }
+  TraceResolver resolver (path.m_items, path.m_leaf, cb, context, connect);
+  resolver.SetContainerCache (cache);
+  Resolve (resolver);
 }
 
 Config::MatchContainer 
 ConfigImpl::LookupMatches (std::string path)
 {
   NS_LOG_FUNCTION (this << path);
+  std::vector<ConfigPathItem *> items;
+  Split (path, &items);
+  return LookupMatches (items, path);
+}
+
+Config::MatchContainer 
+ConfigImpl::LookupMatches (const std::vector<ConfigPathItem *> &items, std::string path)
+{
+  NS_LOG_FUNCTION (this << items.size () << path);
   class LookupMatchesResolver : public Resolver 
   {
   public:
-    LookupMatchesResolver (std::string path)
-      : Resolver (path)
+    LookupMatchesResolver (const std::vector<ConfigPathItem *> &items)
+      : Resolver (items)
     {}
     virtual void DoOne (Ptr<Object> object, std::string path) {
       m_objects.push_back (object);
@@ -596,18 +850,8 @@ ConfigImpl::LookupMatches (std::string path)
     }
     std::vector<Ptr<Object> > m_objects;
     std::vector<std::string> m_contexts;
-  } resolver = LookupMatchesResolver (path);
-  for (Roots::const_iterator i = m_roots.begin (); i != m_roots.end (); i++)
-    {
-      resolver.Resolve (*i);
-    }
-
-  //
-  // See if we can do something with the object name service.  Starting with
-  // the root pointer zeroed indicates to the resolver that it should start
-  // looking at the root of the "/Names" namespace during this go.
-  //
-  resolver.Resolve (0);
+  } resolver (items);
+  Resolve (resolver);
 
   return Config::MatchContainer (resolver.m_objects, resolver.m_contexts, path);
 }
@@ -751,6 +995,81 @@ Config::MatchContainer LookupMatches (std::string path)
   NS_LOG_FUNCTION (path);
   return Singleton<ConfigImpl>::Get ()->LookupMatches (path);
 }
+void
+ConnectAll (const std::vector<std::string> &paths, const std::vector<CallbackBase> &cbs)
+{
+  NS_LOG_FUNCTION (paths.size () << cbs.size ());
+  Singleton<ConfigImpl>::Get ()->ConnectAll (paths, cbs, true);
+}
+void
+ConnectAllWithoutContext (const std::vector<std::string> &paths, const std::vector<CallbackBase> &cbs)
+{
+  NS_LOG_FUNCTION (paths.size () << cbs.size ());
+  Singleton<ConfigImpl>::Get ()->ConnectAll (paths, cbs, false);
+}
+
+CompiledPath::CompiledPath ()
+  : m_leaf (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+CompiledPath::CompiledPath (std::string path)
+  : m_leaf (0)
+{
+  NS_LOG_FUNCTION (this << path);
+  Singleton<ConfigImpl>::Get ()->Compile (path, this);
+}
+std::string
+CompiledPath::GetPath (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_path;
+}
+MatchContainer
+CompiledPath::LookupMatches (void) const
+{
+  NS_LOG_FUNCTION (this);
+  if (m_leaf == 0)
+    {
+      return MatchContainer ();
+    }
+  return Singleton<ConfigImpl>::Get ()->LookupMatches (m_items, m_root);
+}
+void
+CompiledPath::Set (const AttributeValue &value) const
+{
+  NS_LOG_FUNCTION (this << &value);
+  if (m_leaf == 0)
+    {
+      return;
+    }
+  LookupMatches ().Set (m_leaf->name, value);
+}
+void
+CompiledPath::Connect (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << &cb);
+  Singleton<ConfigImpl>::Get ()->Trace (*this, cb, true, true, 0);
+}
+void
+CompiledPath::ConnectWithoutContext (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << &cb);
+  Singleton<ConfigImpl>::Get ()->Trace (*this, cb, false, true, 0);
+}
+void
+CompiledPath::Disconnect (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << &cb);
+  Singleton<ConfigImpl>::Get ()->Trace (*this, cb, true, false, 0);
+}
+void
+CompiledPath::DisconnectWithoutContext (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << &cb);
+  Singleton<ConfigImpl>::Get ()->Trace (*this, cb, false, false, 0);
+}
+
 
 void RegisterRootNamespaceObject (Ptr<Object> obj)
 {
@@ -29,6 +29,8 @@ namespace ns3 {
 class AttributeValue;
 class Object;
 class CallbackBase;
+class ConfigImpl;
+struct ConfigPathItem;
 
 /**
  * \brief Configuration of simulation parameters and tracing
@@ -222,6 +224,95 @@ private:
  */
 MatchContainer LookupMatches (std::string path);
 
+/**
+ * \brief a configuration path parsed once, to be resolved many times
+ *
+ * Config::Set, Config::Connect and friends parse their path at every call.
+ * A CompiledPath parses it once in elements which are shared with all the other
+ * paths using them, and which remember the attributes and trace sources they
+ * designate for each TypeId.  An element which is a plain index in an object
+ * container (e.g., 5 in /NodeList/5/...) looks up this object only, instead of
+ * reading the whole container, so that the cost of connecting a path of one node
+ * does not depend on the number of nodes.
+ *
+ * The last element of the path is the name of the attribute or trace source
+ * set or connected on the objects matching the rest of the path.
+ */
+class CompiledPath
+{
+public:
+  /**
+   * Create an empty path, which matches no object
+   */
+  CompiledPath ();
+  /**
+   * \param path the path to parse
+   */
+  CompiledPath (std::string path);
+
+  /**
+   * \returns the path as given to the constructor
+   */
+  std::string GetPath (void) const;
+  /**
+   * \returns a container which contains all the objects which match the path
+   *          without its last element
+   */
+  MatchContainer LookupMatches (void) const;
+
+  /**
+   * \param value the value to set in all matching attributes.
+   * \sa ns3::Config::Set
+   */
+  void Set (const AttributeValue &value) const;
+  /**
+   * \param cb the callback to connect to the matching trace sources.
+   * \sa ns3::Config::Connect
+   */
+  void Connect (const CallbackBase &cb) const;
+  /**
+   * \param cb the callback to connect to the matching trace sources.
+   * \sa ns3::Config::ConnectWithoutContext
+   */
+  void ConnectWithoutContext (const CallbackBase &cb) const;
+  /**
+   * \param cb the callback to disconnect from the matching trace sources.
+   * \sa ns3::Config::Disconnect
+   */
+  void Disconnect (const CallbackBase &cb) const;
+  /**
+   * \param cb the callback to disconnect from the matching trace sources.
+   * \sa ns3::Config::DisconnectWithoutContext
+   */
+  void DisconnectWithoutContext (const CallbackBase &cb) const;
+
+private:
+  friend class ns3::ConfigImpl;
+  std::string m_path;
+  std::string m_root;
+  std::vector<ConfigPathItem *> m_items; //!< elements of m_root
+  ConfigPathItem *m_leaf;
+};
+
+/**
+ * \param paths paths to match trace sources.
+ * \param cbs the callbacks to connect to the trace sources matching each path.
+ *
+ * Equivalent to calling Config::Connect for each path and callback, but the
+ * object containers traversed by several paths with a wildcard (e.g.,
+ * /NodeList/[0-99]/...) are read only once.
+ */
+void ConnectAll (const std::vector<std::string> &paths, const std::vector<CallbackBase> &cbs);
+/**
+ * \param paths paths to match trace sources.
+ * \param cbs the callbacks to connect to the trace sources matching each path.
+ *
+ * Equivalent to calling Config::ConnectWithoutContext for each path and callback.
+ * \sa ConnectAll
+ */
+void ConnectAllWithoutContext (const std::vector<std::string> &paths, const std::vector<CallbackBase> &cbs);
+
+
 /**
  * \param obj a new root object
  *
@@ -0,0 +1,549 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "event-trace-simulator-impl.h"
+#include "default-simulator-impl.h"
+#include "event-id.h"
+#include "string.h"
+#include "log.h"
+
+#include <string.h>
+#include <typeinfo>
+
+#if (__GNUC__ >= 3)
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+
+NS_LOG_COMPONENT_DEFINE ("EventTraceSimulatorImpl");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (EventTraceSimulatorImpl);
+
+/*
+ * Layout of a trace, all integers in host byte order:
+ *
+ *   header:    char magic[8] = "ns3evtrc", uint32_t version, uint32_t Time resolution
+ *   entries:   RECORD_SIZE bytes each, see Record
+ *   callbacks: for each class of events, uint32_t length and the type_info name
+ *   footer:    uint64_t number of entries, uint32_t number of callbacks, uint32_t version
+ */
+namespace {
+
+const char MAGIC[8] = { 'n', 's', '3', 'e', 'v', 't', 'r', 'c' };
+const uint32_t VERSION = 1;
+const uint32_t HEADER_SIZE = 16;
+const uint32_t FOOTER_SIZE = 16;
+const uint32_t RECORD_SIZE = 20;
+const uint32_t BUFFER_SIZE = RECORD_SIZE * 65536;
+
+ObjectFactory
+GetDefaultSimulatorImplFactory ()
+{
+  ObjectFactory factory;
+  factory.SetTypeId (DefaultSimulatorImpl::GetTypeId ());
+  return factory;
+}
+
+template <typename T>
+void
+WriteValue (uint8_t *&buffer, T value)
+{
+  memcpy (buffer, &value, sizeof (T));
+  buffer += sizeof (T);
+}
+
+template <typename T>
+T
+ReadValue (const uint8_t *&buffer)
+{
+  T value;
+  memcpy (&value, buffer, sizeof (T));
+  buffer += sizeof (T);
+  return value;
+}
+
+} // anonymous namespace
+
+/**
+ * \brief Event recording its invocation before invoking the wrapped event
+ */
+class EventTraceSimulatorImpl::TraceEvent : public EventImpl
+{
+public:
+  TraceEvent (EventTraceSimulatorImpl *simulator, EventImpl *event,
+              uint32_t uid, uint16_t callback, bool destroy)
+    : m_simulator (simulator)
+    , m_event (event, false)
+    , m_uid (uid)
+    , m_callback (callback)
+    , m_destroy (destroy)
+  {
+  }
+
+  uint32_t GetUid (void) const
+  {
+    return m_uid;
+  }
+  uint16_t GetCallback (void) const
+  {
+    return m_callback;
+  }
+  bool IsDestroy (void) const
+  {
+    return m_destroy;
+  }
+
+protected:
+  virtual void Notify (void)
+  {
+    m_simulator->Record (EventTraceRecord::INVOKE | (m_destroy ? EventTraceRecord::DESTROY : 0),
+                         m_simulator->m_simulator->Now ().GetTimeStep (),
+                         m_uid, m_simulator->m_simulator->GetContext (), m_callback);
+    m_event->Invoke ();
+  }
+
+private:
+  EventTraceSimulatorImpl *m_simulator;
+  Ptr<EventImpl> m_event;
+  uint32_t m_uid;
+  uint16_t m_callback;
+  bool m_destroy;
+};
+
+TypeId
+EventTraceSimulatorImpl::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::EventTraceSimulatorImpl")
+    .SetParent<SimulatorImpl> ()
+    .AddConstructor<EventTraceSimulatorImpl> ()
+    .AddAttribute ("SimulatorImplFactory",
+                   "Factory for the underlying simulator implementation whose events are recorded.",
+                   ObjectFactoryValue (GetDefaultSimulatorImplFactory ()),
+                   MakeObjectFactoryAccessor (&EventTraceSimulatorImpl::m_simulatorImplFactory),
+                   MakeObjectFactoryChecker ())
+    .AddAttribute ("FileName",
+                   "Name of the file the events are recorded to.",
+                   StringValue ("events.trace"),
+                   MakeStringAccessor (&EventTraceSimulatorImpl::m_fileName),
+                   MakeStringChecker ())
+  ;
+  return tid;
+}
+
+EventTraceSimulatorImpl::EventTraceSimulatorImpl ()
+  : m_bufferSize (0)
+  , m_records (0)
+  , m_uid (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+EventTraceSimulatorImpl::~EventTraceSimulatorImpl ()
+{
+  NS_LOG_FUNCTION (this);
+  // Simulator::Destroy releases the simulator without disposing it
+  Close ();
+}
+
+void
+EventTraceSimulatorImpl::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  Close ();
+  if (m_simulator)
+    {
+      m_simulator->Dispose ();
+      m_simulator = 0;
+    }
+  SimulatorImpl::DoDispose ();
+}
+
+void
+EventTraceSimulatorImpl::NotifyConstructionCompleted ()
+{
+  NS_LOG_FUNCTION (this);
+  m_simulator = m_simulatorImplFactory.Create<SimulatorImpl> ();
+
+  m_file.open (m_fileName.c_str (), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!m_file.is_open ())
+    {
+      NS_FATAL_ERROR ("Cannot open the event trace " << m_fileName);
+    }
+  m_buffer.resize (BUFFER_SIZE);
+
+  uint8_t *p = &m_buffer[0];
+  memcpy (p, MAGIC, sizeof (MAGIC));
+  p += sizeof (MAGIC);
+  WriteValue<uint32_t> (p, VERSION);
+  WriteValue<uint32_t> (p, Time::GetResolution ());
+  m_bufferSize = HEADER_SIZE;
+}
+
+uint16_t
+EventTraceSimulatorImpl::GetCallback (const EventImpl *event)
+{
+  // type_info names are unique per class within a shared library, so looking
+  // them up by address is cheap; a class seen from two libraries simply gets
+  // two indices with the same name
+  const char *name = typeid (*event).name ();
+  std::map<const char *, uint16_t>::const_iterator i = m_callbacks.find (name);
+  if (i != m_callbacks.end ())
+    {
+      return i->second;
+    }
+  NS_ASSERT_MSG (m_callbackNames.size () < 0xffff, "Too many classes of events");
+  uint16_t callback = m_callbackNames.size ();
+  m_callbacks[name] = callback;
+  m_callbackNames.push_back (name);
+  return callback;
+}
+
+void
+EventTraceSimulatorImpl::Record (uint8_t type, uint64_t ts, uint32_t uid, uint32_t context, uint16_t callback)
+{
+  if (!m_file.is_open ())
+    {
+      return;
+    }
+  if (m_bufferSize + RECORD_SIZE > BUFFER_SIZE)
+    {
+      Flush ();
+    }
+  uint8_t *p = &m_buffer[m_bufferSize];
+  WriteValue<uint64_t> (p, ts);
+  WriteValue<uint32_t> (p, uid);
+  WriteValue<uint32_t> (p, context);
+  WriteValue<uint16_t> (p, callback);
+  WriteValue<uint8_t> (p, type);
+  WriteValue<uint8_t> (p, 0);
+  m_bufferSize += RECORD_SIZE;
+  m_records++;
+}
+
+void
+EventTraceSimulatorImpl::Flush (void)
+{
+  m_file.write (reinterpret_cast<const char *> (&m_buffer[0]), m_bufferSize);
+  m_bufferSize = 0;
+}
+
+void
+EventTraceSimulatorImpl::Close (void)
+{
+  if (!m_file.is_open ())
+    {
+      return;
+    }
+  NS_LOG_FUNCTION (this << m_records);
+  Flush ();
+  for (std::vector<std::string>::const_iterator i = m_callbackNames.begin (); i != m_callbackNames.end (); i++)
+    {
+      uint32_t length = i->size ();
+      m_file.write (reinterpret_cast<const char *> (&length), sizeof (length));
+      m_file.write (i->data (), length);
+    }
+  uint8_t footer[FOOTER_SIZE];
+  uint8_t *p = footer;
+  WriteValue<uint64_t> (p, m_records);
+  WriteValue<uint32_t> (p, m_callbackNames.size ());
+  WriteValue<uint32_t> (p, VERSION);
+  m_file.write (reinterpret_cast<const char *> (footer), FOOTER_SIZE);
+  m_file.close ();
+  std::vector<uint8_t> ().swap (m_buffer);
+}
+
+EventImpl *
+EventTraceSimulatorImpl::Wrap (EventImpl *event, uint64_t ts, uint32_t context, bool destroy)
+{
+  uint32_t uid = m_uid++;
+  uint16_t callback = GetCallback (event);
+  Record (EventTraceRecord::SCHEDULE | (destroy ? EventTraceRecord::DESTROY : 0),
+          ts, uid, context, callback);
+  return new TraceEvent (this, event, uid, callback, destroy);
+}
+
+void
+EventTraceSimulatorImpl::Destroy ()
+{
+  NS_LOG_FUNCTION (this);
+  m_simulator->Destroy ();
+  Close ();
+}
+
+void
+EventTraceSimulatorImpl::SetScheduler (ObjectFactory schedulerFactory)
+{
+  m_simulator->SetScheduler (schedulerFactory);
+}
+
+uint32_t
+EventTraceSimulatorImpl::GetSystemId (void) const
+{
+  return m_simulator->GetSystemId ();
+}
+
+bool
+EventTraceSimulatorImpl::IsFinished (void) const
+{
+  return m_simulator->IsFinished ();
+}
+
+void
+EventTraceSimulatorImpl::Run (void)
+{
+  m_simulator->Run ();
+}
+
+void
+EventTraceSimulatorImpl::Stop (void)
+{
+  m_simulator->Stop ();
+}
+
+void
+EventTraceSimulatorImpl::Stop (Time const &time)
+{
+  m_simulator->Stop (time);
+}
+
+EventId
+EventTraceSimulatorImpl::Schedule (Time const &time, EventImpl *event)
+{
+  uint64_t ts = m_simulator->Now ().GetTimeStep () + time.GetTimeStep ();
+  return m_simulator->Schedule (time, Wrap (event, ts, m_simulator->GetContext (), false));
+}
+
+void
+EventTraceSimulatorImpl::ScheduleWithContext (uint32_t context, Time const &time, EventImpl *event)
+{
+  uint64_t ts = m_simulator->Now ().GetTimeStep () + time.GetTimeStep ();
+  m_simulator->ScheduleWithContext (context, time, Wrap (event, ts, context, false));
+}
+
+EventId
+EventTraceSimulatorImpl::ScheduleNow (EventImpl *event)
+{
+  uint64_t ts = m_simulator->Now ().GetTimeStep ();
+  return m_simulator->ScheduleNow (Wrap (event, ts, m_simulator->GetContext (), false));
+}
+
+EventId
+EventTraceSimulatorImpl::ScheduleDestroy (EventImpl *event)
+{
+  uint64_t ts = m_simulator->Now ().GetTimeStep ();
+  return m_simulator->ScheduleDestroy (Wrap (event, ts, m_simulator->GetContext (), true));
+}
+
+Time
+EventTraceSimulatorImpl::Now (void) const
+{
+  return m_simulator->Now ();
+}
+
+Time
+EventTraceSimulatorImpl::GetDelayLeft (const EventId &id) const
+{
+  return m_simulator->GetDelayLeft (id);
+}
+
+void
+EventTraceSimulatorImpl::Remove (const EventId &id)
+{
+  if (!m_simulator->IsExpired (id))
+    {
+      const TraceEvent *event = static_cast<const TraceEvent *> (id.PeekEventImpl ());
+      Record (EventTraceRecord::REMOVE | (event->IsDestroy () ? EventTraceRecord::DESTROY : 0),
+              id.GetTs (), event->GetUid (), id.GetContext (), event->GetCallback ());
+    }
+  m_simulator->Remove (id);
+}
+
+void
+EventTraceSimulatorImpl::Cancel (const EventId &id)
+{
+  if (!m_simulator->IsExpired (id))
+    {
+      const TraceEvent *event = static_cast<const TraceEvent *> (id.PeekEventImpl ());
+      Record (EventTraceRecord::CANCEL | (event->IsDestroy () ? EventTraceRecord::DESTROY : 0),
+              id.GetTs (), event->GetUid (), id.GetContext (), event->GetCallback ());
+    }
+  m_simulator->Cancel (id);
+}
+
+bool
+EventTraceSimulatorImpl::IsExpired (const EventId &ev) const
+{
+  return m_simulator->IsExpired (ev);
+}
+
+Time
+EventTraceSimulatorImpl::GetMaximumSimulationTime (void) const
+{
+  return m_simulator->GetMaximumSimulationTime ();
+}
+
+uint32_t
+EventTraceSimulatorImpl::GetContext (void) const
+{
+  return m_simulator->GetContext ();
+}
+
+
+EventTraceReader::EventTraceReader ()
+  : m_records (0)
+  , m_read (0)
+  , m_resolution (Time::NS)
+{
+}
+
+bool
+EventTraceReader::Open (std::string fileName)
+{
+  NS_LOG_FUNCTION (this << fileName);
+  m_file.close ();
+  m_file.clear ();
+  m_callbackNames.clear ();
+  m_records = 0;
+  m_read = 0;
+
+  m_file.open (fileName.c_str (), std::ios::in | std::ios::binary);
+  if (!m_file.is_open ())
+    {
+      NS_LOG_WARN ("Cannot open " << fileName);
+      return false;
+    }
+
+  uint8_t header[HEADER_SIZE];
+  uint8_t footer[FOOTER_SIZE];
+  m_file.seekg (0, std::ios::end);
+  uint64_t size = m_file.tellg ();
+  m_file.seekg (0, std::ios::beg);
+  if (size < HEADER_SIZE + FOOTER_SIZE
+      || !m_file.read (reinterpret_cast<char *> (header), HEADER_SIZE)
+      || memcmp (header, MAGIC, sizeof (MAGIC)) != 0)
+    {
+      NS_LOG_WARN (fileName << " is not an event trace");
+      return false;
+    }
+  const uint8_t *p = header + sizeof (MAGIC);
+  uint32_t version = ReadValue<uint32_t> (p);
+  uint32_t resolution = ReadValue<uint32_t> (p);
+
+  m_file.seekg (size - FOOTER_SIZE, std::ios::beg);
+  if (!m_file.read (reinterpret_cast<char *> (footer), FOOTER_SIZE))
+    {
+      return false;
+    }
+  p = footer;
+  uint64_t records = ReadValue<uint64_t> (p);
+  uint32_t callbacks = ReadValue<uint32_t> (p);
+  if (version != VERSION || ReadValue<uint32_t> (p) != VERSION
+      || resolution >= Time::LAST
+      || HEADER_SIZE + records * RECORD_SIZE + FOOTER_SIZE > size)
+    {
+      NS_LOG_WARN (fileName << " is not a complete event trace, or of another version");
+      return false;
+    }
+
+  m_file.seekg (HEADER_SIZE + records * RECORD_SIZE, std::ios::beg);
+  for (uint32_t i = 0; i < callbacks; i++)
+    {
+      uint32_t length;
+      if (!m_file.read (reinterpret_cast<char *> (&length), sizeof (length))
+          || length > size)
+        {
+          return false;
+        }
+      std::string name (length, '\0');
+      if (!m_file.read (&name[0], length))
+        {
+          return false;
+        }
+#if (__GNUC__ >= 3)
+      int status;
+      char *demangled = abi::__cxa_demangle (name.c_str (), 0, 0, &status);
+      if (status == 0)
+        {
+          name = demangled;
+        }
+      std::free (demangled);
+#endif
+      m_callbackNames.push_back (name);
+    }
+  if (static_cast<uint64_t> (m_file.tellg ()) != size - FOOTER_SIZE)
+    {
+      NS_LOG_WARN (fileName << " is not a complete event trace");
+      m_callbackNames.clear ();
+      return false;
+    }
+
+  m_file.seekg (HEADER_SIZE, std::ios::beg);
+  m_records = records;
+  m_resolution = static_cast<Time::Unit> (resolution);
+  return true;
+}
+
+bool
+EventTraceReader::Read (EventTraceRecord &record)
+{
+  uint8_t buffer[RECORD_SIZE];
+  if (m_read == m_records
+      || !m_file.read (reinterpret_cast<char *> (buffer), RECORD_SIZE))
+    {
+      return false;
+    }
+  m_read++;
+  const uint8_t *p = buffer;
+  record.ts = ReadValue<uint64_t> (p);
+  record.uid = ReadValue<uint32_t> (p);
+  record.context = ReadValue<uint32_t> (p);
+  record.callback = ReadValue<uint16_t> (p);
+  record.type = ReadValue<uint8_t> (p);
+  return true;
+}
+
+uint64_t
+EventTraceReader::GetRecordCount (void) const
+{
+  return m_records;
+}
+
+Time::Unit
+EventTraceReader::GetResolution (void) const
+{
+  return m_resolution;
+}
+
+uint32_t
+EventTraceReader::GetCallbackCount (void) const
+{
+  return m_callbackNames.size ();
+}
+
+std::string
+EventTraceReader::GetCallbackName (uint16_t callback) const
+{
+  NS_ASSERT (callback < m_callbackNames.size ());
+  return m_callbackNames[callback];
+}
+
+} // namespace ns3
@@ -0,0 +1,233 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef EVENT_TRACE_SIMULATOR_IMPL_H
+#define EVENT_TRACE_SIMULATOR_IMPL_H
+
+#include "simulator-impl.h"
+#include "event-impl.h"
+#include "nstime.h"
+#include "ptr.h"
+
+#include <stdint.h>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup simulator
+ *
+ * \brief An entry of an event trace
+ *
+ * See EventTraceSimulatorImpl.
+ */
+struct EventTraceRecord
+{
+  /**
+   * \brief Kind of the entry
+   */
+  enum Type
+  {
+    SCHEDULE = 0, //!< The event was scheduled, ts is the time at which it expires
+    REMOVE = 1,   //!< The event was removed (Simulator::Remove)
+    CANCEL = 2,   //!< The event was cancelled (Simulator::Cancel), it stays scheduled
+    INVOKE = 3,   //!< The event expired and was invoked
+    DESTROY = 0x80 //!< Flag of the entries of the events scheduled with Simulator::ScheduleDestroy
+  };
+
+  uint64_t ts;       //!< Time of the event, in time steps
+  uint32_t uid;      //!< Unique id of the event in the trace, in scheduling order
+  uint32_t context;  //!< Context of the event
+  uint16_t callback; //!< Index of the class of the event, see EventTraceReader::GetCallbackName
+  uint8_t type;      //!< Type, possibly with the DESTROY flag
+};
+
+/**
+ * \ingroup simulator
+ *
+ * \brief A replacement simulator recording the events of the wrapped simulator
+ *
+ * Every event scheduled, removed, cancelled and invoked in the wrapped simulator
+ * implementation (DefaultSimulatorImpl by default, see the SimulatorImplFactory
+ * attribute) is written to a compact binary file (attribute FileName), so that
+ * the event stream of a real scenario can be replayed later against any
+ * Scheduler without the models, see utils/replay-event-trace.cc.  To use this
+ * class, run any ns-3 simulation with the command-line arguments
+ *
+ * \code
+ *   --SimulatorImplementationType=ns3::EventTraceSimulatorImpl
+ *   --ns3::EventTraceSimulatorImpl::FileName=events.trace
+ * \endcode
+ *
+ * The entries of the trace are EventTraceRecord, whose ts and uid fields
+ * are the key of the event in the Scheduler of the wrapped simulator (up to
+ * a constant offset of the uid), and whose callback field identifies the C++
+ * class of the EventImpl, e.g. the method called by the event.  The trace is
+ * complete once Simulator::Destroy has been called; it is read with
+ * EventTraceReader.
+ *
+ * The events are recorded by wrapping each EventImpl in another one, and the
+ * entries are buffered in memory and written in large blocks, so that the cost
+ * of the recording is an allocation and a few stores per event.  The recording
+ * is not thread-safe: the wrapped simulator must invoke the events from a
+ * single thread.
+ */
+class EventTraceSimulatorImpl : public SimulatorImpl
+{
+public:
+  static TypeId GetTypeId (void);
+
+  EventTraceSimulatorImpl ();
+  ~EventTraceSimulatorImpl ();
+
+  virtual void Destroy ();
+  virtual bool IsFinished (void) const;
+  virtual void Stop (void);
+  virtual void Stop (Time const &time);
+  virtual EventId Schedule (Time const &time, EventImpl *event);
+  virtual void ScheduleWithContext (uint32_t context, Time const &time, EventImpl *event);
+  virtual EventId ScheduleNow (EventImpl *event);
+  virtual EventId ScheduleDestroy (EventImpl *event);
+  virtual void Remove (const EventId &ev);
+  virtual void Cancel (const EventId &ev);
+  virtual bool IsExpired (const EventId &ev) const;
+  virtual void Run (void);
+  virtual Time Now (void) const;
+  virtual Time GetDelayLeft (const EventId &id) const;
+  virtual Time GetMaximumSimulationTime (void) const;
+  virtual void SetScheduler (ObjectFactory schedulerFactory);
+  virtual uint32_t GetSystemId (void) const;
+  virtual uint32_t GetContext (void) const;
+
+protected:
+  void DoDispose ();
+  void NotifyConstructionCompleted (void);
+
+private:
+  class TraceEvent;
+
+  /**
+   * \brief Wrap an event scheduled in the wrapped simulator, recording its scheduling
+   * \param event the event
+   * \param ts the time at which the event expires
+   * \param context the context of the event
+   * \param destroy whether the event is scheduled with ScheduleDestroy
+   * \returns the wrapping event, which owns the reference of event
+   */
+  EventImpl *Wrap (EventImpl *event, uint64_t ts, uint32_t context, bool destroy);
+  /**
+   * \param event an event
+   * \returns the index of the class of the event in the trace
+   */
+  uint16_t GetCallback (const EventImpl *event);
+  /**
+   * \brief Append an entry to the trace
+   */
+  void Record (uint8_t type, uint64_t ts, uint32_t uid, uint32_t context, uint16_t callback);
+  /**
+   * \brief Write the buffered entries to the file
+   */
+  void Flush (void);
+  /**
+   * \brief Write the buffered entries and the table of the callbacks, and close the file
+   */
+  void Close (void);
+
+  Ptr<SimulatorImpl> m_simulator;
+  ObjectFactory m_simulatorImplFactory;
+  std::string m_fileName;
+
+  std::ofstream m_file;
+  std::vector<uint8_t> m_buffer; //!< Entries not written yet
+  uint32_t m_bufferSize;         //!< Number of bytes used in m_buffer
+  uint64_t m_records;            //!< Number of entries recorded
+  uint32_t m_uid;                //!< Uid of the next scheduled event
+
+  std::map<const char *, uint16_t> m_callbacks; //!< Index of the classes of events, by type_info name
+  std::vector<std::string> m_callbackNames;     //!< Type_info name of the classes of events, by index
+};
+
+/**
+ * \ingroup simulator
+ *
+ * \brief Reader of the traces written by EventTraceSimulatorImpl
+ *
+ * \code
+ *   EventTraceReader reader;
+ *   if (reader.Open ("events.trace"))
+ *     {
+ *       EventTraceRecord record;
+ *       while (reader.Read (record))
+ *         {
+ *           ...
+ *         }
+ *     }
+ * \endcode
+ */
+class EventTraceReader
+{
+public:
+  EventTraceReader ();
+
+  /**
+   * \brief Open a trace
+   * \param fileName the name of the trace
+   * \returns false if the file is not a complete event trace
+   */
+  bool Open (std::string fileName);
+  /**
+   * \brief Read the next entry of the trace
+   * \param record the entry read
+   * \returns false at the end of the trace
+   */
+  bool Read (EventTraceRecord &record);
+
+  /**
+   * \returns the number of entries of the trace
+   */
+  uint64_t GetRecordCount (void) const;
+  /**
+   * \returns the resolution of Time in the traced simulation, the unit of EventTraceRecord::ts
+   */
+  Time::Unit GetResolution (void) const;
+  /**
+   * \returns the number of classes of events of the trace
+   */
+  uint32_t GetCallbackCount (void) const;
+  /**
+   * \param callback the index of a class of events, EventTraceRecord::callback
+   * \returns the demangled name of the class
+   */
+  std::string GetCallbackName (uint16_t callback) const;
+
+private:
+  std::ifstream m_file;
+  uint64_t m_records;
+  uint64_t m_read;
+  Time::Unit m_resolution;
+  std::vector<std::string> m_callbackNames;
+};
+
+} // namespace ns3
+
+#endif /* EVENT_TRACE_SIMULATOR_IMPL_H */
@@ -0,0 +1,293 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "hierarchical-wheel-scheduler.h"
+#include "event-impl.h"
+#include "assert.h"
+#include "log.h"
+#include <algorithm>
+#include <string.h>
+
+NS_LOG_COMPONENT_DEFINE ("HierarchicalWheelScheduler");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (HierarchicalWheelScheduler);
+
+namespace {
+
+/* heap comparator: the earliest event ends up at the top of the heap */
+inline bool
+IsLater (const Scheduler::Event &a, const Scheduler::Event &b)
+{
+  return a.key > b.key;
+}
+
+inline uint32_t
+LowestBit (uint64_t word)
+{
+#ifdef __GNUC__
+  return __builtin_ctzll (word);
+#else
+  uint32_t bit = 0;
+  while ((word & 1) == 0)
+    {
+      word >>= 1;
+      bit++;
+    }
+  return bit;
+#endif
+}
+
+} // anonymous namespace
+
+TypeId
+HierarchicalWheelScheduler::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::HierarchicalWheelScheduler")
+    .SetParent<Scheduler> ()
+    .AddConstructor<HierarchicalWheelScheduler> ()
+  ;
+  return tid;
+}
+
+HierarchicalWheelScheduler::HierarchicalWheelScheduler ()
+  : m_current (0),
+    m_size (0)
+{
+  NS_LOG_FUNCTION (this);
+  memset (m_occupied, 0, sizeof (m_occupied));
+  memset (m_levelSize, 0, sizeof (m_levelSize));
+}
+HierarchicalWheelScheduler::~HierarchicalWheelScheduler ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+uint32_t
+HierarchicalWheelScheduler::GetLevel (uint64_t ts) const
+{
+  uint64_t diff = ts ^ m_current;
+  uint32_t level = 0;
+  while (level < N_LEVELS && (diff >> (BITS_PER_LEVEL * (level + 1))) != 0)
+    {
+      level++;
+    }
+  return level;
+}
+
+uint32_t
+HierarchicalWheelScheduler::FindSlot (uint32_t level, uint32_t from) const
+{
+  for (uint32_t word = from / 64; word < WORDS_PER_LEVEL; word++)
+    {
+      uint64_t bits = m_occupied[level][word];
+      if (word == from / 64)
+        {
+          bits &= ~static_cast<uint64_t> (0) << (from % 64);
+        }
+      if (bits != 0)
+        {
+          return word * 64 + LowestBit (bits);
+        }
+    }
+  return SLOTS_PER_LEVEL;
+}
+
+void
+HierarchicalWheelScheduler::Place (const Event &ev)
+{
+  uint64_t ts = ev.key.m_ts;
+  if (ts <= m_current)
+    {
+      m_due.push_back (ev);
+      std::push_heap (m_due.begin (), m_due.end (), IsLater);
+      return;
+    }
+
+  uint32_t level = GetLevel (ts);
+  if (level == N_LEVELS)
+    {
+      m_overflow.insert (std::make_pair (ev.key, ev.impl));
+      return;
+    }
+
+  uint32_t slot = (ts >> (BITS_PER_LEVEL * level)) & SLOT_MASK;
+  m_slots[level][slot].push_back (ev);
+  m_occupied[level][slot / 64] |= static_cast<uint64_t> (1) << (slot % 64);
+  m_levelSize[level]++;
+}
+
+void
+HierarchicalWheelScheduler::Advance (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (m_size > 0);
+
+  while (m_due.empty ())
+    {
+      // All events of a level are later than events of any lower level, and they
+      // always occupy slots after the current digit of this level
+      uint32_t level = 0;
+      while (level < N_LEVELS && m_levelSize[level] == 0)
+        {
+          level++;
+        }
+
+      if (level == N_LEVELS)
+        {
+          // wheels are empty, move to the earliest event of the overflow map and
+          // take all events sharing the most significant digits with it
+          NS_ASSERT (!m_overflow.empty ());
+          m_current = m_overflow.begin ()->first.m_ts;
+          uint64_t high = m_current >> (BITS_PER_LEVEL * N_LEVELS);
+          while (!m_overflow.empty ()
+                 && (m_overflow.begin ()->first.m_ts >> (BITS_PER_LEVEL * N_LEVELS)) == high)
+            {
+              Event ev;
+              ev.key = m_overflow.begin ()->first;
+              ev.impl = m_overflow.begin ()->second;
+              m_overflow.erase (m_overflow.begin ());
+              Place (ev);
+            }
+          continue;
+        }
+
+      uint32_t shift = BITS_PER_LEVEL * level;
+      uint32_t slot = FindSlot (level, ((m_current >> shift) & SLOT_MASK) + 1);
+      NS_ASSERT (slot < SLOTS_PER_LEVEL);
+
+      // move to the beginning of the slot and redistribute its events in lower levels
+      uint64_t span = static_cast<uint64_t> (1) << (shift + BITS_PER_LEVEL);
+      m_current = (m_current & ~(span - 1)) | (static_cast<uint64_t> (slot) << shift);
+
+      Bucket bucket;
+      bucket.swap (m_slots[level][slot]);
+      m_occupied[level][slot / 64] &= ~(static_cast<uint64_t> (1) << (slot % 64));
+      m_levelSize[level] -= bucket.size ();
+      for (Bucket::const_iterator i = bucket.begin (); i != bucket.end (); i++)
+        {
+          Place (*i);
+        }
+      // give the storage back to the slot to avoid reallocations later
+      bucket.clear ();
+      m_slots[level][slot].swap (bucket);
+    }
+}
+
+void
+HierarchicalWheelScheduler::Insert (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  Place (ev);
+  m_size++;
+}
+
+bool
+HierarchicalWheelScheduler::IsEmpty (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_size == 0;
+}
+
+Scheduler::Event
+HierarchicalWheelScheduler::PeekNext (void) const
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+  if (m_due.empty ())
+    {
+      // advancing the wheel does not change the set of stored events
+      const_cast<HierarchicalWheelScheduler *> (this)->Advance ();
+    }
+  return m_due.front ();
+}
+
+Scheduler::Event
+HierarchicalWheelScheduler::RemoveNext (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT (!IsEmpty ());
+  if (m_due.empty ())
+    {
+      Advance ();
+    }
+  std::pop_heap (m_due.begin (), m_due.end (), IsLater);
+  Event ev = m_due.back ();
+  m_due.pop_back ();
+  m_size--;
+  NS_LOG_DEBUG (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  return ev;
+}
+
+void
+HierarchicalWheelScheduler::Remove (const Event &ev)
+{
+  NS_LOG_FUNCTION (this << ev.impl << ev.key.m_ts << ev.key.m_uid);
+  NS_ASSERT (!IsEmpty ());
+  uint64_t ts = ev.key.m_ts;
+
+  Bucket *bucket;
+  uint32_t level = 0;
+  uint32_t slot = 0;
+  if (ts <= m_current)
+    {
+      bucket = &m_due;
+    }
+  else
+    {
+      level = GetLevel (ts);
+      if (level == N_LEVELS)
+        {
+          Overflow::iterator i = m_overflow.find (ev.key);
+          NS_ASSERT (i != m_overflow.end () && i->second == ev.impl);
+          m_overflow.erase (i);
+          m_size--;
+          return;
+        }
+      slot = (ts >> (BITS_PER_LEVEL * level)) & SLOT_MASK;
+      bucket = &m_slots[level][slot];
+    }
+
+  Bucket::iterator i = bucket->begin ();
+  while (i != bucket->end () && i->key.m_uid != ev.key.m_uid)
+    {
+      i++;
+    }
+  NS_ASSERT (i != bucket->end () && i->impl == ev.impl);
+  *i = bucket->back ();
+  bucket->pop_back ();
+  m_size--;
+
+  if (bucket == &m_due)
+    {
+      std::make_heap (m_due.begin (), m_due.end (), IsLater);
+    }
+  else
+    {
+      m_levelSize[level]--;
+      if (bucket->empty ())
+        {
+          m_occupied[level][slot / 64] &= ~(static_cast<uint64_t> (1) << (slot % 64));
+        }
+    }
+}
+
+} // namespace ns3
@@ -139,6 +139,17 @@ public:
   virtual bool Get (const ObjectBase * object, AttributeValue &value) const;
   virtual bool HasGetter (void) const;
   virtual bool HasSetter (void) const;
+  /**
+   * \param object the object holding the container
+   * \param index the index of the requested object in the container
+   * \returns the requested object, or 0 if the container holds no object
+   *          with this index
+   *
+   * Unlike Get, this method does not read the whole container when the
+   * object at position index has this index, which is the case of the
+   * containers built with MakeObjectPtrContainerAccessor.
+   */
+  Ptr<Object> GetItem (const ObjectBase *object, uint32_t index) const;
 private:
   virtual bool DoGetN (const ObjectBase *object, uint32_t *n) const = 0;
   virtual Ptr<Object> DoGet (const ObjectBase *object, uint32_t i, uint32_t *index) const = 0;
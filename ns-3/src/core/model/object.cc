@@ -93,10 +93,10 @@ Object::Object ()
   : m_tid (Object::GetTypeId ()),
     m_disposed (false),
     m_initialized (false),
-    m_aggregates ((struct Aggregates *) std::malloc (sizeof (struct Aggregates))),
-    m_getObjectCount (0)
+    m_aggregates ((struct Aggregates *) std::malloc (sizeof (struct Aggregates)))
 {
   NS_LOG_FUNCTION (this);
+  m_aggregates->cache = 0;
   m_aggregates->n = 1;
   m_aggregates->buffer[0] = this;
 }
@@ -116,6 +116,8 @@ Object::~Object ()
           m_aggregates->n--;
         }
     }
+  // the cache may point to this object
+  ClearCache (m_aggregates);
   // finally, if all objects have been removed from the list,
   // delete the aggregate list
   if (m_aggregates->n == 0)
@@ -128,9 +130,9 @@ Object::Object (const Object &o)
   : m_tid (o.m_tid),
     m_disposed (false),
     m_initialized (false),
-    m_aggregates ((struct Aggregates *) std::malloc (sizeof (struct Aggregates))),
-    m_getObjectCount (0)
+    m_aggregates ((struct Aggregates *) std::malloc (sizeof (struct Aggregates)))
 {
+  m_aggregates->cache = 0;
   m_aggregates->n = 1;
   m_aggregates->buffer[0] = this;
 }
@@ -141,7 +143,7 @@ Object::Construct (const AttributeConstructionList &attributes)
   ConstructSelf (attributes);
 }
 
-Ptr<Object>
+Object *
 Object::DoGetObject (TypeId tid) const
 {
   NS_LOG_FUNCTION (this << tid);
@@ -159,30 +161,37 @@ Object::DoGetObject (TypeId tid) const
         }
       if (cur == tid)
         {
-          // This is an attempt to 'cache' the result of this lookup.
-          // the idea is that if we perform a lookup for a TypeId on this object,
-          // we are likely to perform the same lookup later so, we make sure
-          // that the aggregate array is sorted by the number of accesses
-          // to each object.
-
-          // first, increment the access count
-          current->m_getObjectCount++;
-          // then, update the sort
-          UpdateSortedArray (m_aggregates, i);
-          // finally, return the match
-          return const_cast<Object *> (current);
+          // we are likely to perform the same lookup later, so remember
+          // its result, replacing the oldest entry of the cache
+          struct Cache *cache = m_aggregates->cache;
+          if (cache == 0)
+            {
+              cache = new struct Cache;
+              cache->next = 0;
+              m_aggregates->cache = cache;
+            }
+          cache->tid[cache->next] = tid;
+          cache->object[cache->next] = current;
+          cache->next = (cache->next + 1) % Cache::SIZE;
+          return current;
         }
     }
   return 0;
 }
 void
+Object::ClearCache (struct Aggregates *aggregates)
+{
+  NS_LOG_FUNCTION (aggregates);
+  delete aggregates->cache;
+  aggregates->cache = 0;
+}
+void
 Object::Initialize (void)
 {
   /**
    * Note: the code here is a bit tricky because we need to protect ourselves from
    * modifications in the aggregate array while DoInitialize is called. The user's
-   * implementation of the DoInitialize method could call GetObject (which could
-   * reorder the array) and it could call AggregateObject which would add an 
+   * implementation of the DoInitialize method could call AggregateObject which would add an 
    * object at the end of the array. To be safe, we restart iteration over the 
    * array whenever we call some user code, just in case.
    */
@@ -206,8 +215,8 @@ Object::Dispose (void)
   /**
    * Note: the code here is a bit tricky because we need to protect ourselves from
    * modifications in the aggregate array while DoDispose is called. The user's
-   * DoDispose implementation could call GetObject (which could reorder the array) 
-   * and it could call AggregateObject which would add an object at the end of the array.
+   * DoDispose implementation could call AggregateObject which would add an object
+   * at the end of the array.
    * So, to be safe, we restart the iteration over the array whenever we call some
    * user code.
    */
@@ -225,19 +234,6 @@ restart:
         }
     }
 }
-void
-Object::UpdateSortedArray (struct Aggregates *aggregates, uint32_t j) const
-{
-  NS_LOG_FUNCTION (this << aggregates << j);
-  while (j > 0 && 
-         aggregates->buffer[j]->m_getObjectCount > aggregates->buffer[j-1]->m_getObjectCount)
-    {
-      Object *tmp = aggregates->buffer[j-1];
-      aggregates->buffer[j-1] = aggregates->buffer[j];
-      aggregates->buffer[j] = tmp;
-      j--;
-    }
-}
 void 
 Object::AggregateObject (Ptr<Object> o)
 {
@@ -259,6 +255,7 @@ Object::AggregateObject (Ptr<Object> o)
   uint32_t total = m_aggregates->n + other->m_aggregates->n;
   struct Aggregates *aggregates = 
     (struct Aggregates *)std::malloc (sizeof(struct Aggregates)+(total-1)*sizeof(Object*));
+  aggregates->cache = 0;
   aggregates->n = total;
 
   // copy our buffer to the new buffer
@@ -267,11 +264,9 @@ Object::AggregateObject (Ptr<Object> o)
           m_aggregates->n*sizeof(Object*));
 
   // append the other buffer into the new buffer too
-  for (uint32_t i = 0; i < other->m_aggregates->n; i++)
-    {
-      aggregates->buffer[m_aggregates->n+i] = other->m_aggregates->buffer[i];
-      UpdateSortedArray (aggregates, m_aggregates->n + i);
-    }
+  std::memcpy (&aggregates->buffer[m_aggregates->n], 
+          &other->m_aggregates->buffer[0], 
+          other->m_aggregates->n*sizeof(Object*));
 
   // keep track of the old aggregate buffers for the iteration
   // of NotifyNewAggregates
@@ -303,6 +298,8 @@ Object::AggregateObject (Ptr<Object> o)
     }
 
   // Now that we are done with them, we can free our old aggregate buffers
+  ClearCache (a);
+  ClearCache (b);
   std::free (a);
   std::free (b);
 }
@@ -329,6 +326,7 @@ Object::SetTypeId (TypeId tid)
   NS_LOG_FUNCTION (this << tid);
   NS_ASSERT (Check ());
   m_tid = tid;
+  ClearCache (m_aggregates);
 }
 
 void
@@ -231,6 +231,20 @@ private:
   friend class AggregateIterator;
   friend struct ObjectDeleter;
 
+  /**
+   * The objects found by the last lookups of the aggregates by TypeId.
+   *
+   * The cache belongs to struct Aggregates: it is allocated by the first
+   * lookup which scans the aggregates, and dropped whenever the set of
+   * aggregated objects changes, so its entries never need to be checked.
+   */
+  struct Cache {
+    enum { SIZE = 8 };
+    TypeId tid[SIZE];      //!< TypeIds looked up, TypeId () if unused
+    Object *object[SIZE];  //!< object found for each TypeId
+    uint32_t next;         //!< entry replaced by the next lookup
+  };
+
   /**
    * This data structure uses a classic C-style trick to 
    * hold an array of variable size without performing
@@ -242,6 +256,7 @@ private:
    * 'n'
    */
   struct Aggregates {
+    struct Cache *cache;
     uint32_t n;
     Object *buffer[1];
   };
@@ -252,7 +267,20 @@ private:
    * \param tid the TypeId we're looking for
    * \return the matching Object, if it is found
    */
-  Ptr<Object> DoGetObject (TypeId tid) const;
+  Object *DoGetObject (TypeId tid) const;
+  /**
+   * Find an object of TypeId tid in the cache of the aggregates.
+   *
+   * \param tid the TypeId we're looking for
+   * \return the matching Object, or 0 if tid was not looked up recently
+   */
+  inline Object *LookupCache (TypeId tid) const;
+  /**
+   * Drop the cache of a list of aggregates
+   *
+   * \param aggregates the list of aggregated objects
+   */
+  static void ClearCache (struct Aggregates *aggregates);
   /**
    * \return is reference count non zero
    */
@@ -286,13 +314,6 @@ private:
   */
   void Construct (const AttributeConstructionList &attributes);
 
-  /**
-   * Keep the list of aggregates in most-recently-used order
-   *
-   * \param aggregates the list of aggregated objects
-   * \param i the most recently used entry in the list
-   */
-  void UpdateSortedArray (struct Aggregates *aggregates, uint32_t i) const;
   /**
    * Attempt to delete this object. This method iterates
    * over all aggregated objects to check if they all 
@@ -322,13 +343,6 @@ private:
    * so the size of the array is indirectly a reference count.
    */
   struct Aggregates * m_aggregates;
-  /**
-   * Indicates the number of times the object was accessed with a
-   * call to GetObject. This integer is used to implement a
-   * heuristic to sort the array of aggregates to put at the start
-   * of the array the most-frequently accessed elements.
-   */
-  uint32_t m_getObjectCount;
 };
 
 /**
@@ -357,34 +371,56 @@ ObjectDeleter::Delete (Object *object)
  *   The Object implementation which depends on templates
  *************************************************************************/
 
+Object *
+Object::LookupCache (TypeId tid) const
+{
+  const struct Cache *cache = m_aggregates->cache;
+  if (cache != 0)
+    {
+      for (uint32_t i = 0; i < Cache::SIZE; i++)
+        {
+          if (cache->tid[i] == tid)
+            {
+              return cache->object[i];
+            }
+        }
+    }
+  return 0;
+}
+
 template <typename T>
 Ptr<T> 
 Object::GetObject () const
 {
-  // This is an optimization: if the cast works (which is likely),
-  // things will be pretty fast.
-  T *result = dynamic_cast<T *> (m_aggregates->buffer[0]);
-  if (result != 0)
+  // This is an optimization: the same objects are looked up again and
+  // again, and the cache avoids the full type check of the aggregates.
+  TypeId tid = T::GetTypeId ();
+  Object *found = LookupCache (tid);
+  if (found == 0)
     {
-      return Ptr<T> (result);
+      found = DoGetObject (tid);
     }
-  // if the cast does not work, we try to do a full type check.
-  Ptr<Object> found = DoGetObject (T::GetTypeId ());
   if (found != 0)
     {
-      return Ptr<T> (static_cast<T *> (PeekPointer (found)));
+      return Ptr<T> (static_cast<T *> (found));
     }
-  return 0;
+  // an object which derives from T in C++ without its TypeId being a child
+  // of the TypeId of T
+  return Ptr<T> (dynamic_cast<T *> (m_aggregates->buffer[0]));
 }
 
 template <typename T>
 Ptr<T> 
 Object::GetObject (TypeId tid) const
 {
-  Ptr<Object> found = DoGetObject (tid);
+  Object *found = LookupCache (tid);
+  if (found == 0)
+    {
+      found = DoGetObject (tid);
+    }
   if (found != 0)
     {
-      return Ptr<T> (static_cast<T *> (PeekPointer (found)));
+      return Ptr<T> (static_cast<T *> (found));
     }
   return 0;
 }
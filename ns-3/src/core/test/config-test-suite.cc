@@ -720,6 +720,101 @@ SearchAttributesOfParentObjectsTestCase::DoRun (void)
 
 }
 
+// ===========================================================================
+// Test for the compiled paths and for the bulk trace connections.
+// ===========================================================================
+class CompiledPathConfigTestCase : public TestCase
+{
+public:
+  CompiledPathConfigTestCase ();
+  virtual ~CompiledPathConfigTestCase () {}
+
+  void Trace (int16_t oldValue, int16_t newValue) { m_count++; }
+  void TraceWithPath (std::string path, int16_t old, int16_t newValue) { m_count++; m_path = path; }
+
+private:
+  virtual void DoRun (void);
+
+  uint32_t m_count;
+  std::string m_path;
+};
+
+CompiledPathConfigTestCase::CompiledPathConfigTestCase ()
+  : TestCase ("Check ability to set and trace connect with compiled paths and Config::ConnectAll")
+{
+}
+
+void
+CompiledPathConfigTestCase::DoRun (void)
+{
+  IntegerValue iv;
+
+  //
+  // Create a root namespace object with four objects in its NodesB vector,
+  // under /NodeA.
+  //
+  Ptr<ConfigTestObject> root = CreateObject<ConfigTestObject> ();
+  Config::RegisterRootNamespaceObject (root);
+  Ptr<ConfigTestObject> a = CreateObject<ConfigTestObject> ();
+  root->SetNodeA (a);
+  std::vector<Ptr<ConfigTestObject> > objects;
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      objects.push_back (CreateObject<ConfigTestObject> ());
+      a->AddNodeB (objects[i]);
+    }
+
+  //
+  // A plain index matches only the object with this index, and a missing index
+  // matches nothing.
+  //
+  Config::CompiledPath path ("/NodeA/NodesB/2/A");
+  NS_TEST_ASSERT_MSG_EQ (path.GetPath (), "/NodeA/NodesB/2/A", "Path not kept as given");
+  NS_TEST_ASSERT_MSG_EQ (path.LookupMatches ().GetN (), 1U, "Index 2 should match one object");
+  NS_TEST_ASSERT_MSG_EQ (path.LookupMatches ().GetMatchedPath (0), "/NodeA/NodesB/2/", "Unexpected matched path");
+  NS_TEST_ASSERT_MSG_EQ (Config::CompiledPath ("/NodeA/NodesB/7/A").LookupMatches ().GetN (), 0U,
+                         "Index 7 should not match any object");
+  path.Set (IntegerValue (3));
+  objects[2]->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), 3, "Object Attribute \"A\" not set as expected");
+  objects[1]->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), 10, "Object Attribute \"A\" unexpectedly set");
+
+  //
+  // A compiled path can be used many times, and gives the same contexts as
+  // Config::Connect.
+  //
+  Config::CompiledPath wildcard ("/NodeA/NodesB/*/Source");
+  wildcard.Connect (MakeCallback (&CompiledPathConfigTestCase::TraceWithPath, this));
+  m_count = 0;
+  objects[3]->SetAttribute ("Source", IntegerValue (-4));
+  NS_TEST_ASSERT_MSG_EQ (m_count, 1U, "Trace 3 did not fire as expected");
+  NS_TEST_ASSERT_MSG_EQ (m_path, "/NodeA/NodesB/3/Source", "Trace 3 did not provide expected context");
+  wildcard.Disconnect (MakeCallback (&CompiledPathConfigTestCase::TraceWithPath, this));
+  m_count = 0;
+  objects[3]->SetAttribute ("Source", IntegerValue (-5));
+  NS_TEST_ASSERT_MSG_EQ (m_count, 0U, "Trace 3 fired after disconnection");
+
+  //
+  // Connect several paths at once, skipping the object with index 2.
+  //
+  std::vector<std::string> paths;
+  std::vector<CallbackBase> cbs;
+  paths.push_back ("/NodeA/NodesB/0/Source");
+  cbs.push_back (MakeCallback (&CompiledPathConfigTestCase::Trace, this));
+  paths.push_back ("/NodeA/NodesB/1|3/Source");
+  cbs.push_back (MakeCallback (&CompiledPathConfigTestCase::Trace, this));
+  Config::ConnectAllWithoutContext (paths, cbs);
+  m_count = 0;
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      objects[i]->SetAttribute ("Source", IntegerValue (i));
+    }
+  NS_TEST_ASSERT_MSG_EQ (m_count, 3U, "Traces 0, 1 and 3 did not fire as expected");
+
+  Config::UnregisterRootNamespaceObject (root);
+}
+
 // ===========================================================================
 // The Test Suite that glues all of the Test Cases together.
 // ===========================================================================
@@ -736,6 +831,7 @@ ConfigTestSuite::ConfigTestSuite ()
   AddTestCase (new UnderRootNamespaceConfigTestCase, TestCase::QUICK);
   AddTestCase (new ObjectVectorConfigTestCase, TestCase::QUICK);
   AddTestCase (new SearchAttributesOfParentObjectsTestCase, TestCase::QUICK);
+  AddTestCase (new CompiledPathConfigTestCase, TestCase::QUICK);
 }
 
 static ConfigTestSuite configTestSuite;
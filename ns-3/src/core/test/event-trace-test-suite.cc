@@ -0,0 +1,154 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "ns3/event-trace-simulator-impl.h"
+#include "ns3/simulator.h"
+#include "ns3/object-factory.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+class EventTraceTestCase : public TestCase
+{
+public:
+  EventTraceTestCase ();
+  virtual void DoRun (void);
+  void A (void);
+  void D (void);
+  void F (void);
+  void Nothing (void);
+  uint32_t m_invoked;
+};
+
+EventTraceTestCase::EventTraceTestCase ()
+  : TestCase ("Check the events recorded by EventTraceSimulatorImpl")
+{
+}
+
+void
+EventTraceTestCase::A (void)
+{
+  m_invoked++;
+  Simulator::Schedule (MicroSeconds (1), &EventTraceTestCase::F, this);
+}
+
+void
+EventTraceTestCase::D (void)
+{
+  m_invoked++;
+}
+
+void
+EventTraceTestCase::F (void)
+{
+  m_invoked++;
+}
+
+void
+EventTraceTestCase::Nothing (void)
+{
+}
+
+void
+EventTraceTestCase::DoRun (void)
+{
+  std::string fileName = CreateTempDirFilename ("events.trace");
+  m_invoked = 0;
+
+  Simulator::Destroy ();
+  ObjectFactory factory;
+  factory.SetTypeId ("ns3::EventTraceSimulatorImpl");
+  factory.Set ("FileName", StringValue (fileName));
+  Simulator::SetImplementation (factory.Create<SimulatorImpl> ());
+
+  Simulator::Schedule (MicroSeconds (1), &EventTraceTestCase::A, this);
+  EventId b = Simulator::Schedule (MicroSeconds (2), &EventTraceTestCase::Nothing, this);
+  EventId c = Simulator::Schedule (MicroSeconds (3), &EventTraceTestCase::Nothing, this);
+  Simulator::ScheduleWithContext (7, MicroSeconds (1), &EventTraceTestCase::D, this);
+  Simulator::ScheduleDestroy (&EventTraceTestCase::D, this);
+  b.Cancel ();
+  Simulator::Remove (c);
+  // expired events are not recorded
+  Simulator::Remove (c);
+  Simulator::Run ();
+  Simulator::Destroy ();
+  NS_TEST_ASSERT_MSG_EQ (m_invoked, 4U, "The traced simulator did not invoke the events");
+
+  const uint32_t NONE = 0xffffffff; // no context
+  const uint64_t US = MicroSeconds (1).GetTimeStep ();
+  const uint8_t DESTROY = EventTraceRecord::DESTROY;
+  const struct
+  {
+    uint8_t type;
+    uint32_t uid;
+    uint64_t ts;
+    uint32_t context;
+  } expected[] = {
+    { EventTraceRecord::SCHEDULE, 0, 1 * US, NONE },
+    { EventTraceRecord::SCHEDULE, 1, 2 * US, NONE },
+    { EventTraceRecord::SCHEDULE, 2, 3 * US, NONE },
+    { EventTraceRecord::SCHEDULE, 3, 1 * US, 7 },
+    { EventTraceRecord::SCHEDULE | DESTROY, 4, 0, NONE },
+    { EventTraceRecord::CANCEL, 1, 2 * US, NONE },
+    { EventTraceRecord::REMOVE, 2, 3 * US, NONE },
+    { EventTraceRecord::INVOKE, 0, 1 * US, NONE },
+    { EventTraceRecord::SCHEDULE, 5, 2 * US, NONE },
+    { EventTraceRecord::INVOKE, 3, 1 * US, 7 },
+    { EventTraceRecord::INVOKE, 5, 2 * US, NONE },
+    { EventTraceRecord::INVOKE | DESTROY, 4, 2 * US, NONE },
+  };
+  const uint32_t n = sizeof (expected) / sizeof (expected[0]);
+
+  EventTraceReader reader;
+  NS_TEST_ASSERT_MSG_EQ (reader.Open (fileName), true, "Cannot read the trace");
+  NS_TEST_ASSERT_MSG_EQ (reader.GetRecordCount (), n, "Wrong number of events recorded");
+  NS_TEST_ASSERT_MSG_EQ (reader.GetResolution (), Time::GetResolution (), "Wrong resolution");
+
+  EventTraceRecord records[n];
+  for (uint32_t i = 0; i < n; i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (reader.Read (records[i]), true, "Cannot read entry " << i);
+      NS_TEST_EXPECT_MSG_EQ (static_cast<uint32_t> (records[i].type), static_cast<uint32_t> (expected[i].type),
+                             "Wrong type of entry " << i);
+      NS_TEST_EXPECT_MSG_EQ (records[i].uid, expected[i].uid, "Wrong uid of entry " << i);
+      NS_TEST_EXPECT_MSG_EQ (records[i].ts, expected[i].ts, "Wrong time of entry " << i);
+      NS_TEST_EXPECT_MSG_EQ (records[i].context, expected[i].context, "Wrong context of entry " << i);
+      NS_TEST_EXPECT_MSG_LT (static_cast<uint32_t> (records[i].callback), reader.GetCallbackCount (),
+                             "Wrong callback of entry " << i);
+    }
+  EventTraceRecord record;
+  NS_TEST_EXPECT_MSG_EQ (reader.Read (record), false, "Entries beyond the end of the trace");
+
+  // all the events call a method of the test case without arguments
+  NS_TEST_EXPECT_MSG_EQ (reader.GetCallbackCount (), 1U, "Wrong number of classes of events");
+  NS_TEST_EXPECT_MSG_NE (reader.GetCallbackName (0).find ("EventTraceTestCase"), std::string::npos,
+                         "Wrong name of the class of events " << reader.GetCallbackName (0));
+}
+
+static class EventTraceTestSuite : public TestSuite
+{
+public:
+  EventTraceTestSuite ()
+    : TestSuite ("event-trace", UNIT)
+  {
+    AddTestCase (new EventTraceTestCase (), TestCase::QUICK);
+  }
+} g_eventTraceTestSuite;
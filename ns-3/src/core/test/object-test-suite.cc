@@ -335,6 +335,63 @@ AggregateObjectTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_NE (baseA, 0, "Unable to GetObject on released object");
 }
 
+// ===========================================================================
+// Test case to make sure that the lookups of aggregated Objects stay correct
+// when they are cached.
+// ===========================================================================
+class AggregateCacheTestCase : public TestCase
+{
+public:
+  AggregateCacheTestCase ();
+  virtual ~AggregateCacheTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+AggregateCacheTestCase::AggregateCacheTestCase ()
+  : TestCase ("Check GetObject on aggregated Objects looked up repeatedly")
+{
+}
+
+AggregateCacheTestCase::~AggregateCacheTestCase ()
+{
+}
+
+void
+AggregateCacheTestCase::DoRun (void)
+{
+  Ptr<DerivedB> derivedB = CreateObject<DerivedB> ();
+
+  //
+  // Look up a base class and a missing type several times, so that the
+  // results are cached (or not).
+  //
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (derivedB->GetObject<BaseB> (), derivedB, "GetObject() of base type returns different Ptr");
+      NS_TEST_ASSERT_MSG_EQ (derivedB->GetObject<BaseA> (), 0, "GetObject() of unrelated type returns nonzero pointer");
+    }
+
+  //
+  // Aggregating another object must make it visible to the lookups made
+  // before the aggregation, from both sides.
+  //
+  Ptr<DerivedA> derivedA = CreateObject<DerivedA> ();
+  NS_TEST_ASSERT_MSG_EQ (derivedA->GetObject<BaseA> (), derivedA, "GetObject() of base type returns different Ptr");
+  derivedB->AggregateObject (derivedA);
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (derivedB->GetObject<BaseA> (), derivedA, "GetObject() of aggregated base type returns different Ptr");
+      NS_TEST_ASSERT_MSG_EQ (derivedB->GetObject<DerivedA> (), derivedA, "GetObject() of aggregated type returns different Ptr");
+      NS_TEST_ASSERT_MSG_EQ (derivedA->GetObject<BaseB> (), derivedB, "GetObject() of aggregated base type returns different Ptr");
+      NS_TEST_ASSERT_MSG_EQ (derivedA->GetObject<DerivedB> (), derivedB, "GetObject() of aggregated type returns different Ptr");
+      NS_TEST_ASSERT_MSG_EQ (derivedA->GetObject<BaseA> (), derivedA, "GetObject() of base type returns different Ptr");
+      NS_TEST_ASSERT_MSG_EQ (derivedA->GetObject<Object> (DerivedB::GetTypeId ()), derivedB,
+                             "GetObject(TypeId) of aggregated type returns different Ptr");
+    }
+}
+
 // ===========================================================================
 // Test case to make sure that an Object factory can create Objects
 // ===========================================================================
@@ -421,6 +478,7 @@ ObjectTestSuite::ObjectTestSuite ()
 {
   AddTestCase (new CreateObjectTestCase, TestCase::QUICK);
   AddTestCase (new AggregateObjectTestCase, TestCase::QUICK);
+  AddTestCase (new AggregateCacheTestCase, TestCase::QUICK);
   AddTestCase (new ObjectFactoryTestCase, TestCase::QUICK);
 }
 
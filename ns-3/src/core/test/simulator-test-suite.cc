@@ -23,6 +23,9 @@
 #include "ns3/heap-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/calendar-scheduler.h"
+#include "ns3/hierarchical-wheel-scheduler.h"
+
+#include <vector>
 
 using namespace ns3;
 
@@ -459,6 +462,113 @@ SimulatorTemplateTestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+class SchedulerOrderTestCase : public TestCase
+{
+public:
+  SchedulerOrderTestCase (ObjectFactory schedulerFactory);
+  virtual void DoRun (void);
+  uint64_t Random (void);
+  Scheduler::Event MakeEvent (uint64_t ts);
+  uint64_t m_state;
+  uint32_t m_uid;
+  ObjectFactory m_schedulerFactory;
+};
+
+SchedulerOrderTestCase::SchedulerOrderTestCase (ObjectFactory schedulerFactory)
+  : TestCase ("Check that event order matches ns3::MapScheduler with " +
+              schedulerFactory.GetTypeId ().GetName ()),
+    m_state (1),
+    m_uid (0),
+    m_schedulerFactory (schedulerFactory)
+{
+}
+
+uint64_t
+SchedulerOrderTestCase::Random (void)
+{
+  // 64-bit LCG, good enough for mixing operations
+  m_state = m_state * 6364136223846793005ULL + 1442695040888963407ULL;
+  return m_state >> 16;
+}
+
+Scheduler::Event
+SchedulerOrderTestCase::MakeEvent (uint64_t ts)
+{
+  Scheduler::Event ev;
+  m_uid++;
+  ev.impl = reinterpret_cast<EventImpl *> (static_cast<uintptr_t> (m_uid) << 4);
+  ev.key.m_ts = ts;
+  ev.key.m_uid = m_uid;
+  ev.key.m_context = 0;
+  return ev;
+}
+
+void
+SchedulerOrderTestCase::DoRun (void)
+{
+  Ptr<Scheduler> reference = CreateObject<MapScheduler> ();
+  Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler> ();
+  std::vector<Scheduler::Event> pending;
+  uint64_t now = 0;
+
+  for (uint32_t step = 0; step < 200000; step++)
+    {
+      uint32_t op = Random () % 10;
+      if (op < 5 || pending.empty ())
+        {
+          uint64_t delay;
+          switch (Random () % 5)
+            {
+            case 0: delay = 0; break;                              // same time
+            case 1: delay = Random () % 256; break;                // very short horizon
+            case 2: delay = Random () % 1000000; break;            // short horizon
+            case 3: delay = Random () % (1ULL << 36); break;       // long horizon
+            default: delay = Random () % (1ULL << 50); break;      // beyond the wheels
+            }
+          Scheduler::Event ev = MakeEvent (now + delay);
+          reference->Insert (ev);
+          scheduler->Insert (ev);
+          pending.push_back (ev);
+        }
+      else if (op < 6)
+        {
+          uint32_t index = Random () % pending.size ();
+          Scheduler::Event ev = pending[index];
+          pending[index] = pending.back ();
+          pending.pop_back ();
+          reference->Remove (ev);
+          scheduler->Remove (ev);
+        }
+      else
+        {
+          Scheduler::Event expected = reference->RemoveNext ();
+          NS_TEST_ASSERT_MSG_EQ (scheduler->PeekNext ().key.m_uid, expected.key.m_uid, "PeekNext order differs");
+          Scheduler::Event ev = scheduler->RemoveNext ();
+          NS_TEST_ASSERT_MSG_EQ (ev.key.m_uid, expected.key.m_uid, "RemoveNext order differs");
+          NS_TEST_ASSERT_MSG_EQ (ev.impl, expected.impl, "RemoveNext event differs");
+          now = ev.key.m_ts;
+          for (std::vector<Scheduler::Event>::iterator i = pending.begin (); i != pending.end (); i++)
+            {
+              if (i->key.m_uid == ev.key.m_uid)
+                {
+                  *i = pending.back ();
+                  pending.pop_back ();
+                  break;
+                }
+            }
+        }
+      NS_TEST_ASSERT_MSG_EQ (scheduler->IsEmpty (), reference->IsEmpty (), "IsEmpty differs");
+    }
+
+  while (!reference->IsEmpty ())
+    {
+      Scheduler::Event expected = reference->RemoveNext ();
+      Scheduler::Event ev = scheduler->RemoveNext ();
+      NS_TEST_ASSERT_MSG_EQ (ev.key.m_uid, expected.key.m_uid, "RemoveNext order differs");
+    }
+  NS_TEST_ASSERT_MSG_EQ (scheduler->IsEmpty (), true, "Scheduler should be empty");
+}
+
 class SimulatorTestSuite : public TestSuite
 {
 public:
@@ -473,7 +583,11 @@ public:
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
     factory.SetTypeId (HeapScheduler::GetTypeId ());
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    AddTestCase (new SchedulerOrderTestCase (factory), TestCase::QUICK);
     factory.SetTypeId (CalendarScheduler::GetTypeId ());
     AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    factory.SetTypeId (HierarchicalWheelScheduler::GetTypeId ());
+    AddTestCase (new SimulatorEventsTestCase (factory), TestCase::QUICK);
+    AddTestCase (new SchedulerOrderTestCase (factory), TestCase::QUICK);
   }
 } g_simulatorTestSuite;
@@ -62,6 +62,7 @@ HierarchicalMobilityModel::SetChild (Ptr<MobilityModel> model)
     }
   m_child = model;
   m_child->TraceConnectWithoutContext ("CourseChange", MakeCallback (&HierarchicalMobilityModel::ChildChanged, this));
+  ClearPositionCache ();
 
   // if we had a child before, then we had a valid position before;
   // try to preserve the old absolute position.
@@ -88,6 +89,7 @@ HierarchicalMobilityModel::SetParent (Ptr<MobilityModel> model)
     {
       m_parent->TraceConnectWithoutContext ("CourseChange", MakeCallback (&HierarchicalMobilityModel::ParentChanged, this));
     }
+  ClearPositionCache ();
   // try to preserve the old position across parent changes
   if (m_child)
     {
@@ -22,6 +22,8 @@
 
 #include "mobility-model.h"
 #include "ns3/trace-source-accessor.h"
+#include "ns3/boolean.h"
+#include "ns3/simulator.h"
 
 namespace ns3 {
 
@@ -46,11 +48,19 @@ MobilityModel::GetTypeId (void)
     .AddTraceSource ("CourseChange", 
                      "The value of the position and/or velocity vector changed",
                      MakeTraceSourceAccessor (&MobilityModel::m_courseChangeTrace))
+    .AddAttribute ("PositionCache",
+                   "Compute the position at most once per simulation time step, "
+                   "until the course of the model changes.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&MobilityModel::m_positionCache),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
 
 MobilityModel::MobilityModel ()
+  : m_positionCache (false),
+    m_positionTs (-1)
 {
 }
 
@@ -61,7 +71,19 @@ MobilityModel::~MobilityModel ()
 Vector
 MobilityModel::GetPosition (void) const
 {
-  return DoGetPosition ();
+  if (!m_positionCache)
+    {
+      return DoGetPosition ();
+    }
+  int64_t now = Simulator::Now ().GetTimeStep ();
+  if (now != m_positionTs)
+    {
+      // DoGetPosition may notify a course change, which clears the cache
+      Vector position = DoGetPosition ();
+      m_position = position;
+      m_positionTs = now;
+    }
+  return m_position;
 }
 Vector
 MobilityModel::GetVelocity (void) const
@@ -72,14 +94,15 @@ MobilityModel::GetVelocity (void) const
 void 
 MobilityModel::SetPosition (const Vector &position)
 {
+  ClearPositionCache ();
   DoSetPosition (position);
 }
 
 double 
 MobilityModel::GetDistanceFrom (Ptr<const MobilityModel> other) const
 {
-  Vector oPosition = other->DoGetPosition ();
-  Vector position = DoGetPosition ();
+  Vector oPosition = other->GetPosition ();
+  Vector position = GetPosition ();
   return CalculateDistance (position, oPosition);
 }
 
@@ -95,9 +118,16 @@ MobilityModel::GetRelativeSpeed (Ptr<const MobilityModel> other) const
 void
 MobilityModel::NotifyCourseChange (void) const
 {
+  ClearPositionCache ();
   m_courseChangeTrace (this);
 }
 
+void
+MobilityModel::ClearPositionCache (void) const
+{
+  m_positionTs = -1;
+}
+
 int64_t
 MobilityModel::AssignStreams (int64_t start)
 {
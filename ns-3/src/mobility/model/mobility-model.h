@@ -84,6 +84,15 @@ protected:
    * position changes to notify course change listeners.
    */
   void NotifyCourseChange (void) const;
+  /**
+   * Must be invoked by subclasses when the position at the current
+   * time changes without a course change notification, if any.
+   *
+   * When the PositionCache attribute is set, GetPosition computes
+   * the position once per simulation time step, and returns the same
+   * value until the time advances or the course changes.
+   */
+  void ClearPositionCache (void) const;
 private:
   /**
    * \return the current position.
@@ -119,6 +128,10 @@ private:
    */
   TracedCallback<Ptr<const MobilityModel> > m_courseChangeTrace;
 
+  bool m_positionCache;         //!< Whether GetPosition caches the position
+  mutable Vector m_position;    //!< Position at m_positionTs
+  mutable int64_t m_positionTs; //!< Time step of m_position, -1 if none
+
 };
 
 Ptr<MobilityModel>
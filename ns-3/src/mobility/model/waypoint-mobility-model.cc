@@ -85,6 +85,7 @@ WaypointMobilityModel::AddWaypoint (const Waypoint &waypoint)
     {
       m_first = false;
       m_current = m_next = waypoint;
+      ClearPositionCache ();
     }
   else
     {
@@ -30,6 +30,7 @@
 #include "ns3/vector.h"
 #include "ns3/mobility-model.h"
 #include "ns3/waypoint-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
 #include "ns3/mobility-helper.h"
 
 using namespace ns3;
@@ -354,6 +355,74 @@ WaypointMobilityModelViaHelper::DoRun (void)
   Simulator::Destroy ();
 }
 
+// Test that the positions returned with PositionCache enabled follow the
+// changes of position and velocity occurring at the time of a query
+class PositionCacheTest : public TestCase
+{
+public:
+  PositionCacheTest ();
+  virtual ~PositionCacheTest ();
+
+private:
+  void TestSameTime (Ptr<ConstantVelocityMobilityModel> mob, Ptr<const MobilityModel> other);
+  void TestPosition (Ptr<const MobilityModel> mob, Vector expected);
+  virtual void DoRun (void);
+};
+
+PositionCacheTest::PositionCacheTest ()
+  : TestCase ("Test the positions returned with PositionCache enabled")
+{
+}
+
+PositionCacheTest::~PositionCacheTest ()
+{
+}
+
+void
+PositionCacheTest::TestSameTime (Ptr<ConstantVelocityMobilityModel> mob, Ptr<const MobilityModel> other)
+{
+  TestPosition (mob, Vector (2.0, 0.0, 0.0));
+  NS_TEST_EXPECT_MSG_EQ_TOL_INTERNAL (mob->GetDistanceFrom (other), 2.0, 0.001, "Distance not equal", __FILE__, __LINE__);
+  // teleport after the position was queried at this time
+  mob->SetPosition (Vector (5.0, 0.0, 0.0));
+  TestPosition (mob, Vector (5.0, 0.0, 0.0));
+  NS_TEST_EXPECT_MSG_EQ_TOL_INTERNAL (mob->GetDistanceFrom (other), 5.0, 0.001, "Distance not equal", __FILE__, __LINE__);
+  mob->SetVelocity (Vector (0.0, 1.0, 0.0));
+  TestPosition (mob, Vector (5.0, 0.0, 0.0));
+}
+
+void
+PositionCacheTest::TestPosition (Ptr<const MobilityModel> mob, Vector expected)
+{
+  Vector pos = mob->GetPosition ();
+  NS_TEST_EXPECT_MSG_EQ_TOL_INTERNAL (pos.x, expected.x, 0.001, "Position not equal", __FILE__, __LINE__);
+  NS_TEST_EXPECT_MSG_EQ_TOL_INTERNAL (pos.y, expected.y, 0.001, "Position not equal", __FILE__, __LINE__);
+}
+
+void
+PositionCacheTest::DoRun (void)
+{
+  Ptr<ConstantVelocityMobilityModel> mob = CreateObject<ConstantVelocityMobilityModel> ();
+  mob->SetAttribute ("PositionCache", BooleanValue (true));
+  mob->SetPosition (Vector (0.0, 0.0, 0.0));
+  mob->SetVelocity (Vector (1.0, 0.0, 0.0));
+  Ptr<WaypointMobilityModel> other = CreateObject<WaypointMobilityModel> ();
+  other->SetAttribute ("PositionCache", BooleanValue (true));
+  other->AddWaypoint (Waypoint (Seconds (0.0), Vector (0.0, 0.0, 0.0)));
+
+  Simulator::Schedule (Seconds (1.0), &PositionCacheTest::TestPosition, this, mob, Vector (1.0, 0.0, 0.0));
+  Simulator::Schedule (Seconds (2.0), &PositionCacheTest::TestSameTime, this, mob, other);
+  Simulator::Schedule (Seconds (3.0), &PositionCacheTest::TestPosition, this, mob, Vector (5.0, 1.0, 0.0));
+  // the waypoint added after a query moves the model from time 3
+  Simulator::Schedule (Seconds (3.0), &PositionCacheTest::TestPosition, this, other, Vector (0.0, 0.0, 0.0));
+  other->AddWaypoint (Waypoint (Seconds (3.0), Vector (0.0, 0.0, 0.0)));
+  other->AddWaypoint (Waypoint (Seconds (5.0), Vector (4.0, 0.0, 0.0)));
+  Simulator::Schedule (Seconds (4.0), &PositionCacheTest::TestPosition, this, other, Vector (2.0, 0.0, 0.0));
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
 class MobilityTestSuite : public TestSuite
 {
 public:
@@ -367,6 +436,7 @@ MobilityTestSuite::MobilityTestSuite ()
   AddTestCase (new WaypointLazyNotifyTrue, TestCase::QUICK);
   AddTestCase (new WaypointInitialPositionIsWaypoint, TestCase::QUICK);
   AddTestCase (new WaypointMobilityModelViaHelper, TestCase::QUICK);
+  AddTestCase (new PositionCacheTest, TestCase::QUICK);
 }
 
 static MobilityTestSuite mobilityTestSuite;
@@ -0,0 +1,214 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+/*
+ * Vehicles broadcasting 10 Hz beacons over a shared 802.11p (10 MHz) YansWifiChannel,
+ * distributed over MPI ranks by road region with vanetmobility::PartitionHelper.
+ *
+ * Vehicles move along a straight multi-lane road (lanes in both directions), or
+ * follow SUMO traces when --sumo points to a directory with input.net.xml,
+ * input.rou.xml and input.fcd.xml.  The channel uses the propagation delay over
+ * --min-distance as the lookahead; receptions between closer vehicles of different
+ * ranks are postponed to the lookahead and reported as late.
+ *
+ * Sequential run and distributed run over 4 ranks on the same host:
+ *
+ *     ./waf --run "vanet-wifi-distributed --vehicles=2000"
+ *     mpirun -np 4 ./waf --run "vanet-wifi-distributed --vehicles=2000"
+ *
+ * Both print the total number of received beacons, which should match as long
+ * as no reception is late.
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/wifi-module.h"
+#include "ns3/yans-wifi-remote-channel.h"
+#include "ns3/mpi-interface.h"
+#include "ns3/vanetmobility-helper.h"
+#include "ns3/partition-helper.h"
+#include "ns3/SumoMobility.h"
+
+#ifdef NS3_MPI
+#include <mpi.h>
+#endif
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("VanetWifiDistributed");
+
+static uint64_t g_received = 0;
+
+static bool
+ReceiveBeacon (Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol, const Address &from)
+{
+  g_received++;
+  return true;
+}
+
+static void
+SendBeacon (Ptr<NetDevice> device, uint32_t size, Time interval)
+{
+  device->Send (Create<Packet> (size), device->GetBroadcast (), 0x88dc);
+  Simulator::Schedule (interval, &SendBeacon, device, size, interval);
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t vehicles = 500;
+  uint32_t lanes = 4;
+  double length = 10000;
+  double range = 300;
+  double minDistance = 50;
+  double stop = 10;
+  bool distributed = true;
+  std::string sumo = "";
+
+  CommandLine cmd;
+  cmd.AddValue ("vehicles", "Number of vehicles on the synthetic road", vehicles);
+  cmd.AddValue ("lanes", "Number of lanes of the synthetic road", lanes);
+  cmd.AddValue ("length", "Length of the synthetic road, m", length);
+  cmd.AddValue ("range", "Transmission range, m", range);
+  cmd.AddValue ("min-distance", "Smallest distance between vehicles of different ranks, m", minDistance);
+  cmd.AddValue ("stop", "Simulation time, seconds", stop);
+  cmd.AddValue ("distributed", "Use DistributedSimulatorImpl when compiled with MPI", distributed);
+  cmd.AddValue ("sumo", "Directory with SUMO input.net.xml, input.rou.xml and input.fcd.xml", sumo);
+  cmd.Parse (argc, argv);
+
+#ifdef NS3_MPI
+  if (distributed)
+    {
+      GlobalValue::Bind ("SimulatorImplementationType", StringValue ("ns3::DistributedSimulatorImpl"));
+      MpiInterface::Enable (&argc, &argv);
+    }
+#endif
+  uint32_t systemId = MpiInterface::IsEnabled () ? MpiInterface::GetSystemId () : 0;
+  uint32_t systemCount = MpiInterface::IsEnabled () ? MpiInterface::GetSize () : 1;
+
+  Config::SetDefault ("ns3::YansWifiRemoteChannel::MinimumRemoteDistance", DoubleValue (minDistance));
+
+  // vehicles, each rank creates all of them with the same positions
+  vanetmobility::PartitionHelper partition (systemCount);
+  Ptr<vanetmobility::sumomobility::SumoMobility> sumoMobility;
+  NodeContainer nodes;
+  if (sumo != "")
+    {
+      vanetmobility::VANETmobilityHelper sumoHelper;
+      sumoMobility = DynamicCast<vanetmobility::sumomobility::SumoMobility> (
+        sumoHelper.GetSumoMObility (sumo + "/input.net.xml", sumo + "/input.rou.xml", sumo + "/input.fcd.xml"));
+      partition.Partition (sumoMobility);
+      nodes = partition.Create ();
+      sumoMobility->Install ();
+    }
+  else
+    {
+      Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+      std::vector<Vector> positions;
+      for (uint32_t i = 0; i < vehicles; i++)
+        {
+          uint32_t lane = i % lanes;
+          positions.push_back (Vector (random->GetValue (0, length), lane * 4.0, 0));
+        }
+      partition.Partition (positions);
+      nodes = partition.Create ();
+
+      MobilityHelper mobility;
+      mobility.SetMobilityModel ("ns3::ConstantVelocityMobilityModel");
+      mobility.Install (nodes);
+      for (uint32_t i = 0; i < vehicles; i++)
+        {
+          Ptr<ConstantVelocityMobilityModel> model = nodes.Get (i)->GetObject<ConstantVelocityMobilityModel> ();
+          model->SetPosition (positions[i]);
+          // half of the lanes go each way
+          double speed = random->GetValue (20, 35);
+          model->SetVelocity (Vector ((i % lanes) < lanes / 2 ? speed : -speed, 0, 0));
+        }
+    }
+
+  // 802.11p-like ad hoc wifi
+  YansWifiChannelHelper channelHelper;
+  channelHelper.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+  channelHelper.AddPropagationLoss ("ns3::RangePropagationLossModel", "MaxRange", DoubleValue (range));
+  Ptr<YansWifiChannel> channel = channelHelper.Create ();
+  YansWifiPhyHelper phy = YansWifiPhyHelper::Default ();
+  phy.SetChannel (channel);
+  NqosWifiMacHelper mac = NqosWifiMacHelper::Default ();
+  mac.SetType ("ns3::AdhocWifiMac");
+  WifiHelper wifi;
+  wifi.SetStandard (WIFI_PHY_STANDARD_80211_10MHZ);
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager",
+                                "DataMode", StringValue ("OfdmRate6MbpsBW10MHz"),
+                                "NonUnicastMode", StringValue ("OfdmRate6MbpsBW10MHz"));
+  NetDeviceContainer devices = wifi.Install (phy, mac, nodes);
+
+  // beacons from the vehicles of this rank
+  Ptr<UniformRandomVariable> offset = CreateObject<UniformRandomVariable> ();
+  uint32_t local = 0;
+  for (uint32_t i = 0; i < devices.GetN (); i++)
+    {
+      Ptr<NetDevice> device = devices.Get (i);
+      Time start = Seconds (offset->GetValue (0, 0.1)); // same on all ranks
+      if (device->GetNode ()->GetSystemId () != systemId)
+        {
+          continue;
+        }
+      local++;
+      device->SetReceiveCallback (MakeCallback (&ReceiveBeacon));
+      Simulator::ScheduleWithContext (device->GetNode ()->GetId (), start,
+                                      &SendBeacon, device, 200, MilliSeconds (100));
+    }
+
+  Simulator::Stop (Seconds (stop));
+
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t elapsed = clock.End ();
+
+  Ptr<YansWifiRemoteChannel> remote = DynamicCast<YansWifiRemoteChannel> (channel);
+  std::cout << "rank=" << systemId << "/" << systemCount
+            << " vehicles=" << local
+            << " received=" << g_received
+            << " late=" << (remote != 0 ? remote->GetNLateDeliveries () : 0)
+            << " wall-ms=" << elapsed << std::endl;
+
+#ifdef NS3_MPI
+  if (MpiInterface::IsEnabled ())
+    {
+      uint64_t total = 0;
+      MPI_Reduce (&g_received, &total, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
+      int64_t slowest = 0;
+      MPI_Reduce (&elapsed, &slowest, 1, MPI_LONG_LONG, MPI_MAX, 0, MPI_COMM_WORLD);
+      if (systemId == 0)
+        {
+          std::cout << "total received=" << total << " wall-ms=" << slowest << std::endl;
+        }
+    }
+#endif
+
+  Simulator::Destroy ();
+  if (MpiInterface::IsEnabled ())
+    {
+      MpiInterface::Disable ();
+    }
+  return 0;
+}
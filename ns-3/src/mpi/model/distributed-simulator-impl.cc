@@ -25,6 +25,7 @@
 #include "ns3/scheduler.h"
 #include "ns3/event-impl.h"
 #include "ns3/channel.h"
+#include "ns3/net-device.h"
 #include "ns3/node-container.h"
 #include "ns3/ptr.h"
 #include "ns3/pointer.h"
@@ -32,6 +33,7 @@
 #include "ns3/log.h"
 
 #include <cmath>
+#include <set>
 
 #ifdef NS3_MPI
 #include <mpi.h>
@@ -78,6 +80,23 @@ LbtsMessage::IsFinished ()
 
 Time DistributedSimulatorImpl::m_lookAhead = Seconds (-1);
 
+#ifdef NS3_MPI
+/// Check if any device attached to the channel belongs to another system
+static bool
+HasRemoteDevice (Ptr<Channel> channel)
+{
+  for (uint32_t i = 0; i < channel->GetNDevices (); ++i)
+    {
+      Ptr<NetDevice> device = channel->GetDevice (i);
+      if (device != 0 && device->GetNode ()->GetSystemId () != MpiInterface::GetSystemId ())
+        {
+          return true;
+        }
+    }
+  return false;
+}
+#endif
+
 TypeId
 DistributedSimulatorImpl::GetTypeId (void)
 {
@@ -177,6 +196,7 @@ DistributedSimulatorImpl::CalculateLookAhead (void)
         }
       // else it was already set by SetLookAhead
 
+      std::set<Ptr<Channel> > visited;
       NodeContainer c = NodeContainer::GetGlobal ();
       for (NodeContainer::Iterator iter = c.Begin (); iter != c.End (); ++iter)
         {
@@ -188,14 +208,30 @@ DistributedSimulatorImpl::CalculateLookAhead (void)
           for (uint32_t i = 0; i < (*iter)->GetNDevices (); ++i)
             {
               Ptr<NetDevice> localNetDevice = (*iter)->GetDevice (i);
-              // only works for p2p links currently
-              if (!localNetDevice->IsPointToPoint ())
+              Ptr<Channel> channel = localNetDevice->GetChannel ();
+              if (channel == 0)
                 {
                   continue;
                 }
-              Ptr<Channel> channel = localNetDevice->GetChannel ();
-              if (channel == 0)
+
+              if (!localNetDevice->IsPointToPoint ())
                 {
+                  // shared channels (e.g., YansWifiRemoteChannel) report the smallest
+                  // delay to a device on another system as "LookAhead" attribute
+                  if (!visited.insert (channel).second)
+                    {
+                      continue;
+                    }
+                  TimeValue lookAhead;
+                  if (!channel->GetAttributeFailSafe ("LookAhead", lookAhead) ||
+                      !HasRemoteDevice (channel))
+                    {
+                      continue;
+                    }
+                  if (lookAhead.Get () < m_lookAhead)
+                    {
+                      m_lookAhead = lookAhead.Get ();
+                    }
                   continue;
                 }
 
@@ -0,0 +1,906 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "multithreaded-simulator-impl.h"
+
+#include "ns3/simulator.h"
+#include "ns3/scheduler.h"
+#include "ns3/event-impl.h"
+#include "ns3/channel.h"
+#include "ns3/net-device.h"
+#include "ns3/node.h"
+#include "ns3/node-list.h"
+#include "ns3/uinteger.h"
+#include "ns3/atomic-counter.h"
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <set>
+#include <sched.h>
+
+NS_LOG_COMPONENT_DEFINE ("MultithreadedSimulatorImpl");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (MultithreadedSimulatorImpl);
+
+__thread MultithreadedSimulatorImpl::Partition *MultithreadedSimulatorImpl::g_partition = 0;
+
+// timestamp used when there are no events (later than any valid timestamp)
+static const uint64_t MAX_TS = std::numeric_limits<uint64_t>::max ();
+
+/**
+ * \brief Lookahead provided by a channel: its "LookAhead" or "Delay" attribute,
+ * zero if it has none of these
+ */
+static Time
+GetChannelLookAhead (Ptr<Channel> channel)
+{
+  TimeValue delay;
+  if (channel->GetAttributeFailSafe ("LookAhead", delay) ||
+      channel->GetAttributeFailSafe ("Delay", delay))
+    {
+      return delay.Get ();
+    }
+  return Seconds (0);
+}
+
+static uint32_t
+FindRoot (std::vector<uint32_t> &parent, uint32_t i)
+{
+  while (parent[i] != i)
+    {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+  return i;
+}
+
+TypeId
+MultithreadedSimulatorImpl::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::MultithreadedSimulatorImpl")
+    .SetParent<SimulatorImpl> ()
+    .AddConstructor<MultithreadedSimulatorImpl> ()
+    .AddAttribute ("ThreadCount",
+                   "Number of threads executing the partitions, including the thread calling Simulator::Run",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&MultithreadedSimulatorImpl::m_threadCount),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("PartitionCount",
+                   "Number of partitions formed from the topology if the nodes do not have "
+                   "different system ids (0 to use ThreadCount)",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&MultithreadedSimulatorImpl::m_partitionCount),
+                   MakeUintegerChecker<uint32_t> ())
+  ;
+  return tid;
+}
+
+MultithreadedSimulatorImpl::MultithreadedSimulatorImpl ()
+{
+  NS_LOG_FUNCTION (this);
+  // uids are allocated from 4, see DefaultSimulatorImpl
+  m_uid = 4;
+  m_currentUid = 0;
+  m_currentTs = 0;
+  m_currentContext = 0xffffffff;
+  m_stop = false;
+  m_threadCount = 1;
+  m_partitionCount = 0;
+  m_lookAhead = MAX_TS;
+  m_windowCount = 0;
+  m_windowEnd = 0;
+  m_generation = 0;
+  m_nextPartition = 0;
+  m_finished = false;
+  m_runningThreads = 1;
+  m_barrierCount = 0;
+  m_barrierGeneration = 0;
+}
+
+MultithreadedSimulatorImpl::~MultithreadedSimulatorImpl ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+MultithreadedSimulatorImpl::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (std::vector<Partition *>::iterator i = m_partitions.begin (); i != m_partitions.end (); i++)
+    {
+      Partition *partition = *i;
+      while (!partition->events->IsEmpty ())
+        {
+          Scheduler::Event next = partition->events->RemoveNext ();
+          next.impl->Unref ();
+        }
+      for (uint32_t generation = 0; generation < 2; generation++)
+        {
+          for (uint32_t j = 0; j < partition->mailbox[generation].size (); j++)
+            {
+              std::vector<Scheduler::Event> &mailbox = partition->mailbox[generation][j];
+              for (std::vector<Scheduler::Event>::iterator ev = mailbox.begin (); ev != mailbox.end (); ev++)
+                {
+                  ev->impl->Unref ();
+                }
+            }
+        }
+      delete partition;
+    }
+  m_partitions.clear ();
+  m_nodePartition.clear ();
+
+  while (!m_events->IsEmpty ())
+    {
+      Scheduler::Event next = m_events->RemoveNext ();
+      next.impl->Unref ();
+    }
+  m_events = 0;
+  SimulatorImpl::DoDispose ();
+}
+
+void
+MultithreadedSimulatorImpl::Destroy ()
+{
+  NS_LOG_FUNCTION (this);
+  while (!m_destroyEvents.empty ())
+    {
+      Ptr<EventImpl> ev = m_destroyEvents.front ().PeekEventImpl ();
+      m_destroyEvents.pop_front ();
+      NS_LOG_LOGIC ("handle destroy " << ev);
+      if (!ev->IsCancelled ())
+        {
+          ev->Invoke ();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::SetScheduler (ObjectFactory schedulerFactory)
+{
+  NS_LOG_FUNCTION (this << schedulerFactory);
+  m_schedulerFactory = schedulerFactory;
+
+  Ptr<Scheduler> scheduler = schedulerFactory.Create<Scheduler> ();
+  if (m_events != 0)
+    {
+      while (!m_events->IsEmpty ())
+        {
+          scheduler->Insert (m_events->RemoveNext ());
+        }
+    }
+  m_events = scheduler;
+
+  for (std::vector<Partition *>::iterator i = m_partitions.begin (); i != m_partitions.end (); i++)
+    {
+      scheduler = schedulerFactory.Create<Scheduler> ();
+      while (!(*i)->events->IsEmpty ())
+        {
+          scheduler->Insert ((*i)->events->RemoveNext ());
+        }
+      (*i)->events = scheduler;
+    }
+}
+
+// All partitions run in the same process
+uint32_t
+MultithreadedSimulatorImpl::GetSystemId (void) const
+{
+  return 0;
+}
+
+void
+MultithreadedSimulatorImpl::AssignPartitions (std::vector<uint32_t> &partitions, uint32_t count) const
+{
+  NS_LOG_FUNCTION (this << count);
+  uint32_t nNodes = partitions.size ();
+
+  // nodes connected by channels without lookahead have to be in the same partition
+  std::vector<uint32_t> parent (nNodes);
+  std::vector<std::vector<uint32_t> > neighbours (nNodes);
+  for (uint32_t i = 0; i < nNodes; i++)
+    {
+      parent[i] = i;
+    }
+
+  std::set<Ptr<Channel> > visited;
+  for (uint32_t i = 0; i < nNodes; i++)
+    {
+      Ptr<Node> node = NodeList::GetNode (i);
+      for (uint32_t j = 0; j < node->GetNDevices (); j++)
+        {
+          Ptr<Channel> channel = node->GetDevice (j)->GetChannel ();
+          if (channel == 0 || !visited.insert (channel).second)
+            {
+              continue;
+            }
+          bool hasLookAhead = GetChannelLookAhead (channel).IsStrictlyPositive ();
+          for (uint32_t k = 0; k < channel->GetNDevices (); k++)
+            {
+              Ptr<NetDevice> device = channel->GetDevice (k);
+              if (device == 0 || device->GetNode () == 0)
+                {
+                  continue;
+                }
+              uint32_t other = device->GetNode ()->GetId ();
+              if (other == i || other >= nNodes)
+                {
+                  continue;
+                }
+              neighbours[i].push_back (other);
+              neighbours[other].push_back (i);
+              if (!hasLookAhead)
+                {
+                  parent[FindRoot (parent, other)] = FindRoot (parent, i);
+                }
+            }
+        }
+    }
+
+  std::vector<std::vector<uint32_t> > members (nNodes);
+  for (uint32_t i = 0; i < nNodes; i++)
+    {
+      members[FindRoot (parent, i)].push_back (i);
+    }
+
+  // assign the groups of nodes in breadth-first order, so that the partitions are
+  // contiguous regions of the topology with about nNodes / count nodes each
+  std::vector<bool> queued (nNodes, false);
+  uint32_t assigned = 0;
+  uint32_t partition = 0;
+  for (uint32_t start = 0; start < nNodes; start++)
+    {
+      uint32_t root = FindRoot (parent, start);
+      if (queued[root])
+        {
+          continue;
+        }
+      std::queue<uint32_t> queue;
+      queue.push (root);
+      queued[root] = true;
+      while (!queue.empty ())
+        {
+          uint32_t group = queue.front ();
+          queue.pop ();
+          if (assigned >= static_cast<uint64_t> (partition + 1) * nNodes / count &&
+              partition + 1 < count)
+            {
+              partition++;
+            }
+          for (std::vector<uint32_t>::iterator i = members[group].begin (); i != members[group].end (); i++)
+            {
+              partitions[*i] = partition;
+              for (std::vector<uint32_t>::iterator j = neighbours[*i].begin (); j != neighbours[*i].end (); j++)
+                {
+                  uint32_t other = FindRoot (parent, *j);
+                  if (!queued[other])
+                    {
+                      queued[other] = true;
+                      queue.push (other);
+                    }
+                }
+            }
+          assigned += members[group].size ();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::CalculateLookAhead (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_lookAhead = MAX_TS;
+
+  std::set<Ptr<Channel> > visited;
+  for (uint32_t i = 0; i < m_nodePartition.size (); i++)
+    {
+      Ptr<Node> node = NodeList::GetNode (i);
+      for (uint32_t j = 0; j < node->GetNDevices (); j++)
+        {
+          Ptr<Channel> channel = node->GetDevice (j)->GetChannel ();
+          if (channel == 0 || !visited.insert (channel).second)
+            {
+              continue;
+            }
+          bool isRemote = false;
+          for (uint32_t k = 0; k < channel->GetNDevices (); k++)
+            {
+              Ptr<NetDevice> device = channel->GetDevice (k);
+              if (device != 0 && device->GetNode () != 0 &&
+                  GetPartition (device->GetNode ()->GetId ()) != m_nodePartition[i])
+                {
+                  isRemote = true;
+                }
+            }
+          if (!isRemote)
+            {
+              continue;
+            }
+
+          Time lookAhead = GetChannelLookAhead (channel);
+          if (!lookAhead.IsStrictlyPositive ())
+            {
+              NS_FATAL_ERROR ("Channel " << channel->GetInstanceTypeId ().GetName ()
+                              << " of node " << i << " connects different partitions, but does not provide a lookahead");
+            }
+          m_lookAhead = std::min (m_lookAhead, static_cast<uint64_t> (lookAhead.GetTimeStep ()));
+        }
+    }
+  NS_LOG_DEBUG ("lookahead " << GetLookAhead ());
+}
+
+void
+MultithreadedSimulatorImpl::CreatePartitions (void)
+{
+  NS_LOG_FUNCTION (this);
+  uint32_t nNodes = NodeList::GetNNodes ();
+  m_nodePartition.assign (nNodes, 0);
+
+  uint32_t systemCount = 1;
+  for (uint32_t i = 0; i < nNodes; i++)
+    {
+      systemCount = std::max (systemCount, NodeList::GetNode (i)->GetSystemId () + 1);
+    }
+
+  uint32_t count = 1;
+  if (systemCount > 1)
+    {
+      for (uint32_t i = 0; i < nNodes; i++)
+        {
+          m_nodePartition[i] = NodeList::GetNode (i)->GetSystemId ();
+        }
+      count = systemCount;
+    }
+  else if (nNodes > 0)
+    {
+      count = std::min (m_partitionCount > 0 ? m_partitionCount : m_threadCount, nNodes);
+      AssignPartitions (m_nodePartition, count);
+      count = *std::max_element (m_nodePartition.begin (), m_nodePartition.end ()) + 1;
+    }
+
+  for (uint32_t i = 0; i < count; i++)
+    {
+      Partition *partition = new Partition;
+      partition->id = i;
+      partition->events = m_schedulerFactory.Create<Scheduler> ();
+      partition->uid = m_uid;
+      partition->currentUid = m_currentUid;
+      partition->currentTs = m_currentTs;
+      partition->currentContext = 0xffffffff;
+      for (uint32_t generation = 0; generation < 2; generation++)
+        {
+          partition->mailbox[generation].resize (count + 1);
+          partition->mailboxTs[generation].assign (count + 1, MAX_TS);
+        }
+      partition->remoteEvents = 0;
+      m_partitions.push_back (partition);
+    }
+  NS_LOG_DEBUG (nNodes << " nodes in " << count << " partitions");
+
+  CalculateLookAhead ();
+
+  // the events scheduled so far for the nodes go to their partitions
+  Ptr<Scheduler> events = m_schedulerFactory.Create<Scheduler> ();
+  while (!m_events->IsEmpty ())
+    {
+      Scheduler::Event ev = m_events->RemoveNext ();
+      Partition *owner = GetOwner (ev.key.m_context);
+      if (owner != 0)
+        {
+          owner->events->Insert (ev);
+        }
+      else
+        {
+          events->Insert (ev);
+        }
+    }
+  m_events = events;
+}
+
+MultithreadedSimulatorImpl::Partition *
+MultithreadedSimulatorImpl::GetOwner (uint32_t context) const
+{
+  if (context < m_nodePartition.size ())
+    {
+      return m_partitions[m_nodePartition[context]];
+    }
+  return 0;
+}
+
+Ptr<Scheduler>
+MultithreadedSimulatorImpl::GetEvents (uint32_t context) const
+{
+  Partition *owner = GetOwner (context);
+  return owner != 0 ? owner->events : m_events;
+}
+
+void
+MultithreadedSimulatorImpl::Insert (Partition *partition, Scheduler::Event &ev)
+{
+  if (partition != 0)
+    {
+      ev.key.m_uid = partition->uid++;
+      partition->events->Insert (ev);
+    }
+  else
+    {
+      ev.key.m_uid = m_uid++;
+      m_events->Insert (ev);
+    }
+}
+
+uint64_t
+MultithreadedSimulatorImpl::NextPartitionTs (void) const
+{
+  uint64_t ts = MAX_TS;
+  for (std::vector<Partition *>::const_iterator i = m_partitions.begin (); i != m_partitions.end (); i++)
+    {
+      if (!(*i)->events->IsEmpty ())
+        {
+          ts = std::min (ts, (*i)->events->PeekNext ().key.m_ts);
+        }
+      // events sent to the other partitions during the last window
+      const std::vector<uint64_t> &mailboxTs = (*i)->mailboxTs[m_generation];
+      for (uint32_t j = 0; j < m_partitions.size (); j++)
+        {
+          ts = std::min (ts, mailboxTs[j]);
+        }
+    }
+  return ts;
+}
+
+void
+MultithreadedSimulatorImpl::CollectGlobalMailboxes (void)
+{
+  uint32_t global = m_partitions.size ();
+  for (std::vector<Partition *>::iterator i = m_partitions.begin (); i != m_partitions.end (); i++)
+    {
+      std::vector<Scheduler::Event> &mailbox = (*i)->mailbox[m_generation][global];
+      for (std::vector<Scheduler::Event>::iterator ev = mailbox.begin (); ev != mailbox.end (); ev++)
+        {
+          Insert (0, *ev);
+        }
+      mailbox.clear ();
+      (*i)->mailboxTs[m_generation][global] = MAX_TS;
+    }
+}
+
+void
+MultithreadedSimulatorImpl::ProcessGlobalEvents (uint64_t ts)
+{
+  // events of the partitions scheduled by these events are inserted directly and
+  // may be earlier than ts
+  m_windowEnd = ts;
+  while (!m_stop && !m_events->IsEmpty () && m_events->PeekNext ().key.m_ts <= m_windowEnd)
+    {
+      Scheduler::Event next = m_events->RemoveNext ();
+      NS_ASSERT (next.key.m_ts >= m_currentTs);
+      m_currentTs = next.key.m_ts;
+      m_currentContext = next.key.m_context;
+      m_currentUid = next.key.m_uid;
+      next.impl->Invoke ();
+      next.impl->Unref ();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::ProcessPartition (Partition *partition)
+{
+  g_partition = partition;
+
+  // collect the events sent during the last window, in the order of the senders
+  uint32_t generation = m_generation ^ 1;
+  for (std::vector<Partition *>::iterator i = m_partitions.begin (); i != m_partitions.end (); i++)
+    {
+      std::vector<Scheduler::Event> &mailbox = (*i)->mailbox[generation][partition->id];
+      for (std::vector<Scheduler::Event>::iterator ev = mailbox.begin (); ev != mailbox.end (); ev++)
+        {
+          Insert (partition, *ev);
+        }
+      mailbox.clear ();
+      (*i)->mailboxTs[generation][partition->id] = MAX_TS;
+    }
+
+  while (!m_stop && !partition->events->IsEmpty () &&
+         partition->events->PeekNext ().key.m_ts < m_windowEnd)
+    {
+      Scheduler::Event next = partition->events->RemoveNext ();
+      NS_ASSERT (next.key.m_ts >= partition->currentTs);
+      partition->currentTs = next.key.m_ts;
+      partition->currentContext = next.key.m_context;
+      partition->currentUid = next.key.m_uid;
+      next.impl->Invoke ();
+      next.impl->Unref ();
+    }
+
+  g_partition = 0;
+}
+
+void
+MultithreadedSimulatorImpl::ProcessPartitions (void)
+{
+  while (true)
+    {
+      uint32_t i = AtomicIncrement (m_nextPartition) - 1;
+      if (i >= m_partitions.size ())
+        {
+          break;
+        }
+      ProcessPartition (m_partitions[i]);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::WaitBarrier (void)
+{
+  if (m_runningThreads == 1)
+    {
+      return;
+    }
+  uint32_t generation = m_barrierGeneration;
+  if (AtomicIncrement (m_barrierCount) == m_runningThreads)
+    {
+      m_barrierCount = 0;
+      __sync_synchronize ();
+      m_barrierGeneration = generation + 1;
+    }
+  else
+    {
+      while (m_barrierGeneration == generation)
+        {
+          sched_yield ();
+        }
+      __sync_synchronize ();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::DoWork (void)
+{
+  while (true)
+    {
+      WaitBarrier ();
+      if (m_finished)
+        {
+          break;
+        }
+      ProcessPartitions ();
+      WaitBarrier ();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsFinished (void) const
+{
+  return m_stop || (m_events->IsEmpty () && NextPartitionTs () == MAX_TS);
+}
+
+void
+MultithreadedSimulatorImpl::Run (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_partitions.empty ())
+    {
+      CreatePartitions ();
+    }
+  m_stop = false;
+
+  m_runningThreads = std::max<uint32_t> (1, std::min<uint32_t> (m_threadCount, m_partitions.size ()));
+#ifndef NS3_MULTITHREADED
+  if (m_runningThreads > 1)
+    {
+      NS_LOG_WARN ("ns-3 is not configured with --enable-multithreading, the partitions are executed by a single thread");
+      m_runningThreads = 1;
+    }
+#endif
+  m_finished = false;
+  for (uint32_t i = 1; i < m_runningThreads; i++)
+    {
+      Ptr<SystemThread> thread = Create<SystemThread> (MakeCallback (&MultithreadedSimulatorImpl::DoWork, this));
+      m_threads.push_back (thread);
+      thread->Start ();
+    }
+
+  while (!m_stop)
+    {
+      CollectGlobalMailboxes ();
+      uint64_t next = NextPartitionTs ();
+      uint64_t nextGlobal = m_events->IsEmpty () ? MAX_TS : m_events->PeekNext ().key.m_ts;
+      if (next == MAX_TS && nextGlobal == MAX_TS)
+        {
+          break;
+        }
+      if (nextGlobal <= next)
+        {
+          ProcessGlobalEvents (next);
+          continue;
+        }
+
+      m_windowEnd = (m_lookAhead == MAX_TS) ? MAX_TS : next + m_lookAhead;
+      m_windowEnd = std::min (m_windowEnd, nextGlobal);
+      m_generation ^= 1;
+      m_nextPartition = 0;
+      WaitBarrier ();
+      ProcessPartitions ();
+      WaitBarrier ();
+      m_windowCount++;
+    }
+
+  m_finished = true;
+  WaitBarrier ();
+  for (std::vector<Ptr<SystemThread> >::iterator i = m_threads.begin (); i != m_threads.end (); i++)
+    {
+      (*i)->Join ();
+    }
+  m_threads.clear ();
+  m_runningThreads = 1;
+
+  for (std::vector<Partition *>::iterator i = m_partitions.begin (); i != m_partitions.end (); i++)
+    {
+      m_currentTs = std::max (m_currentTs, (*i)->currentTs);
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Stop (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_stop = true;
+}
+
+void
+MultithreadedSimulatorImpl::Stop (Time const &time)
+{
+  NS_LOG_FUNCTION (this << time.GetTimeStep ());
+  Simulator::ScheduleWithContext (0xffffffff, time, &Simulator::Stop);
+}
+
+EventId
+MultithreadedSimulatorImpl::Schedule (Time const &time, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << time.GetTimeStep () << event);
+  NS_ASSERT (!time.IsStrictlyNegative ());
+
+  Partition *partition = g_partition;
+  Scheduler::Event ev;
+  ev.impl = event;
+  ev.key.m_ts = (partition != 0 ? partition->currentTs : m_currentTs) + time.GetTimeStep ();
+  ev.key.m_context = GetContext ();
+  Insert (partition, ev);
+  return EventId (event, ev.key.m_ts, ev.key.m_context, ev.key.m_uid);
+}
+
+void
+MultithreadedSimulatorImpl::ScheduleWithContext (uint32_t context, Time const &time, EventImpl *event)
+{
+  NS_LOG_FUNCTION (this << context << time.GetTimeStep () << event);
+  NS_ASSERT (!time.IsStrictlyNegative ());
+
+  Partition *partition = g_partition;
+  Partition *owner = GetOwner (context);
+  Scheduler::Event ev;
+  ev.impl = event;
+  ev.key.m_ts = (partition != 0 ? partition->currentTs : m_currentTs) + time.GetTimeStep ();
+  ev.key.m_context = context;
+
+  if (partition == 0)
+    {
+      // no partition is running
+      Insert (owner, ev);
+      m_windowEnd = std::min (m_windowEnd, ev.key.m_ts);
+    }
+  else if (owner == partition)
+    {
+      Insert (partition, ev);
+    }
+  else
+    {
+      if (ev.key.m_ts < m_windowEnd)
+        {
+          NS_FATAL_ERROR ("Event for context " << context << " scheduled " << time
+                          << " ahead from another partition, the lookahead is " << GetLookAhead ());
+        }
+      uint32_t destination = owner != 0 ? owner->id : m_partitions.size ();
+      partition->mailbox[m_generation][destination].push_back (ev);
+      partition->mailboxTs[m_generation][destination] =
+        std::min (partition->mailboxTs[m_generation][destination], ev.key.m_ts);
+      partition->remoteEvents++;
+    }
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleNow (EventImpl *event)
+{
+  return Schedule (TimeStep (0), event);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleDestroy (EventImpl *event)
+{
+  CriticalSection cs (m_destroyEventsMutex);
+  EventId id (Ptr<EventImpl> (event, false), Now ().GetTimeStep (), 0xffffffff, 2);
+  m_destroyEvents.push_back (id);
+  return id;
+}
+
+Time
+MultithreadedSimulatorImpl::Now (void) const
+{
+  // Do not add function logging here, to avoid stack overflow
+  Partition *partition = g_partition;
+  return TimeStep (partition != 0 ? partition->currentTs : m_currentTs);
+}
+
+Time
+MultithreadedSimulatorImpl::GetDelayLeft (const EventId &id) const
+{
+  if (IsExpired (id))
+    {
+      return TimeStep (0);
+    }
+  else
+    {
+      return TimeStep (id.GetTs ()) - Now ();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Remove (const EventId &id)
+{
+  if (id.GetUid () == 2)
+    {
+      // destroy events.
+      CriticalSection cs (m_destroyEventsMutex);
+      for (DestroyEvents::iterator i = m_destroyEvents.begin (); i != m_destroyEvents.end (); i++)
+        {
+          if (*i == id)
+            {
+              m_destroyEvents.erase (i);
+              break;
+            }
+        }
+      return;
+    }
+  if (IsExpired (id))
+    {
+      return;
+    }
+  Scheduler::Event event;
+  event.impl = id.PeekEventImpl ();
+  event.key.m_ts = id.GetTs ();
+  event.key.m_context = id.GetContext ();
+  event.key.m_uid = id.GetUid ();
+  GetEvents (id.GetContext ())->Remove (event);
+  event.impl->Cancel ();
+  // whenever we remove an event from the event list, we have to unref it.
+  event.impl->Unref ();
+}
+
+void
+MultithreadedSimulatorImpl::Cancel (const EventId &id)
+{
+  if (!IsExpired (id))
+    {
+      id.PeekEventImpl ()->Cancel ();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsExpired (const EventId &ev) const
+{
+  if (ev.GetUid () == 2)
+    {
+      if (ev.PeekEventImpl () == 0 ||
+          ev.PeekEventImpl ()->IsCancelled ())
+        {
+          return true;
+        }
+      // destroy events.
+      CriticalSection cs (const_cast<SystemMutex &> (m_destroyEventsMutex));
+      for (DestroyEvents::const_iterator i = m_destroyEvents.begin (); i != m_destroyEvents.end (); i++)
+        {
+          if (*i == ev)
+            {
+              return false;
+            }
+        }
+      return true;
+    }
+
+  if (ev.PeekEventImpl () == 0)
+    {
+      return true;
+    }
+  Partition *owner = GetOwner (ev.GetContext ());
+  NS_ASSERT_MSG (g_partition == 0 || owner == g_partition,
+                 "Event of context " << ev.GetContext () << " accessed from another partition");
+  uint64_t currentTs = owner != 0 ? owner->currentTs : m_currentTs;
+  uint32_t currentUid = owner != 0 ? owner->currentUid : m_currentUid;
+  if (ev.GetTs () < currentTs ||
+      (ev.GetTs () == currentTs &&
+       ev.GetUid () <= currentUid) ||
+      ev.PeekEventImpl ()->IsCancelled ())
+    {
+      return true;
+    }
+  else
+    {
+      return false;
+    }
+}
+
+Time
+MultithreadedSimulatorImpl::GetMaximumSimulationTime (void) const
+{
+  return TimeStep (0x7fffffffffffffffLL);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetContext (void) const
+{
+  Partition *partition = g_partition;
+  return partition != 0 ? partition->currentContext : m_currentContext;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetPartitionCount (void) const
+{
+  return m_partitions.size ();
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetPartition (uint32_t nodeId) const
+{
+  if (nodeId < m_nodePartition.size ())
+    {
+      return m_nodePartition[nodeId];
+    }
+  return m_partitions.size ();
+}
+
+Time
+MultithreadedSimulatorImpl::GetLookAhead (void) const
+{
+  return m_lookAhead == MAX_TS ? GetMaximumSimulationTime () : TimeStep (m_lookAhead);
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetWindowCount (void) const
+{
+  return m_windowCount;
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetRemoteEventCount (void) const
+{
+  uint64_t count = 0;
+  for (std::vector<Partition *>::const_iterator i = m_partitions.begin (); i != m_partitions.end (); i++)
+    {
+      count += (*i)->remoteEvents;
+    }
+  return count;
+}
+
+} // namespace ns3
@@ -0,0 +1,213 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef NS3_MULTITHREADED_SIMULATOR_IMPL_H
+#define NS3_MULTITHREADED_SIMULATOR_IMPL_H
+
+#include "ns3/simulator-impl.h"
+#include "ns3/scheduler.h"
+#include "ns3/event-impl.h"
+#include "ns3/object-factory.h"
+#include "ns3/system-mutex.h"
+#include "ns3/system-thread.h"
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+
+#include <list>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup simulator
+ * \ingroup mpi
+ *
+ * \brief Conservative parallel simulator running the partitions of the topology in
+ * the worker threads of a single process
+ *
+ * The nodes are divided into partitions, each with its own scheduler.  If the nodes
+ * have different system ids (NodeContainer::Create (n, systemId)), the system id is
+ * used as the partition number.  Otherwise PartitionCount partitions are formed from
+ * contiguous regions of the topology.  Nodes connected by a channel that does not
+ * provide a lookahead (neither a "Delay" nor a "LookAhead" attribute, e.g., a wifi
+ * channel) are always placed in the same partition.
+ *
+ * The lookahead is the smallest delay of the channels connecting different
+ * partitions.  The simulation advances in windows [lbts, lbts + lookahead), lbts
+ * being the earliest pending event: within a window the ThreadCount worker threads
+ * execute the partitions independently.  An event scheduled for a node of another
+ * partition (e.g., the packet reception scheduled by PointToPointChannel) is appended,
+ * together with its packet, to the mailbox of the sending partition which is not
+ * accessed by any other thread before the end of the window; the receiving partition
+ * collects its mailboxes at the start of the next window, in the order of the sending
+ * partitions.  The results therefore only depend on the partitioning and not on the
+ * number of threads or their scheduling.
+ *
+ * Events without a node context (scheduled from main () or by other such events,
+ * e.g., periodic tracer output, link failures, Simulator::Stop (time)) are executed
+ * between the windows, while no partition runs, and may access any node.  At equal
+ * timestamps they are executed before the events of the partitions.
+ *
+ * Limitations:
+ *  - the reference counts and the copy-on-write packet buffers are only safe to share
+ *    between threads if ns-3 is configured with --enable-multithreading.  Other builds
+ *    run the partitions one after another in the calling thread, whatever ThreadCount;
+ *  - a model must not access the objects of another node directly from an event of
+ *    its own node (only through channels with lookahead), and tracers that write to a
+ *    common stream from node events (e.g., ndn::AppDelayTracer) interleave their output;
+ *  - Simulator::Stop () called from a node event stops every partition after its
+ *    current event, and events without a node context (including Simulator::Stop (time))
+ *    may only be scheduled from node events at least one lookahead ahead;
+ *  - the partitioning is done when Simulator::Run is called for the first time, nodes
+ *    created later run as part of the events without a node context;
+ *  - Packet uids are unique, but not reproducible between runs with several threads.
+ */
+class MultithreadedSimulatorImpl : public SimulatorImpl
+{
+public:
+  static TypeId GetTypeId (void);
+
+  MultithreadedSimulatorImpl ();
+  ~MultithreadedSimulatorImpl ();
+
+  // virtual from SimulatorImpl
+  virtual void Destroy ();
+  virtual bool IsFinished (void) const;
+  virtual void Stop (void);
+  virtual void Stop (Time const &time);
+  virtual EventId Schedule (Time const &time, EventImpl *event);
+  virtual void ScheduleWithContext (uint32_t context, Time const &time, EventImpl *event);
+  virtual EventId ScheduleNow (EventImpl *event);
+  virtual EventId ScheduleDestroy (EventImpl *event);
+  virtual void Remove (const EventId &ev);
+  virtual void Cancel (const EventId &ev);
+  virtual bool IsExpired (const EventId &ev) const;
+  virtual void Run (void);
+  virtual Time Now (void) const;
+  virtual Time GetDelayLeft (const EventId &id) const;
+  virtual Time GetMaximumSimulationTime (void) const;
+  virtual void SetScheduler (ObjectFactory schedulerFactory);
+  virtual uint32_t GetSystemId (void) const;
+  virtual uint32_t GetContext (void) const;
+
+  /**
+   * \returns the number of partitions (zero before Simulator::Run)
+   */
+  uint32_t GetPartitionCount (void) const;
+
+  /**
+   * \param nodeId node id
+   * \returns the partition of the node, or GetPartitionCount () if the node runs as
+   *          part of the events without a node context
+   */
+  uint32_t GetPartition (uint32_t nodeId) const;
+
+  /**
+   * \returns the lookahead between the partitions
+   */
+  Time GetLookAhead (void) const;
+
+  /**
+   * \returns the number of windows executed so far
+   */
+  uint64_t GetWindowCount (void) const;
+
+  /**
+   * \returns the number of events exchanged between the partitions so far
+   */
+  uint64_t GetRemoteEventCount (void) const;
+
+private:
+  virtual void DoDispose (void);
+
+  /**
+   * \brief State of one partition, only accessed by the thread executing it
+   */
+  struct Partition
+  {
+    uint32_t id;
+    Ptr<Scheduler> events;
+    uint32_t uid;
+    uint32_t currentUid;
+    uint64_t currentTs;
+    uint32_t currentContext;
+    /**
+     * Events for the other partitions scheduled in the current window (index by the
+     * destination partition, the last mailbox is for the events without a node context),
+     * two generations of mailboxes being used alternately
+     */
+    std::vector<std::vector<Scheduler::Event> > mailbox[2];
+    std::vector<uint64_t> mailboxTs[2]; ///< \brief Earliest event of each mailbox
+    uint64_t remoteEvents;
+  };
+
+  void CreatePartitions (void);
+  void AssignPartitions (std::vector<uint32_t> &partitions, uint32_t count) const;
+  void CalculateLookAhead (void);
+
+  Partition *GetOwner (uint32_t context) const;
+  Ptr<Scheduler> GetEvents (uint32_t context) const;
+  void Insert (Partition *partition, Scheduler::Event &ev);
+
+  uint64_t NextPartitionTs (void) const;
+  void ProcessGlobalEvents (uint64_t ts);
+  void CollectGlobalMailboxes (void);
+  void ProcessPartitions (void);
+  void ProcessPartition (Partition *partition);
+  void DoWork (void);
+  void WaitBarrier (void);
+
+  typedef std::list<EventId> DestroyEvents;
+
+  DestroyEvents m_destroyEvents;
+  SystemMutex m_destroyEventsMutex;
+  ObjectFactory m_schedulerFactory;
+
+  // events without a node context, and all events before the first Run
+  Ptr<Scheduler> m_events;
+  uint32_t m_uid;
+  uint32_t m_currentUid;
+  uint64_t m_currentTs;
+  uint32_t m_currentContext;
+  bool m_stop;
+
+  uint32_t m_threadCount;
+  uint32_t m_partitionCount;
+  std::vector<Partition *> m_partitions;
+  std::vector<uint32_t> m_nodePartition;
+  uint64_t m_lookAhead;
+  uint64_t m_windowCount;
+
+  // window state, written while the worker threads wait at the barrier
+  uint64_t m_windowEnd;
+  uint32_t m_generation;
+  uint32_t m_nextPartition;
+  bool m_finished;
+  std::vector<Ptr<SystemThread> > m_threads;
+  uint32_t m_runningThreads;
+  uint32_t m_barrierCount;
+  volatile uint32_t m_barrierGeneration;
+
+  static __thread Partition *g_partition; ///< \brief Partition executed by the current thread
+};
+
+} // namespace ns3
+
+#endif /* NS3_MULTITHREADED_SIMULATOR_IMPL_H */
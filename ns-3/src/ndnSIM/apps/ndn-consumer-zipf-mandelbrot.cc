@@ -27,6 +27,7 @@
 #include "ns3/ndnSIM/utils/ndn-fw-hop-count-tag.h"
 
 #include <math.h>
+#include <algorithm>
 
 
 NS_LOG_COMPONENT_DEFINE ("ndn.ConsumerZipfMandelbrot");
@@ -198,7 +199,7 @@ ConsumerZipfMandelbrot::SendPacket() {
   m_rtt->SentSeq (SequenceNumber32 (seq), 1);
 
   FwHopCountTag hopCountTag;
-  interest->GetPayload ()->AddPacketTag (hopCountTag);
+  interest->GetPayload ()->AddTypedTag (hopCountTag);
 
   m_transmittedInterests (interest, this, m_face);
   m_face->ReceiveInterest (interest);
@@ -211,7 +212,6 @@ uint32_t
 ConsumerZipfMandelbrot::GetNextSeq()
 {
   uint32_t content_index = 1; //[1, m_N]
-  double p_sum = 0;
 
   double p_random = m_SeqRng.GetValue();
   while (p_random == 0)
@@ -220,15 +220,13 @@ ConsumerZipfMandelbrot::GetNextSeq()
     }
   //if (p_random == 0)
   NS_LOG_LOGIC("p_random="<<p_random);
-  for (uint32_t i=1; i<=m_N; i++)
+  // first i such that p_random <= m_Pcum[i]
+  // (m_Pcum[i] = m_Pcum[i-1] + p[i], p[0] = 0;   e.g.: p_cum[1] = p[1], p_cum[2] = p[1] + p[2])
+  std::vector<double>::const_iterator p_sum = std::lower_bound (m_Pcum.begin () + 1, m_Pcum.end (), p_random);
+  if (p_sum != m_Pcum.end ())
     {
-      p_sum = m_Pcum[i];   //m_Pcum[i] = m_Pcum[i-1] + p[i], p[0] = 0;   e.g.: p_cum[1] = p[1], p_cum[2] = p[1] + p[2]
-      if (p_random <= p_sum)
-        {
-          content_index = i;
-          break;
-        } //if
-    } //for
+      content_index = p_sum - m_Pcum.begin ();
+    }
   //content_index = 1;
   NS_LOG_DEBUG("RandomNumber="<<content_index);
   return content_index;
@@ -209,7 +209,7 @@ Consumer::SendPacket ()
   WillSendOutInterest (seq);  
 
   FwHopCountTag hopCountTag;
-  interest->GetPayload ()->AddPacketTag (hopCountTag);
+  interest->GetPayload ()->AddTypedTag (hopCountTag);
 
   m_transmittedInterests (interest, this, m_face);
   m_face->ReceiveInterest (interest);
@@ -238,7 +238,7 @@ Consumer::OnData (Ptr<const Data> data)
 
   int hopCount = -1;
   FwHopCountTag hopCountTag;
-  if (data->GetPayload ()->PeekPacketTag (hopCountTag))
+  if (data->GetPayload ()->PeekTypedTag (hopCountTag))
     {
       hopCount = hopCountTag.Get ();
     }
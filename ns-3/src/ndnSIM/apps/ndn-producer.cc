@@ -96,6 +96,16 @@ Producer::StartApplication ()
 
   NS_LOG_DEBUG ("NodeID: " << GetNode ()->GetId ());
 
+  // Payload is a zero-filled packet, which ns-3 represents only by its size (zero area of the
+  // buffer), so payload bytes are never allocated, neither here nor in copies of the packet
+  m_dataTemplate = Create<Data> (Create<Packet> (m_virtualPayloadSize));
+  m_dataTemplate->SetFreshness (m_freshness);
+  m_dataTemplate->SetSignature (m_signature);
+  if (m_keyLocator.size () > 0)
+    {
+      m_dataTemplate->SetKeyLocator (Create<Name> (m_keyLocator));
+    }
+
   Ptr<Fib> fib = GetNode ()->GetObject<Fib> ();
 
   Ptr<fib::Entry> fibEntry = fib->Add (m_prefix, m_face, 0);
@@ -127,26 +137,19 @@ Producer::OnInterest (Ptr<const Interest> interest)
 
   if (!m_active) return;
 
-  Ptr<Data> data = Create<Data> (Create<Packet> (m_virtualPayloadSize));
+  Ptr<Data> data = Create<Data> (*m_dataTemplate);
   Ptr<Name> dataName = Create<Name> (interest->GetName ());
   dataName->append (m_postfix);
   data->SetName (dataName);
-  data->SetFreshness (m_freshness);
   data->SetTimestamp (Simulator::Now());
 
-  data->SetSignature (m_signature);
-  if (m_keyLocator.size () > 0)
-    {
-      data->SetKeyLocator (Create<Name> (m_keyLocator));
-    }
-
   NS_LOG_INFO ("node("<< GetNode()->GetId() <<") respodning with Data: " << data->GetName ());
 
   // Echo back FwHopCountTag if exists
   FwHopCountTag hopCountTag;
-  if (interest->GetPayload ()->PeekPacketTag (hopCountTag))
+  if (interest->GetPayload ()->PeekTypedTag (hopCountTag))
     {
-      data->GetPayload ()->AddPacketTag (hopCountTag);
+      data->GetPayload ()->AddTypedTag (hopCountTag);
     }
 
   m_face->ReceiveData (data);
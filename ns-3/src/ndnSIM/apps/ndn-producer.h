@@ -67,6 +67,8 @@ private:
 
   uint32_t m_signature;
   Name m_keyLocator;
+
+  Ptr<Data> m_dataTemplate; ///< @brief Data packet with all fields that do not depend on the Interest, created in StartApplication
 };
 
 } // namespace ndn
@@ -48,8 +48,8 @@ CustomStrategy::DoPropagateInterest (Ptr<Face> inFace,
                                      Ptr<pit::Entry> pitEntry)
 {
   typedef fib::FaceMetricContainer::type::index<fib::i_metric>::type FacesByMetric;
-  FacesByMetric &faces = pitEntry->GetFibEntry ()->m_faces.get<fib::i_metric> ();
-  FacesByMetric::iterator faceIterator = faces.begin ();
+  const FacesByMetric &faces = pitEntry->GetFibEntry ()->m_faces.get<fib::i_metric> ();
+  FacesByMetric::const_iterator faceIterator = faces.begin ();
 
   int propagatedCount = 0;
 
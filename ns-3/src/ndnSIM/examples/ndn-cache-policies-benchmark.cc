@@ -0,0 +1,167 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+// ndn-cache-policies-benchmark.cc
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/ndnSIM/apps/ndn-consumer-zipf-mandelbrot.h"
+
+#include <boost/lexical_cast.hpp>
+
+#include <iomanip>
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * Benchmark of the content store replacement policies, without the forwarding plane.
+ *
+ * A stream of requests is generated with the same distribution as the Interests of
+ * ConsumerZipfMandelbrot, then replayed against a content store of every listed policy:
+ * every request is looked up in the content store, and on a miss, the Data is added to it
+ * (as the forwarder does when the Data comes back).  For each policy, the benchmark reports
+ * the hit ratio, the byte hit ratio and the number of requests replayed per second.
+ *
+ * To run the benchmark, use:
+ *
+ *     ./waf --run="ndn-cache-policies-benchmark --contents=10000 --requests=1000000 --size=100"
+ *
+ * Content stores limited by their size in bytes (ns3::ndn::cs::Bytes::*) are benchmarked with
+ * Data packets of different sizes, e.g.:
+ *
+ *     ./waf --run="ndn-cache-policies-benchmark --size=0 --max-bytes=1000000 --payload-sizes=100,1000,10000
+ *                  --policies=Bytes::Lru,Bytes::Fifo,Bytes::Random,Bytes::Lfu,Bytes::Gdsf"
+ */
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t contents = 10000;
+  uint32_t requests = 1000000;
+  uint32_t size = 100;
+  uint64_t maxBytes = 1000000;
+  std::string payloadSizes = "1024";
+  double q = 0.7;
+  double s = 0.7;
+  std::string policies = "Lru,Fifo,Random,Lfu,TinyLfu,Arc,S3Fifo";
+
+  CommandLine cmd;
+  cmd.AddValue ("contents", "Number of different contents (ConsumerZipfMandelbrot::NumberOfContents)", contents);
+  cmd.AddValue ("requests", "Number of requests in the stream", requests);
+  cmd.AddValue ("size", "Maximum number of entries in the content store (MaxSize)", size);
+  cmd.AddValue ("max-bytes", "Maximum size of the Bytes::* content stores in bytes (MaxBytes)", maxBytes);
+  cmd.AddValue ("payload-sizes", "Comma-separated list of payload sizes, assigned to the contents in round robin", payloadSizes);
+  cmd.AddValue ("q", "Parameter q of the Zipf-Mandelbrot distribution", q);
+  cmd.AddValue ("s", "Parameter s of the Zipf-Mandelbrot distribution", s);
+  cmd.AddValue ("policies", "Comma-separated list of the ns3::ndn::cs types to benchmark", policies);
+  cmd.Parse (argc, argv);
+
+  Ptr<ndn::ConsumerZipfMandelbrot> consumer = CreateObject<ndn::ConsumerZipfMandelbrot> ();
+  consumer->SetAttribute ("NumberOfContents", UintegerValue (contents));
+  consumer->SetAttribute ("q", DoubleValue (q));
+  consumer->SetAttribute ("s", DoubleValue (s));
+
+  std::vector<uint32_t> stream (requests);
+  for (uint32_t i = 0; i < requests; i++)
+    {
+      stream[i] = consumer->GetNextSeq ();
+    }
+
+  std::vector<uint32_t> sizes;
+  std::istringstream sizesList (payloadSizes);
+  std::string payloadSize;
+  while (std::getline (sizesList, payloadSize, ','))
+    {
+      sizes.push_back (boost::lexical_cast<uint32_t> (payloadSize));
+    }
+
+  // Interests and Data are created (and Data encoded) once, so that only the content store is measured
+  std::vector< Ptr<ndn::Interest> > interests (contents + 1);
+  std::vector< Ptr<ndn::Data> > data (contents + 1);
+  std::vector<uint32_t> wireSizes (contents + 1);
+  for (uint32_t seq = 1; seq <= contents; seq++)
+    {
+      Ptr<ndn::Name> name = Create<ndn::Name> ("/prefix");
+      name->appendSeqNum (seq);
+
+      interests[seq] = Create<ndn::Interest> ();
+      interests[seq]->SetName (name);
+
+      data[seq] = Create<ndn::Data> (Create<Packet> (sizes[seq % sizes.size ()]));
+      data[seq]->SetName (name);
+      wireSizes[seq] = ndn::Wire::FromData (data[seq])->GetSize ();
+    }
+
+  std::cout << "contents=" << contents
+            << " requests=" << requests
+            << " size=" << size
+            << " max-bytes=" << maxBytes
+            << " payload-sizes=" << payloadSizes
+            << " q=" << q
+            << " s=" << s << std::endl;
+  std::cout << std::setw (16) << std::left << "policy" << std::right
+            << std::setw (12) << "hit-ratio"
+            << std::setw (12) << "byte-hits"
+            << std::setw (16) << "lookups/s" << std::endl;
+
+  std::istringstream list (policies);
+  std::string policy;
+  while (std::getline (list, policy, ','))
+    {
+      ObjectFactory factory;
+      factory.SetTypeId ("ns3::ndn::cs::" + policy);
+      factory.Set ("MaxSize", StringValue (boost::lexical_cast<std::string> (size)));
+      if (policy.compare (0, 7, "Bytes::") == 0)
+        {
+          factory.Set ("MaxBytes", UintegerValue (maxBytes));
+        }
+      Ptr<ndn::ContentStore> cs = factory.Create<ndn::ContentStore> ();
+
+      uint32_t hits = 0;
+      uint64_t hitBytes = 0;
+      uint64_t totalBytes = 0;
+      SystemWallClockMs clock;
+      clock.Start ();
+      for (std::vector<uint32_t>::const_iterator seq = stream.begin (); seq != stream.end (); seq++)
+        {
+          totalBytes += wireSizes[*seq];
+          if (cs->Lookup (interests[*seq]) != 0)
+            {
+              hits ++;
+              hitBytes += wireSizes[*seq];
+            }
+          else
+            {
+              cs->Add (data[*seq]);
+            }
+        }
+      int64_t elapsed = clock.End ();
+
+      std::cout << std::setw (16) << std::left << policy << std::right
+                << std::setw (12) << std::fixed << std::setprecision (4) << 1.0 * hits / requests
+                << std::setw (12) << 1.0 * hitBytes / totalBytes
+                << std::setw (16) << std::setprecision (0) << (elapsed == 0 ? 0 : 1000.0 * requests / elapsed)
+                << std::endl;
+    }
+
+  Simulator::Destroy ();
+
+  return 0;
+}
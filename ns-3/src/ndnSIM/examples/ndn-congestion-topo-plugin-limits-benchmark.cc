@@ -0,0 +1,151 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+// ndn-congestion-topo-plugin-limits-benchmark.cc
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <boost/lexical_cast.hpp>
+
+using namespace ns3;
+
+/**
+ * Benchmark of the Interest rate limits (ns3::ndn::Limits::Rate) on the topology of
+ * ndn-congestion-topo-plugin, replicated `copies' times:
+ *
+ *   /------\	                                                 /------\
+ *   | Src1 |<--+                                            +-->| Dst1 |
+ *   \------/    \                                          /    \------/
+ *            	 \                                        /
+ *                 +-->/------\   "bottleneck"  /------\<-+
+ *                     | Rtr1 |<===============>| Rtr2 |
+ *                 +-->\------/                 \------/<-+
+ *                /                                        \
+ *   /------\    /                                          \    /------\
+ *   | Src2 |<--+                                            +-->| Dst2 |
+ *   \------/                                                    \------/
+ *
+ * Every copy has its own pair of prefixes.  Consumers request data at a rate exceeding the
+ * bottleneck capacity, so PerOutFaceLimits strategy actively uses the token buckets.
+ *
+ * To run the benchmark, use:
+ *
+ *     ./waf --run="ndn-congestion-topo-plugin-limits-benchmark --copies=200 --stop=20"
+ */
+
+static uint32_t g_satisfied = 0;
+
+static void
+SatisfiedInterest (Ptr<ndn::App> app, uint32_t seqno, Time delay, uint32_t retxCount, int32_t hopCount)
+{
+  g_satisfied ++;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t copies = 1;
+  double stop = 20.0;
+  std::string frequency = "200";
+
+  Config::SetDefault ("ns3::PointToPointChannel::Delay", StringValue ("10ms"));
+  Config::SetDefault ("ns3::DropTailQueue::MaxPackets", StringValue ("20"));
+
+  CommandLine cmd;
+  cmd.AddValue ("copies", "Number of copies of the 6-node topology", copies);
+  cmd.AddValue ("stop", "Simulation time, seconds", stop);
+  cmd.AddValue ("frequency", "Interest frequency of each consumer", frequency);
+  cmd.Parse (argc, argv);
+
+  PointToPointHelper access;
+  access.SetDeviceAttribute ("DataRate", StringValue ("10Mbps"));
+  PointToPointHelper bottleneck;
+  bottleneck.SetDeviceAttribute ("DataRate", StringValue ("1Mbps"));
+
+  NodeContainer consumers;
+  NodeContainer producers;
+
+  for (uint32_t copy = 0; copy < copies; copy++)
+    {
+      NodeContainer nodes;
+      nodes.Create (6); // Src1, Src2, Rtr1, Rtr2, Dst1, Dst2
+
+      access.Install (nodes.Get (0), nodes.Get (2));
+      access.Install (nodes.Get (1), nodes.Get (2));
+      bottleneck.Install (nodes.Get (2), nodes.Get (3));
+      access.Install (nodes.Get (4), nodes.Get (3));
+      access.Install (nodes.Get (5), nodes.Get (3));
+
+      consumers.Add (nodes.Get (0));
+      consumers.Add (nodes.Get (1));
+      producers.Add (nodes.Get (4));
+      producers.Add (nodes.Get (5));
+    }
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetForwardingStrategy ("ns3::ndn::fw::BestRoute::PerOutFaceLimits",
+                                   "Limit", "ns3::ndn::Limits::Rate");
+  ndnHelper.EnableLimits (true, Seconds (0.1), 1100, 40);
+  ndnHelper.SetContentStore ("ns3::ndn::cs::Lru",
+                             "MaxSize", "10000");
+  ndnHelper.InstallAll ();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll ();
+
+  for (uint32_t i = 0; i < consumers.GetN (); i++)
+    {
+      std::string prefix = "/dst" + boost::lexical_cast<std::string> (i);
+
+      ndn::AppHelper consumerHelper ("ns3::ndn::ConsumerCbr");
+      consumerHelper.SetAttribute ("Frequency", StringValue (frequency));
+      consumerHelper.SetPrefix (prefix);
+      consumerHelper.Install (consumers.Get (i));
+
+      ndn::AppHelper producerHelper ("ns3::ndn::Producer");
+      producerHelper.SetAttribute ("PayloadSize", StringValue("1024"));
+      producerHelper.SetPrefix (prefix);
+      producerHelper.Install (producers.Get (i));
+
+      ndnGlobalRoutingHelper.AddOrigins (prefix, producers.Get (i));
+    }
+
+  ndn::GlobalRoutingHelper::CalculateRoutes ();
+
+  Config::ConnectWithoutContext ("/NodeList/*/ApplicationList/*/FirstInterestDataDelay",
+                                 MakeCallback (&SatisfiedInterest));
+
+  Simulator::Stop (Seconds (stop));
+
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t elapsed = clock.End ();
+
+  std::cout << "copies=" << copies
+            << " nodes=" << NodeList::GetNNodes ()
+            << " satisfied=" << g_satisfied
+            << " wall-ms=" << elapsed << std::endl;
+
+  Simulator::Destroy ();
+
+  return 0;
+}
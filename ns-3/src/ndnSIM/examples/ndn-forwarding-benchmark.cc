@@ -0,0 +1,493 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+// ndn-forwarding-benchmark.cc
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/ndnSIM/model/pit/ndn-pit-impl.h"
+#include "ns3/ndnSIM/model/cs/content-store-impl.h"
+#include "ns3/ndnSIM/model/fib/ndn-fib-impl.h"
+#include "ns3/ndnSIM/utils/trie/persistent-policy.h"
+#include "ns3/ndnSIM/utils/trie/lru-policy.h"
+#include "ns3/ndnSIM/utils/ndn-limits.h"
+#include "ns3/ndnSIM/utils/mem-usage.h"
+
+#include <boost/lexical_cast.hpp>
+
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <time.h>
+
+using namespace ns3;
+
+/**
+ * Microbenchmark of the forwarding strategies.
+ *
+ * A single node with a number of synthetic faces (packets sent out are encoded and dropped)
+ * is driven directly through the faces, without channels or applications.  The first half
+ * of the faces receives Interests, the second half is used as next hops of the FIB entries
+ * and receives Data packets.  For every strategy, the benchmark reports the CPU time per
+ * packet and its breakdown by PIT lookup/insertion, content store lookup/insertion, FIB
+ * longest prefix match, face send (encoding of the outgoing packets) and the rest of the
+ * forwarding strategy processing.
+ *
+ * The breakdown is measured by timing subclasses of the default PIT, content store
+ * (ns3::ndn::cs::Lru) and FIB implementations, installed on the node.  Each timed call
+ * costs in addition about two clock reads, reported as the timer overhead.  The growth of
+ * the resident memory during the replay (PIT and content store state) is reported in MB.
+ *
+ * GreenYellowRed and Nacks are parents of BestRoute (NACKs are enabled with --nacks),
+ * and limit strategies are available as <strategy>::PerOutFaceLimits and
+ * <strategy>::PerOutFaceLimits::PerFibLimits (the synthetic faces are not limited).
+ *
+ * By default, the packet stream is synthetic: Interests for contents uniformly chosen
+ * among --contents names under --prefixes prefixes, each answered by a Data packet after
+ * --window other Interests.  A recorded stream can be supplied with --trace, as a file with
+ * lines "interest <face> <name>" or "data <face> <name>".
+ *
+ * To run the benchmark, use:
+ *
+ *     ./waf --run="ndn-forwarding-benchmark --faces=8 --prefixes=1000 --interests=100000"
+ *     ./waf --run="ndn-forwarding-benchmark --strategies=ns3::ndn::fw::BestRoute --nacks=1"
+ */
+
+static uint64_t
+NowNs ()
+{
+  struct timespec now;
+  clock_gettime (CLOCK_MONOTONIC, &now);
+  return static_cast<uint64_t> (now.tv_sec) * 1000000000 + now.tv_nsec;
+}
+
+/**
+ * Time spent in each component, in nanoseconds
+ */
+struct Breakdown
+{
+  uint64_t pit;
+  uint64_t cs;
+  uint64_t fib;
+  uint64_t send;
+  uint64_t calls;
+};
+
+static Breakdown g_breakdown;
+
+namespace ns3 {
+
+/**
+ * Synthetic face: packets are encoded and dropped
+ */
+class TimedFace : public ndn::Face
+{
+public:
+  TimedFace (Ptr<Node> node)
+    : ndn::Face (node)
+  {
+  }
+
+  virtual bool
+  SendInterest (Ptr<const ndn::Interest> interest)
+  {
+    uint64_t start = NowNs ();
+    bool ok = ndn::Face::SendInterest (interest);
+    g_breakdown.send += NowNs () - start;
+    g_breakdown.calls ++;
+    return ok;
+  }
+
+  virtual bool
+  SendData (Ptr<const ndn::Data> data)
+  {
+    uint64_t start = NowNs ();
+    bool ok = ndn::Face::SendData (data);
+    g_breakdown.send += NowNs () - start;
+    g_breakdown.calls ++;
+    return ok;
+  }
+
+  virtual std::ostream&
+  Print (std::ostream &os) const
+  {
+    return os << "dev=timed(" << GetId () << ")";
+  }
+};
+
+class TimedPit : public ndn::pit::PitImpl<ndn::ndnSIM::persistent_policy_traits>
+{
+public:
+  typedef ndn::pit::PitImpl<ndn::ndnSIM::persistent_policy_traits> super;
+
+  static TypeId
+  GetTypeId ()
+  {
+    static TypeId tid = TypeId ("ns3::ndn::pit::Timed")
+      .SetGroupName ("Ndn")
+      .SetParent<super> ()
+      .AddConstructor<TimedPit> ()
+      ;
+    return tid;
+  }
+
+  virtual Ptr<ndn::pit::Entry>
+  Lookup (const ndn::Data &header)
+  {
+    uint64_t start = NowNs ();
+    Ptr<ndn::pit::Entry> entry = super::Lookup (header);
+    g_breakdown.pit += NowNs () - start;
+    g_breakdown.calls ++;
+    return entry;
+  }
+
+  virtual std::vector< Ptr<ndn::pit::Entry> >
+  LookupAll (const ndn::Data &header)
+  {
+    uint64_t start = NowNs ();
+    std::vector< Ptr<ndn::pit::Entry> > entries = super::LookupAll (header);
+    g_breakdown.pit += NowNs () - start;
+    g_breakdown.calls ++;
+    return entries;
+  }
+
+  virtual Ptr<ndn::pit::Entry>
+  Lookup (const ndn::Interest &header)
+  {
+    uint64_t start = NowNs ();
+    Ptr<ndn::pit::Entry> entry = super::Lookup (header);
+    g_breakdown.pit += NowNs () - start;
+    g_breakdown.calls ++;
+    return entry;
+  }
+
+  virtual Ptr<ndn::pit::Entry>
+  Create (Ptr<const ndn::Interest> header)
+  {
+    // FIB lookup is done from inside PIT entry creation and accounted separately
+    uint64_t fib = g_breakdown.fib;
+    uint64_t start = NowNs ();
+    Ptr<ndn::pit::Entry> entry = super::Create (header);
+    g_breakdown.pit += NowNs () - start - (g_breakdown.fib - fib);
+    g_breakdown.calls ++;
+    return entry;
+  }
+};
+
+class TimedContentStore : public ndn::cs::ContentStoreImpl<ndn::ndnSIM::lru_policy_traits>
+{
+public:
+  typedef ndn::cs::ContentStoreImpl<ndn::ndnSIM::lru_policy_traits> super;
+
+  static TypeId
+  GetTypeId ()
+  {
+    static TypeId tid = TypeId ("ns3::ndn::cs::Timed")
+      .SetGroupName ("Ndn")
+      .SetParent<super> ()
+      .AddConstructor<TimedContentStore> ()
+      ;
+    return tid;
+  }
+
+  virtual Ptr<ndn::Data>
+  Lookup (Ptr<const ndn::Interest> interest)
+  {
+    uint64_t start = NowNs ();
+    Ptr<ndn::Data> data = super::Lookup (interest);
+    g_breakdown.cs += NowNs () - start;
+    g_breakdown.calls ++;
+    return data;
+  }
+
+  virtual bool
+  Add (Ptr<const ndn::Data> data)
+  {
+    uint64_t start = NowNs ();
+    bool added = super::Add (data);
+    g_breakdown.cs += NowNs () - start;
+    g_breakdown.calls ++;
+    return added;
+  }
+};
+
+class TimedFib : public ndn::fib::FibImpl
+{
+public:
+  static TypeId
+  GetTypeId ()
+  {
+    static TypeId tid = TypeId ("ns3::ndn::fib::Timed")
+      .SetGroupName ("Ndn")
+      .SetParent<ndn::fib::FibImpl> ()
+      .AddConstructor<TimedFib> ()
+      ;
+    return tid;
+  }
+
+  virtual Ptr<ndn::fib::Entry>
+  LongestPrefixMatch (const ndn::Interest &interest)
+  {
+    uint64_t start = NowNs ();
+    Ptr<ndn::fib::Entry> entry = ndn::fib::FibImpl::LongestPrefixMatch (interest);
+    g_breakdown.fib += NowNs () - start;
+    g_breakdown.calls ++;
+    return entry;
+  }
+};
+
+NS_OBJECT_ENSURE_REGISTERED (TimedPit);
+NS_OBJECT_ENSURE_REGISTERED (TimedContentStore);
+NS_OBJECT_ENSURE_REGISTERED (TimedFib);
+
+} // namespace ns3
+
+/**
+ * Packet received on one of the faces
+ */
+struct Event
+{
+  Ptr<ndn::Face> face;
+  Ptr<ndn::Interest> interest;
+  Ptr<ndn::Data> data;
+};
+
+static Ptr<ndn::Name>
+ContentName (uint32_t content, uint32_t prefixes)
+{
+  Ptr<ndn::Name> name = Create<ndn::Name> ();
+  name->append ("prefix-" + boost::lexical_cast<std::string> (content % prefixes));
+  name->appendSeqNum (content);
+  return name;
+}
+
+static Ptr<ndn::Interest>
+MakeInterest (Ptr<ndn::Name> name, Ptr<UniformRandomVariable> nonce)
+{
+  Ptr<ndn::Interest> interest = Create<ndn::Interest> ();
+  interest->SetName (name);
+  interest->SetNonce (nonce->GetInteger (0, std::numeric_limits<uint32_t>::max ()));
+  interest->SetInterestLifetime (Seconds (4));
+  return interest;
+}
+
+static Ptr<ndn::Data>
+MakeData (Ptr<ndn::Name> name, uint32_t payloadSize)
+{
+  Ptr<ndn::Data> data = Create<ndn::Data> (Create<Packet> (payloadSize));
+  data->SetName (name);
+  return data;
+}
+
+static void
+Replay (const std::vector<Event> *events, int64_t *elapsed, int64_t *memory)
+{
+  g_breakdown = Breakdown ();
+  *memory = MemUsage::Get ();
+
+  uint64_t start = NowNs ();
+  for (std::vector<Event>::const_iterator event = events->begin (); event != events->end (); event++)
+    {
+      if (event->interest != 0)
+        {
+          event->face->ReceiveInterest (event->interest);
+        }
+      else
+        {
+          event->face->ReceiveData (event->data);
+        }
+    }
+  *elapsed = NowNs () - start;
+  *memory = MemUsage::Get () - *memory;
+
+  // do not process expiration of the pending Interests
+  Simulator::Stop ();
+}
+
+int
+main (int argc, char *argv[])
+{
+  std::string strategies = "ns3::ndn::fw::BestRoute,ns3::ndn::fw::Flooding,ns3::ndn::fw::SmartFlooding,"
+    "ns3::ndn::fw::BestRoute::PerOutFaceLimits,ns3::ndn::fw::BestRoute::PerOutFaceLimits::PerFibLimits";
+  uint32_t faces = 8;
+  uint32_t prefixes = 1000;
+  uint32_t nextHops = 2;
+  uint32_t interests = 100000;
+  uint32_t contents = 10000;
+  uint32_t window = 100;
+  uint32_t payloadSize = 1024;
+  std::string csSize = "1000";
+  uint32_t pitSize = 0;
+  bool nacks = false;
+  std::string trace;
+
+  CommandLine cmd;
+  cmd.AddValue ("strategies", "Comma-separated list of forwarding strategies", strategies);
+  cmd.AddValue ("faces", "Number of synthetic faces (half downstream, half upstream)", faces);
+  cmd.AddValue ("prefixes", "Number of FIB prefixes", prefixes);
+  cmd.AddValue ("next-hops", "Number of next hops in every FIB entry", nextHops);
+  cmd.AddValue ("interests", "Number of Interests in the synthetic stream", interests);
+  cmd.AddValue ("contents", "Number of distinct contents in the synthetic stream", contents);
+  cmd.AddValue ("window", "Number of Interests received before the Data for an Interest", window);
+  cmd.AddValue ("payload-size", "Payload size of Data packets", payloadSize);
+  cmd.AddValue ("cs-size", "Maximum number of entries in the content store (0 for unlimited)", csSize);
+  cmd.AddValue ("pit-size", "Maximum size of PIT (0 for unlimited)", pitSize);
+  cmd.AddValue ("nacks", "Enable NACKs in strategies derived from Nacks", nacks);
+  cmd.AddValue ("trace", "File with the recorded packet stream", trace);
+  cmd.Parse (argc, argv);
+
+  NS_ABORT_MSG_IF (faces < 2, "At least two faces are needed");
+  uint32_t downstream = faces / 2;
+  uint32_t upstream = faces - downstream;
+  nextHops = std::min (nextHops, upstream);
+
+  Config::SetDefault ("ns3::ndn::fw::Nacks::EnableNACKs", BooleanValue (nacks));
+
+  // timer overhead, for reference
+  uint64_t start = NowNs ();
+  for (uint32_t i = 0; i < 1000000; i++)
+    {
+      NowNs ();
+    }
+  double timerOverhead = (NowNs () - start) / 1000000.0;
+  std::cout << "Timer overhead: " << std::fixed << std::setprecision (1) << 2 * timerOverhead
+            << " ns per timed call" << std::endl;
+
+  std::cout << std::setw (56) << std::left << "strategy" << std::right
+            << std::setw (10) << "packets"
+            << std::setw (10) << "ns/pkt"
+            << std::setw (10) << "pit"
+            << std::setw (10) << "cs"
+            << std::setw (10) << "fib"
+            << std::setw (10) << "strategy"
+            << std::setw (10) << "send"
+            << std::setw (10) << "calls/pkt"
+            << std::setw (10) << "mem-MB" << std::endl;
+
+  std::istringstream list (strategies);
+  std::string strategy;
+  while (std::getline (list, strategy, ','))
+    {
+      Ptr<Node> node = CreateObject<Node> ();
+
+      ndn::StackHelper ndnHelper;
+      ndnHelper.SetForwardingStrategy (strategy);
+      ndnHelper.SetContentStore ("ns3::ndn::cs::Timed", "MaxSize", csSize);
+      ndnHelper.SetPit ("ns3::ndn::pit::Timed", "MaxSize", boost::lexical_cast<std::string> (pitSize));
+      ndnHelper.SetFib ("ns3::ndn::fib::Timed");
+      ndnHelper.Install (node);
+
+      Ptr<ndn::L3Protocol> ndn = node->GetObject<ndn::L3Protocol> ();
+      std::vector< Ptr<ndn::Face> > nodeFaces;
+      for (uint32_t i = 0; i < faces; i++)
+        {
+          Ptr<ndn::Face> face = CreateObject<TimedFace> (node);
+          ndn->AddFace (face);
+          face->SetUp ();
+
+          Ptr<ndn::Limits> limits = face->GetObject<ndn::Limits> ();
+          if (limits != 0)
+            {
+              limits->SetLimits (1e9, 1.0);
+            }
+          nodeFaces.push_back (face);
+        }
+
+      Ptr<ndn::Fib> fib = node->GetObject<ndn::Fib> ();
+      for (uint32_t i = 0; i < prefixes; i++)
+        {
+          ndn::Name prefix;
+          prefix.append ("prefix-" + boost::lexical_cast<std::string> (i));
+          for (uint32_t hop = 0; hop < nextHops; hop++)
+            {
+              fib->Add (prefix, nodeFaces[downstream + (i + hop) % upstream], hop + 1);
+            }
+        }
+
+      Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+      random->SetStream (1);
+
+      std::vector<Event> events;
+      if (trace.empty ())
+        {
+          std::vector<uint32_t> requested;
+          std::vector< Ptr<ndn::Name> > names;
+          for (uint32_t i = 0; i < interests; i++)
+            {
+              requested.push_back (random->GetInteger (0, contents - 1));
+              names.push_back (ContentName (requested.back (), prefixes));
+
+              Event interest = { nodeFaces[i % downstream], MakeInterest (names.back (), random), 0 };
+              events.push_back (interest);
+
+              if (i >= window)
+                {
+                  uint32_t answered = i - window;
+                  Event data = { nodeFaces[downstream + (requested[answered] % prefixes) % upstream], 0,
+                                 MakeData (names[answered], payloadSize) };
+                  events.push_back (data);
+                }
+            }
+        }
+      else
+        {
+          std::ifstream input (trace.c_str ());
+          NS_ABORT_MSG_IF (!input.is_open (), "Cannot open " << trace);
+
+          std::string type, name;
+          uint32_t face;
+          while (input >> type >> face >> name)
+            {
+              NS_ABORT_MSG_IF (face >= faces, "Face " << face << " does not exist");
+              Event event = { nodeFaces[face], 0, 0 };
+              if (type == "interest")
+                event.interest = MakeInterest (Create<ndn::Name> (name), random);
+              else if (type == "data")
+                event.data = MakeData (Create<ndn::Name> (name), payloadSize);
+              else
+                NS_FATAL_ERROR ("Unknown packet type " << type);
+              events.push_back (event);
+            }
+        }
+
+      int64_t elapsed = 0;
+      int64_t memory = 0;
+      Simulator::Schedule (Seconds (1.0), Replay, &events, &elapsed, &memory);
+      Simulator::Run ();
+
+      double packets = std::max<double> (events.size (), 1);
+      double timed = g_breakdown.pit + g_breakdown.cs + g_breakdown.fib + g_breakdown.send;
+      std::cout << std::setw (56) << std::left << strategy << std::right
+                << std::setw (10) << events.size ()
+                << std::setw (10) << elapsed / packets
+                << std::setw (10) << g_breakdown.pit / packets
+                << std::setw (10) << g_breakdown.cs / packets
+                << std::setw (10) << g_breakdown.fib / packets
+                << std::setw (10) << (elapsed - timed) / packets
+                << std::setw (10) << g_breakdown.send / packets
+                << std::setw (10) << g_breakdown.calls / packets
+                << std::setw (10) << memory / 1024.0 / 1024.0 << std::endl;
+
+      events.clear ();
+      Simulator::Destroy ();
+    }
+
+  return 0;
+}
@@ -0,0 +1,175 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+// ndn-grid-tracers-benchmark.cc
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/point-to-point-layout-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <sys/stat.h>
+
+using namespace ns3;
+
+/**
+ * Benchmark of the network-layer tracers on a NxN grid topology (using PointToPointGrid module)
+ *
+ * Every node in the first column runs a consumer requesting data from the producer located
+ * in the opposite corner.  The same scenario is run with either no tracers, the per-node
+ * text tracers (L3RateTracer, L3AggregateTracer, CsTracer), or the consolidated
+ * ColumnarTracer, and wall-clock time and output size are reported.
+ *
+ * To run the benchmark, use:
+ *
+ *     ./waf --run="ndn-grid-tracers-benchmark --size=30 --tracer=legacy"
+ *     ./waf --run="ndn-grid-tracers-benchmark --size=30 --tracer=columnar"
+ *
+ * Without tracers, the benchmark also measures the cost of forwarding (wall-clock time per
+ * Interest received by the forwarding strategies of all nodes) for the specified strategy:
+ *
+ *     ./waf --run="ndn-grid-tracers-benchmark --size=30 --tracer=none --strategy=ns3::ndn::fw::GreenYellowRed"
+ */
+
+static uint64_t g_inInterests = 0;
+
+static void
+InInterest (Ptr<const ndn::Interest> interest, Ptr<const ndn::Face> face)
+{
+  g_inInterests ++;
+}
+
+static uint64_t
+FileSize (const std::string &file)
+{
+  struct stat st;
+  if (stat (file.c_str (), &st) != 0)
+    return 0;
+  return st.st_size;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t size = 10;
+  double stop = 10.0;
+  double period = 0.5;
+  std::string tracer = "columnar";
+  std::string strategy = "ns3::ndn::fw::BestRoute";
+
+  Config::SetDefault ("ns3::PointToPointNetDevice::DataRate", StringValue ("10Mbps"));
+  Config::SetDefault ("ns3::PointToPointChannel::Delay", StringValue ("1ms"));
+  Config::SetDefault ("ns3::DropTailQueue::MaxPackets", StringValue ("100"));
+
+  CommandLine cmd;
+  cmd.AddValue ("size", "Size of the grid (size x size nodes)", size);
+  cmd.AddValue ("stop", "Simulation time, seconds", stop);
+  cmd.AddValue ("period", "Tracer sampling period, seconds", period);
+  cmd.AddValue ("tracer", "Tracer to use: none, legacy, or columnar", tracer);
+  cmd.AddValue ("strategy", "Forwarding strategy to use", strategy);
+  cmd.Parse (argc, argv);
+
+  PointToPointHelper p2p;
+  PointToPointGridHelper grid (size, size, p2p);
+  grid.BoundingBox (100, 100, 200, 200);
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetForwardingStrategy (strategy);
+  ndnHelper.SetContentStore ("ns3::ndn::cs::Lru", "MaxSize", "100");
+  ndnHelper.InstallAll ();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll ();
+
+  Ptr<Node> producer = grid.GetNode (size - 1, size - 1);
+  NodeContainer consumerNodes;
+  for (uint32_t row = 0; row < size; row++)
+    {
+      consumerNodes.Add (grid.GetNode (row, 0));
+    }
+
+  std::string prefix = "/prefix";
+
+  ndn::AppHelper consumerHelper ("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetPrefix (prefix);
+  consumerHelper.SetAttribute ("Frequency", StringValue ("100"));
+  consumerHelper.Install (consumerNodes);
+
+  ndn::AppHelper producerHelper ("ns3::ndn::Producer");
+  producerHelper.SetPrefix (prefix);
+  producerHelper.SetAttribute ("PayloadSize", StringValue("1024"));
+  producerHelper.Install (producer);
+
+  ndnGlobalRoutingHelper.AddOrigins (prefix, producer);
+  ndn::GlobalRoutingHelper::CalculateRoutes ();
+
+  Config::ConnectWithoutContext ("/NodeList/*/$ns3::ndn::ForwardingStrategy/InInterests",
+                                 MakeCallback (&InInterest));
+
+  Simulator::Stop (Seconds (stop));
+
+  std::list<std::string> files;
+  if (tracer == "legacy")
+    {
+      ndn::L3RateTracer::InstallAll ("bench-rate-trace.txt", Seconds (period));
+      ndn::L3AggregateTracer::InstallAll ("bench-aggregate-trace.txt", Seconds (period));
+      ndn::CsTracer::InstallAll ("bench-cs-trace.txt", Seconds (period));
+      files.push_back ("bench-rate-trace.txt");
+      files.push_back ("bench-aggregate-trace.txt");
+      files.push_back ("bench-cs-trace.txt");
+    }
+  else if (tracer == "columnar")
+    {
+      ndn::ColumnarTracer::InstallAll ("bench-trace.bin", Seconds (period));
+      files.push_back ("bench-trace.bin");
+    }
+  else if (tracer != "none")
+    {
+      std::cerr << "ERROR: unknown tracer " << tracer << std::endl;
+      return 1;
+    }
+
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+
+  // make sure all data is on disk before measuring
+  ndn::L3RateTracer::Destroy ();
+  ndn::L3AggregateTracer::Destroy ();
+  ndn::CsTracer::Destroy ();
+  ndn::ColumnarTracer::Destroy ();
+  int64_t elapsed = clock.End ();
+
+  uint64_t bytes = 0;
+  for (std::list<std::string>::iterator file = files.begin (); file != files.end (); file++)
+    {
+      bytes += FileSize (*file);
+    }
+
+  std::cout << "tracer=" << tracer
+            << " nodes=" << size * size
+            << " wall-ms=" << elapsed
+            << " output-bytes=" << bytes
+            << " interests=" << g_inInterests
+            << " ns-per-interest=" << (g_inInterests == 0 ? 0 : 1000000 * elapsed / g_inInterests) << std::endl;
+
+  Simulator::Destroy ();
+
+  return 0;
+}
@@ -0,0 +1,113 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+// ndn-producer-benchmark.cc
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/ndnSIM/apps/ndn-producer.h"
+
+#include <boost/lexical_cast.hpp>
+
+#include <sys/resource.h>
+
+using namespace ns3;
+
+/**
+ * Benchmark of the Data generation by ndn::Producer.
+ *
+ * Pre-created Interests are delivered directly to the producer application, which answers
+ * each of them with a Data packet.  Data packets are pushed to the forwarder and cached
+ * as unsolicited Data (content store is not limited by default), so the peak memory reflects
+ * the memory held by the generated Data packets.
+ *
+ * To run the benchmark, use:
+ *
+ *     ./waf --run="ndn-producer-benchmark --requests=100000 --payload-size=8192"
+ */
+
+static long
+PeakMemoryKb ()
+{
+  struct rusage usage;
+  getrusage (RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+static void
+Run (Ptr<ndn::Producer> producer, uint32_t requests)
+{
+  std::vector< Ptr<ndn::Interest> > interests;
+  interests.reserve (requests);
+  for (uint32_t i = 0; i < requests; i++)
+    {
+      Ptr<ndn::Interest> interest = Create<ndn::Interest> ();
+      interest->SetName (Create<ndn::Name> (ndn::Name ("/prefix").appendSeqNum (i)));
+      interest->SetInterestLifetime (Seconds (4));
+      interests.push_back (interest);
+    }
+
+  long memoryBefore = PeakMemoryKb ();
+
+  SystemWallClockMs clock;
+  clock.Start ();
+  for (uint32_t i = 0; i < requests; i++)
+    {
+      producer->OnInterest (interests[i]);
+    }
+  int64_t elapsed = clock.End ();
+
+  std::cout << "Data/s: " << (elapsed == 0 ? 0 : 1000.0 * requests / elapsed) << std::endl;
+  std::cout << "Peak memory before: " << memoryBefore / 1024 << " MB, after: " << PeakMemoryKb () / 1024 << " MB" << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t requests = 100000;
+  uint32_t payloadSize = 1024;
+  std::string csSize = "0";
+
+  CommandLine cmd;
+  cmd.AddValue ("requests", "Number of Interests delivered to the producer", requests);
+  cmd.AddValue ("payload-size", "Virtual payload size of Data packets", payloadSize);
+  cmd.AddValue ("cs-size", "Maximum number of entries in the content store (0 means unlimited)", csSize);
+  cmd.Parse (argc, argv);
+
+  Ptr<Node> node = CreateObject<Node> ();
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetForwardingStrategy ("ns3::ndn::fw::BestRoute",
+                                   "CacheUnsolicitedDataFromApps", "true");
+  ndnHelper.SetContentStore ("ns3::ndn::cs::Lru", "MaxSize", csSize);
+  ndnHelper.Install (node);
+
+  ndn::AppHelper producerHelper ("ns3::ndn::Producer");
+  producerHelper.SetPrefix ("/prefix");
+  producerHelper.SetAttribute ("PayloadSize", StringValue (boost::lexical_cast<std::string> (payloadSize)));
+  ApplicationContainer apps = producerHelper.Install (node);
+
+  Simulator::Schedule (Seconds (1.0), Run, DynamicCast<ndn::Producer> (apps.Get (0)), requests);
+
+  Simulator::Stop (Seconds (2.0));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  return 0;
+}
@@ -0,0 +1,294 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+// ndn-rocketfuel-multithreaded-benchmark.cc
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/atomic-counter.h"
+#include "ns3/ndnSIM/plugins/topology/rocketfuel-map-reader.h"
+
+#include "ns3/multithreaded-simulator-impl.h"
+
+#include <boost/lexical_cast.hpp>
+
+
+using namespace ns3;
+
+/**
+ * Benchmark of ns3::MultithreadedSimulatorImpl on a Rocketfuel-sized ISP topology.
+ *
+ * The topology is either read from a Rocketfuel map (--topology=<file.cch>, backbone,
+ * gateway and client routers being classified by RocketfuelMapReader), or generated with
+ * the same three tiers and link parameters:
+ *
+ *  - backbone routers (10% of the nodes) form a ring with random chords, 40-100Mbps, 5-10ms links;
+ *  - every gateway router (30%) is attached to one or two backbone routers, 10-20Mbps, 5-10ms;
+ *  - every client router (60%) is attached to a gateway router, 1-3Mbps, 10-70ms.
+ *
+ * Producers are placed on `producers' client routers, and the other client routers run
+ * consumers requesting the prefix of a randomly chosen producer.  The scenario is simulated
+ * with MultithreadedSimulatorImpl using --threads threads (DefaultSimulatorImpl if 0), and
+ * the wall-clock time of Simulator::Run is reported.  Every run uses a separate process, as
+ * ndn::GlobalRoutingHelper cannot be used again after Simulator::Destroy.
+ *
+ * ns-3 has to be configured with --enable-multithreading, otherwise the partitions are
+ * executed by a single thread:
+ *
+ *     ./waf configure --enable-multithreading --enable-examples -d optimized
+ *     for threads in 0 1 2 4 8 16 32; do
+ *       ./waf --run="ndn-rocketfuel-multithreaded-benchmark --nodes=3000 --threads=$threads"
+ *     done
+ *
+ * With --threads=0, the wall-clock time per Interest received by the forwarding strategies
+ * of all nodes measures the cost of forwarding with the specified strategy:
+ *
+ *     ./waf --run="ndn-rocketfuel-multithreaded-benchmark --threads=0 --strategy=ns3::ndn::fw::SmartFlooding"
+ */
+
+static uint32_t g_satisfied = 0;
+static uint32_t g_inInterests = 0;
+
+static void
+InInterest (Ptr<const ndn::Interest> interest, Ptr<const ndn::Face> face)
+{
+  AtomicIncrement (g_inInterests);
+}
+
+static void
+SatisfiedInterest (Ptr<ndn::App> app, uint32_t seqno, Time delay, uint32_t retxCount, int32_t hopCount)
+{
+  AtomicIncrement (g_satisfied);
+}
+
+static void
+Link (PointToPointHelper &p2p, Ptr<UniformRandomVariable> rand, Ptr<Node> a, Ptr<Node> b,
+      double minRate, double maxRate, double minDelay, double maxDelay)
+{
+  p2p.SetDeviceAttribute ("DataRate", DataRateValue (DataRate (static_cast<uint64_t> (rand->GetValue (minRate, maxRate) * 1e6))));
+  p2p.SetChannelAttribute ("Delay", TimeValue (MicroSeconds (static_cast<uint64_t> (rand->GetValue (minDelay, maxDelay) * 1000))));
+  p2p.Install (a, b);
+}
+
+static void
+GenerateTopology (uint32_t nodes, NodeContainer &backbone, NodeContainer &gateways, NodeContainer &clients)
+{
+  Ptr<UniformRandomVariable> rand = CreateObject<UniformRandomVariable> ();
+  rand->SetStream (1);
+  PointToPointHelper p2p;
+
+  backbone.Create (std::max<uint32_t> (4, nodes / 10));
+  gateways.Create (std::max<uint32_t> (1, nodes * 3 / 10));
+  clients.Create (nodes > backbone.GetN () + gateways.GetN () ? nodes - backbone.GetN () - gateways.GetN () : 1);
+
+  for (uint32_t i = 0; i < backbone.GetN (); i++)
+    {
+      Link (p2p, rand, backbone.Get (i), backbone.Get ((i + 1) % backbone.GetN ()), 40, 100, 5, 10);
+      uint32_t other = rand->GetInteger (0, backbone.GetN () - 1);
+      if (other != i && other != (i + 1) % backbone.GetN ())
+        {
+          Link (p2p, rand, backbone.Get (i), backbone.Get (other), 40, 100, 5, 10);
+        }
+    }
+  for (uint32_t i = 0; i < gateways.GetN (); i++)
+    {
+      uint32_t first = rand->GetInteger (0, backbone.GetN () - 1);
+      Link (p2p, rand, gateways.Get (i), backbone.Get (first), 10, 20, 5, 10);
+      uint32_t second = rand->GetInteger (0, backbone.GetN () - 1);
+      if (second != first && rand->GetValue () < 0.5)
+        {
+          Link (p2p, rand, gateways.Get (i), backbone.Get (second), 10, 20, 5, 10);
+        }
+    }
+  for (uint32_t i = 0; i < clients.GetN (); i++)
+    {
+      Link (p2p, rand, clients.Get (i), gateways.Get (rand->GetInteger (0, gateways.GetN () - 1)), 1, 3, 10, 70);
+    }
+}
+
+struct Result
+{
+  int64_t elapsed;
+  uint32_t satisfied;
+  uint32_t interests;
+  uint32_t partitions;
+  uint64_t windows;
+  uint64_t remoteEvents;
+  Time lookAhead;
+};
+
+static Result
+RunScenario (const std::string &topology, uint32_t nodes, uint32_t producers, double frequency, double stop,
+             const std::string &strategy, Ptr<SimulatorImpl> impl)
+{
+  Simulator::SetImplementation (impl);
+  g_satisfied = 0;
+
+  NodeContainer backbone, gateways, clients;
+  if (topology.empty ())
+    {
+      GenerateTopology (nodes, backbone, gateways, clients);
+    }
+  else
+    {
+      RocketfuelParams params;
+      params.clientNodeDegrees = 2;
+      params.averageRtt = 0.25;
+      params.minb2bBandwidth = "40Mbps";
+      params.minb2bDelay = "5ms";
+      params.maxb2bBandwidth = "100Mbps";
+      params.maxb2bDelay = "10ms";
+      params.minb2gBandwidth = "10Mbps";
+      params.minb2gDelay = "5ms";
+      params.maxb2gBandwidth = "20Mbps";
+      params.maxb2gDelay = "10ms";
+      params.ming2cBandwidth = "1Mbps";
+      params.ming2cDelay = "10ms";
+      params.maxg2cBandwidth = "3Mbps";
+      params.maxg2cDelay = "70ms";
+
+      RocketfuelMapReader reader (topology, 1.0);
+      reader.Read (params, true, true);
+      backbone = reader.GetBackboneRouters ();
+      gateways = reader.GetGatewayRouters ();
+      clients = reader.GetCustomerRouters ();
+    }
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetForwardingStrategy (strategy);
+  ndnHelper.SetContentStore ("ns3::ndn::cs::Lru", "MaxSize", "100");
+  ndnHelper.InstallAll ();
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll ();
+
+  Ptr<UniformRandomVariable> rand = CreateObject<UniformRandomVariable> ();
+  rand->SetStream (2);
+  producers = std::max<uint32_t> (1, std::min (producers, clients.GetN () / 2));
+  for (uint32_t i = 0; i < clients.GetN (); i++)
+    {
+      if (i < producers)
+        {
+          std::string prefix = "/prefix" + boost::lexical_cast<std::string> (i);
+          ndn::AppHelper producerHelper ("ns3::ndn::Producer");
+          producerHelper.SetAttribute ("PayloadSize", StringValue ("1024"));
+          producerHelper.SetPrefix (prefix);
+          producerHelper.Install (clients.Get (i));
+          ndnGlobalRoutingHelper.AddOrigins (prefix, clients.Get (i));
+        }
+      else
+        {
+          std::string prefix = "/prefix" + boost::lexical_cast<std::string> (rand->GetInteger (0, producers - 1));
+          ndn::AppHelper consumerHelper ("ns3::ndn::ConsumerCbr");
+          consumerHelper.SetAttribute ("Frequency", DoubleValue (frequency));
+          consumerHelper.SetPrefix (prefix + "/client" + boost::lexical_cast<std::string> (i));
+          consumerHelper.Install (clients.Get (i));
+        }
+    }
+
+  ndn::GlobalRoutingHelper::CalculateRoutes ();
+
+  Config::ConnectWithoutContext ("/NodeList/*/ApplicationList/*/FirstInterestDataDelay",
+                                 MakeCallback (&SatisfiedInterest));
+  Config::ConnectWithoutContext ("/NodeList/*/$ns3::ndn::ForwardingStrategy/InInterests",
+                                 MakeCallback (&InInterest));
+
+  Simulator::Stop (Seconds (stop));
+
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+
+  Result result;
+  result.elapsed = clock.End ();
+  result.satisfied = g_satisfied;
+  result.interests = g_inInterests;
+  result.partitions = 1;
+  result.windows = 0;
+  result.remoteEvents = 0;
+  result.lookAhead = Seconds (0);
+  Ptr<MultithreadedSimulatorImpl> multithreaded = DynamicCast<MultithreadedSimulatorImpl> (impl);
+  if (multithreaded != 0)
+    {
+      result.partitions = multithreaded->GetPartitionCount ();
+      result.windows = multithreaded->GetWindowCount ();
+      result.remoteEvents = multithreaded->GetRemoteEventCount ();
+      result.lookAhead = multithreaded->GetLookAhead ();
+    }
+  std::cout << "nodes=" << NodeList::GetNNodes () << std::flush;
+
+  Simulator::Destroy ();
+  return result;
+}
+
+int
+main (int argc, char *argv[])
+{
+  std::string topology;
+  uint32_t nodes = 1000;
+  uint32_t producers = 20;
+  double frequency = 10.0;
+  double stop = 10.0;
+  uint32_t threads = 1;
+  uint32_t partitions = 0;
+  std::string strategy = "ns3::ndn::fw::BestRoute";
+
+  Config::SetDefault ("ns3::DropTailQueue::MaxPackets", StringValue ("100"));
+
+  CommandLine cmd;
+  cmd.AddValue ("topology", "Rocketfuel map (.cch) to use instead of the generated topology", topology);
+  cmd.AddValue ("nodes", "Number of nodes of the generated topology", nodes);
+  cmd.AddValue ("producers", "Number of producers", producers);
+  cmd.AddValue ("frequency", "Interest frequency of each consumer", frequency);
+  cmd.AddValue ("stop", "Simulation time, seconds", stop);
+  cmd.AddValue ("threads", "Number of threads (0 to use DefaultSimulatorImpl)", threads);
+  cmd.AddValue ("partitions", "Number of partitions (0 to use the number of threads)", partitions);
+  cmd.AddValue ("strategy", "Forwarding strategy to use", strategy);
+  cmd.Parse (argc, argv);
+
+  Ptr<SimulatorImpl> impl;
+  if (threads == 0)
+    {
+      impl = CreateObject<DefaultSimulatorImpl> ();
+    }
+  else
+    {
+#ifndef NS3_MULTITHREADED
+      std::cout << "WARNING: ns-3 is not configured with --enable-multithreading, "
+                << "the partitions are executed by a single thread" << std::endl;
+#endif
+      impl = CreateObjectWithAttributes<MultithreadedSimulatorImpl> ("ThreadCount", UintegerValue (threads),
+                                                                   "PartitionCount", UintegerValue (partitions));
+    }
+
+  Result result = RunScenario (topology, nodes, producers, frequency, stop, strategy, impl);
+
+  std::cout << " threads=" << threads
+            << " partitions=" << result.partitions
+            << " lookahead=" << result.lookAhead.GetMicroSeconds () << "us"
+            << " windows=" << result.windows
+            << " remote=" << result.remoteEvents
+            << " satisfied=" << result.satisfied
+            << " wall-ms=" << result.elapsed
+            << " interests=" << result.interests
+            << " ns-per-interest=" << (result.interests == 0 ? 0 : 1000000 * result.elapsed / result.interests) << std::endl;
+
+  return 0;
+}
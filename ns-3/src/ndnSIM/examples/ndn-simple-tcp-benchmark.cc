@@ -0,0 +1,144 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2012 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+// ndn-simple-tcp-benchmark.cc
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/ndnSIM-module.h"
+
+using namespace ns3;
+
+/**
+ * Throughput benchmark of the TCP face using the topology of ndn-simple-tcp example:
+ *
+ *      +----------+                +--------+                +----------+
+ *      | consumer | <------------> | router | <------------> | producer |
+ *      +----------+                +--------+                +----------+
+ *           \                                                   /
+ *            -------------------- tcp face --------------------
+ *
+ * Links are fast enough for the consumer to saturate the TCP face, so most of the
+ * simulation time is spent in TCP face framing and reassembly.  The benchmark reports
+ * the number of Data packets received by the consumer and wall-clock time.
+ *
+ * To run the benchmark, use:
+ *
+ *     ./waf --run="ndn-simple-tcp-benchmark --frequency=20000 --stop=20"
+ */
+
+static uint64_t g_receivedData = 0;
+static uint64_t g_receivedBytes = 0;
+
+static void
+ReceivedData (Ptr<const ndn::Data> data, Ptr<ndn::App> app, Ptr<ndn::Face> face)
+{
+  g_receivedData ++;
+  g_receivedBytes += data->GetPayload ()->GetSize ();
+}
+
+int
+main (int argc, char *argv[])
+{
+  std::string frequency = "10000";
+  std::string dataRate = "1Gbps";
+  uint32_t payloadSize = 1024;
+  double stop = 10.0;
+
+  Config::SetDefault ("ns3::PointToPointChannel::Delay", StringValue ("1ms"));
+  Config::SetDefault ("ns3::DropTailQueue::MaxPackets", StringValue ("1000"));
+  Config::SetDefault ("ns3::TcpSocket::SndBufSize", UintegerValue (1 << 20));
+  Config::SetDefault ("ns3::TcpSocket::RcvBufSize", UintegerValue (1 << 20));
+
+  CommandLine cmd;
+  cmd.AddValue ("frequency", "Interest frequency of the consumer", frequency);
+  cmd.AddValue ("rate", "Data rate of the links", dataRate);
+  cmd.AddValue ("payload", "Payload size of Data packets", payloadSize);
+  cmd.AddValue ("stop", "Simulation time, seconds", stop);
+  cmd.Parse (argc, argv);
+
+  Config::SetDefault ("ns3::PointToPointNetDevice::DataRate", StringValue (dataRate));
+
+  NodeContainer nodes;
+  nodes.Create (3);
+
+  PointToPointHelper p2p;
+  NetDeviceContainer link1 = p2p.Install (nodes.Get (0), nodes.Get (1));
+  NetDeviceContainer link2 = p2p.Install (nodes.Get (1), nodes.Get (2));
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetDefaultRoutes (false);
+  ndnHelper.InstallAll ();
+
+  InternetStackHelper ipStack;
+  ipStack.SetIpv6StackInstall (false);
+  ipStack.InstallAll ();
+
+  Ipv4AddressHelper ipAddressHelper;
+  ipAddressHelper.SetBase (Ipv4Address ("10.1.1.0"), Ipv4Mask ("255.255.255.0"));
+  ipAddressHelper.Assign (link1);
+
+  ipAddressHelper.SetBase (Ipv4Address ("10.1.2.0"), Ipv4Mask ("255.255.255.0"));
+  ipAddressHelper.Assign (link2);
+
+  Ipv4StaticRoutingHelper ipStaticRouting;
+  ipStaticRouting.GetStaticRouting (nodes.Get (0)->GetObject<Ipv4> ())->
+    AddNetworkRouteTo (Ipv4Address ("10.1.2.0"), Ipv4Mask ("255.255.255.0"),
+                       Ipv4Address ("10.1.1.2"),
+                       1, 1);
+
+  ipStaticRouting.GetStaticRouting (nodes.Get (2)->GetObject<Ipv4> ())->
+    AddNetworkRouteTo (Ipv4Address ("10.1.1.0"), Ipv4Mask ("255.255.255.0"),
+                       Ipv4Address ("10.1.2.1"),
+                       1, 1);
+
+  ndn::IpFacesHelper::InstallAll ();
+  ndn::IpFacesHelper::CreateTcpFace (Seconds (1.0), nodes.Get (0), Ipv4Address ("10.1.2.2"), "/tcp-route");
+
+  ndn::AppHelper consumerHelper ("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetPrefix ("/tcp-route");
+  consumerHelper.SetAttribute ("Frequency", StringValue (frequency));
+  consumerHelper.Install (nodes.Get (0)).
+    Start (Seconds (3));
+
+  ndn::AppHelper producerHelper ("ns3::ndn::Producer");
+  producerHelper.SetPrefix ("/tcp-route");
+  producerHelper.SetAttribute ("PayloadSize", UintegerValue (payloadSize));
+  producerHelper.Install (nodes.Get (2));
+
+  Config::ConnectWithoutContext ("/NodeList/0/ApplicationList/*/$ns3::ndn::App/ReceivedDatas",
+                                 MakeCallback (&ReceivedData));
+
+  Simulator::Stop (Seconds (stop));
+
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t elapsed = clock.End ();
+
+  std::cout << "data=" << g_receivedData
+            << " payload-bytes=" << g_receivedBytes
+            << " wall-ms=" << elapsed
+            << " data-per-wall-sec=" << (elapsed > 0 ? g_receivedData * 1000 / elapsed : 0) << std::endl;
+
+  Simulator::Destroy ();
+
+  return 0;
+}
@@ -0,0 +1,259 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+// ndn-tree-aggregation-benchmark.cc
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/ndnSIM/model/fw/best-route.h"
+
+#include <limits>
+#include <time.h>
+
+using namespace ns3;
+
+/**
+ * Benchmark of the Data processing with heavy Interest aggregation.
+ *
+ * Consumers on the leaves of a tree with --depth levels and --fanout children per node
+ * synchronously request, --frequency times per second, the same Data /data/<round>/0/0
+ * from the producer on the root of the tree.  Each consumer truncates the name to a random
+ * number of components, so in addition to the aggregation of Interests from different
+ * children, routers keep PIT entries for /data/<round>, /data/<round>/0 and
+ * /data/<round>/0/0 at the same time, and the first Data packet returned by the producer
+ * satisfies several PIT entries on every router.
+ *
+ * The benchmark reports the wall clock time of the simulation, the CPU time spent by the
+ * forwarding strategy (ns3::ndn::fw::BestRoute) in processing of the incoming Data packets,
+ * and the number of Data packets received by the consumers.
+ *
+ * To run the benchmark, use:
+ *
+ *     ./waf --run="ndn-tree-aggregation-benchmark --depth=4 --fanout=4 --frequency=100"
+ */
+
+static uint64_t
+NowNs ()
+{
+  struct timespec now;
+  clock_gettime (CLOCK_MONOTONIC, &now);
+  return static_cast<uint64_t> (now.tv_sec) * 1000000000 + now.tv_nsec;
+}
+
+static uint64_t g_onDataNs = 0;
+static uint64_t g_onDataCalls = 0;
+static uint64_t g_receivedData = 0;
+
+namespace ns3 {
+
+/**
+ * BestRoute strategy, timing the processing of incoming Data packets
+ */
+class TimedBestRoute : public ndn::fw::BestRoute
+{
+public:
+  static TypeId
+  GetTypeId ()
+  {
+    static TypeId tid = TypeId ("ns3::ndn::fw::TimedBestRoute")
+      .SetGroupName ("Ndn")
+      .SetParent<ndn::fw::BestRoute> ()
+      .AddConstructor<TimedBestRoute> ()
+      ;
+    return tid;
+  }
+
+  virtual void
+  OnData (Ptr<ndn::Face> face, Ptr<ndn::Data> data)
+  {
+    uint64_t start = NowNs ();
+    ndn::fw::BestRoute::OnData (face, data);
+    g_onDataNs += NowNs () - start;
+    g_onDataCalls ++;
+  }
+};
+
+NS_OBJECT_ENSURE_REGISTERED (TimedBestRoute);
+
+/**
+ * Consumer requesting /data/<round> prefixes, truncated to a random length
+ */
+class AggregatingConsumer : public ndn::App
+{
+public:
+  static TypeId
+  GetTypeId ()
+  {
+    static TypeId tid = TypeId ("AggregatingConsumer")
+      .SetParent<ndn::App> ()
+      .AddConstructor<AggregatingConsumer> ()
+      .AddAttribute ("Frequency", "Number of Interests per second",
+                     DoubleValue (100.0),
+                     MakeDoubleAccessor (&AggregatingConsumer::m_frequency),
+                     MakeDoubleChecker<double> ())
+      ;
+    return tid;
+  }
+
+  AggregatingConsumer ()
+    : m_frequency (100.0)
+    , m_round (0)
+  {
+    m_rand = CreateObject<UniformRandomVariable> ();
+  }
+
+protected:
+  virtual void
+  StartApplication ()
+  {
+    ndn::App::StartApplication ();
+    m_sendEvent = Simulator::ScheduleNow (&AggregatingConsumer::SendInterest, this);
+  }
+
+  virtual void
+  StopApplication ()
+  {
+    Simulator::Cancel (m_sendEvent);
+    ndn::App::StopApplication ();
+  }
+
+  virtual void
+  OnData (Ptr<const ndn::Data> data)
+  {
+    ndn::App::OnData (data);
+    g_receivedData ++;
+  }
+
+private:
+  void
+  SendInterest ()
+  {
+    if (!m_active)
+      return;
+
+    Ptr<ndn::Name> name = Create<ndn::Name> ("/data");
+    name->appendSeqNum (m_round ++);
+    uint32_t extraComponents = m_rand->GetInteger (0, 2);
+    for (uint32_t i = 0; i < extraComponents; i++)
+      {
+        name->appendSeqNum (0);
+      }
+
+    Ptr<ndn::Interest> interest = Create<ndn::Interest> ();
+    interest->SetNonce (m_rand->GetInteger (0, std::numeric_limits<uint32_t>::max ()));
+    interest->SetName (name);
+    interest->SetInterestLifetime (Seconds (2.0));
+
+    m_transmittedInterests (interest, this, m_face);
+    m_face->ReceiveInterest (interest);
+
+    m_sendEvent = Simulator::Schedule (Seconds (1.0 / m_frequency), &AggregatingConsumer::SendInterest, this);
+  }
+
+private:
+  double m_frequency;
+  uint32_t m_round;
+  Ptr<UniformRandomVariable> m_rand;
+  EventId m_sendEvent;
+};
+
+NS_OBJECT_ENSURE_REGISTERED (AggregatingConsumer);
+
+} // namespace ns3
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t depth = 4;
+  uint32_t fanout = 4;
+  double frequency = 100.0;
+  double duration = 10.0;
+
+  CommandLine cmd;
+  cmd.AddValue ("depth", "Number of levels of the tree below the root", depth);
+  cmd.AddValue ("fanout", "Number of children of each node of the tree", fanout);
+  cmd.AddValue ("frequency", "Number of Interests per second sent by each consumer", frequency);
+  cmd.AddValue ("duration", "Duration of the simulation in seconds", duration);
+  cmd.Parse (argc, argv);
+
+  // node 0 is the root, children of node i are nodes fanout*i+1 .. fanout*i+fanout
+  uint32_t size = 1;
+  uint32_t levelSize = 1;
+  for (uint32_t level = 0; level < depth; level++)
+    {
+      levelSize *= fanout;
+      size += levelSize;
+    }
+  uint32_t firstLeaf = size - levelSize;
+
+  NodeContainer nodes;
+  nodes.Create (size);
+
+  PointToPointHelper p2p;
+  p2p.SetDeviceAttribute ("DataRate", StringValue ("100Mbps"));
+  p2p.SetChannelAttribute ("Delay", StringValue ("1ms"));
+  for (uint32_t child = 1; child < size; child++)
+    {
+      p2p.Install (nodes.Get ((child - 1) / fanout), nodes.Get (child));
+    }
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetForwardingStrategy ("ns3::ndn::fw::TimedBestRoute");
+  ndnHelper.SetContentStore ("ns3::ndn::cs::Nocache");
+  ndnHelper.InstallAll ();
+
+  ndn::GlobalRoutingHelper routingHelper;
+  routingHelper.InstallAll ();
+
+  NodeContainer leaves;
+  for (uint32_t leaf = firstLeaf; leaf < size; leaf++)
+    {
+      leaves.Add (nodes.Get (leaf));
+    }
+
+  ndn::AppHelper consumerHelper ("AggregatingConsumer");
+  consumerHelper.SetAttribute ("Frequency", DoubleValue (frequency));
+  consumerHelper.Install (leaves).Stop (Seconds (duration));
+
+  ndn::AppHelper producerHelper ("ns3::ndn::Producer");
+  producerHelper.SetPrefix ("/data");
+  producerHelper.Install (nodes.Get (0));
+
+  routingHelper.AddOrigins ("/data", nodes.Get (0));
+  routingHelper.CalculateRoutes ();
+
+  SystemWallClockMs clock;
+  clock.Start ();
+
+  Simulator::Stop (Seconds (duration + 2.0));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  int64_t elapsed = clock.End ();
+
+  std::cout << "Nodes: " << size << ", consumers: " << levelSize << std::endl;
+  std::cout << "Wall clock: " << elapsed << " ms" << std::endl;
+  std::cout << "OnData: " << g_onDataCalls << " calls, "
+            << (g_onDataCalls == 0 ? 0 : g_onDataNs / g_onDataCalls) << " ns/call, "
+            << g_onDataNs / 1000000 << " ms total" << std::endl;
+  std::cout << "Data received by consumers: " << g_receivedData << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,146 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2011-2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+// ndn-wire-benchmark.cc
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/ndnSIM/model/wire/ndnsim.h"
+
+#include <boost/lexical_cast.hpp>
+
+#include <iomanip>
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * Benchmark of the ndnSIM wire format encoder and decoder.
+ *
+ * For every name length, the benchmark reports the number of operations per second for:
+ *
+ * - encoding of an Interest and of a Data packet (the cached wire is dropped before every encoding),
+ * - decoding of an Interest and of a Data packet,
+ * - forwarding of a received Interest with a different NACK type (copy of the Interest,
+ *   update of the field and encoding, as the Nacks strategy does).
+ *
+ * To run the benchmark, use:
+ *
+ *     ./waf --run="ndn-wire-benchmark --components=3,5,10,20 --iterations=100000"
+ */
+
+static double
+Rate (uint32_t iterations, int64_t elapsed)
+{
+  return elapsed == 0 ? 0 : 1000.0 * iterations / elapsed;
+}
+
+int
+main (int argc, char *argv[])
+{
+  std::string components = "3,5,10,20";
+  uint32_t iterations = 100000;
+
+  CommandLine cmd;
+  cmd.AddValue ("components", "Comma-separated list of the numbers of name components", components);
+  cmd.AddValue ("iterations", "Number of operations per measurement", iterations);
+  cmd.Parse (argc, argv);
+
+  std::cout << std::setw (12) << "components" << std::fixed << std::setprecision (0)
+            << std::setw (16) << "enc-interest/s"
+            << std::setw (16) << "dec-interest/s"
+            << std::setw (16) << "enc-data/s"
+            << std::setw (16) << "dec-data/s"
+            << std::setw (16) << "fwd-nack/s" << std::endl;
+
+  std::istringstream list (components);
+  std::string item;
+  while (std::getline (list, item, ','))
+    {
+      uint32_t count = boost::lexical_cast<uint32_t> (item);
+
+      Ptr<ndn::Name> name = Create<ndn::Name> ();
+      for (uint32_t i = 0; i < count; i++)
+        {
+          name->append ("component-" + boost::lexical_cast<std::string> (i));
+        }
+
+      Ptr<ndn::Interest> interest = Create<ndn::Interest> ();
+      interest->SetName (name);
+      interest->SetNonce (12345);
+      interest->SetInterestLifetime (Seconds (4));
+
+      Ptr<ndn::Data> data = Create<ndn::Data> (Create<Packet> (1024));
+      data->SetName (name);
+      data->SetFreshness (Seconds (10));
+
+      SystemWallClockMs clock;
+
+      clock.Start ();
+      for (uint32_t i = 0; i < iterations; i++)
+        {
+          interest->SetWire (0);
+          ndn::wire::ndnSIM::Interest::ToWire (interest);
+        }
+      double encInterest = Rate (iterations, clock.End ());
+
+      Ptr<Packet> interestWire = ndn::wire::ndnSIM::Interest::ToWire (interest);
+      clock.Start ();
+      for (uint32_t i = 0; i < iterations; i++)
+        {
+          ndn::wire::ndnSIM::Interest::FromWire (interestWire->Copy ());
+        }
+      double decInterest = Rate (iterations, clock.End ());
+
+      clock.Start ();
+      for (uint32_t i = 0; i < iterations; i++)
+        {
+          data->SetWire (0);
+          ndn::wire::ndnSIM::Data::ToWire (data);
+        }
+      double encData = Rate (iterations, clock.End ());
+
+      Ptr<Packet> dataWire = ndn::wire::ndnSIM::Data::ToWire (data);
+      clock.Start ();
+      for (uint32_t i = 0; i < iterations; i++)
+        {
+          ndn::wire::ndnSIM::Data::FromWire (dataWire->Copy ());
+        }
+      double decData = Rate (iterations, clock.End ());
+
+      Ptr<ndn::Interest> received = ndn::wire::ndnSIM::Interest::FromWire (interestWire->Copy ());
+      clock.Start ();
+      for (uint32_t i = 0; i < iterations; i++)
+        {
+          Ptr<ndn::Interest> nack = Create<ndn::Interest> (*received);
+          nack->SetNack (ndn::Interest::NACK_LOOP);
+          ndn::wire::ndnSIM::Interest::ToWire (nack);
+        }
+      double fwdNack = Rate (iterations, clock.End ());
+
+      std::cout << std::setw (12) << count
+                << std::setw (16) << encInterest
+                << std::setw (16) << decInterest
+                << std::setw (16) << encData
+                << std::setw (16) << decData
+                << std::setw (16) << fwdNack << std::endl;
+    }
+
+  return 0;
+}
@@ -24,8 +24,12 @@
 #include "../../utils/trie/lru-policy.h"
 #include "../../utils/trie/fifo-policy.h"
 #include "../../utils/trie/lfu-policy.h"
+#include "../../utils/trie/tinylfu-policy.h"
+#include "../../utils/trie/arc-policy.h"
+#include "../../utils/trie/s3fifo-policy.h"
 #include "../../utils/trie/multi-policy.h"
 #include "../../utils/trie/aggregate-stats-policy.h"
+#include "custom-policies/gdsf-policy.h"
 
 #define NS_OBJECT_ENSURE_REGISTERED_TEMPL(type, templ)  \
   static struct X ## type ## templ ## RegistrationClass \
@@ -64,10 +68,34 @@ template class ContentStoreImpl<fifo_policy_traits>;
  **/
 template class ContentStoreImpl<lfu_policy_traits>;
 
+/**
+ * @brief ContentStore with LRU cache replacement policy and TinyLFU admission
+ **/
+template class ContentStoreImpl<tinylfu_policy_traits>;
+
+/**
+ * @brief ContentStore with Adaptive Replacement Cache (ARC) policy
+ **/
+template class ContentStoreImpl<arc_policy_traits>;
+
+/**
+ * @brief ContentStore with S3-FIFO cache replacement policy
+ **/
+template class ContentStoreImpl<s3fifo_policy_traits>;
+
+/**
+ * @brief ContentStore with Greedy-Dual-Size-Frequency (GDSF) cache replacement policy
+ **/
+template class ContentStoreImpl<gdsf_policy_traits>;
+
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, lru_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, random_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, fifo_policy_traits);
 NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, lfu_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, tinylfu_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, arc_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, s3fifo_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreImpl, gdsf_policy_traits);
 
 
 typedef multi_policy_traits< boost::mpl::vector2< lru_policy_traits,
@@ -111,6 +139,26 @@ class Random : public ContentStoreImpl<random_policy_traits> { };
  * \brief Content Store implementing Least Frequently Used cache replacement policy
  */
 class Lfu : public ContentStoreImpl<lfu_policy_traits> { };
+
+/**
+ * \brief Content Store implementing LRU cache replacement policy with TinyLFU admission
+ */
+class TinyLfu : public ContentStoreImpl<tinylfu_policy_traits> { };
+
+/**
+ * \brief Content Store implementing Adaptive Replacement Cache (ARC) policy
+ */
+class Arc : public ContentStoreImpl<arc_policy_traits> { };
+
+/**
+ * \brief Content Store implementing S3-FIFO cache replacement policy
+ */
+class S3Fifo : public ContentStoreImpl<s3fifo_policy_traits> { };
+
+/**
+ * \brief Content Store implementing Greedy-Dual-Size-Frequency cache replacement policy
+ */
+class Gdsf : public ContentStoreImpl<gdsf_policy_traits> { };
 #endif
 
 
@@ -210,6 +210,7 @@ ContentStoreImpl<Policy>::Lookup (Ptr<const Interest> interest)
 
       Ptr<Data> copy = Create<Data> (*node->payload ()->GetData ());
       ConstCast<Packet> (copy->GetPayload ())->RemoveAllPacketTags ();
+      ConstCast<Packet> (copy->GetPayload ())->RemoveAllTypedTags ();
       return copy;
     }
   else
@@ -0,0 +1,109 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "content-store-with-bytes.h"
+
+#include "../../utils/trie/random-policy.h"
+#include "../../utils/trie/lru-policy.h"
+#include "../../utils/trie/fifo-policy.h"
+#include "../../utils/trie/lfu-policy.h"
+#include "custom-policies/gdsf-policy.h"
+
+#define NS_OBJECT_ENSURE_REGISTERED_TEMPL(type, templ)  \
+  static struct X ## type ## templ ## RegistrationClass \
+  {                                                     \
+    X ## type ## templ ## RegistrationClass () {        \
+      ns3::TypeId tid = type<templ>::GetTypeId ();      \
+      tid.GetParent ();                                 \
+    }                                                   \
+  } x_ ## type ## templ ## RegistrationVariable
+
+namespace ns3 {
+namespace ndn {
+
+using namespace ndnSIM;
+
+namespace cs {
+
+// explicit instantiation and registering
+/**
+ * @brief ContentStore with size in bytes limit and LRU cache replacement policy
+ **/
+template class ContentStoreWithBytes<lru_policy_traits>;
+
+/**
+ * @brief ContentStore with size in bytes limit and random cache replacement policy
+ **/
+template class ContentStoreWithBytes<random_policy_traits>;
+
+/**
+ * @brief ContentStore with size in bytes limit and FIFO cache replacement policy
+ **/
+template class ContentStoreWithBytes<fifo_policy_traits>;
+
+/**
+ * @brief ContentStore with size in bytes limit and Least Frequently Used (LFU) cache replacement policy
+ **/
+template class ContentStoreWithBytes<lfu_policy_traits>;
+
+/**
+ * @brief ContentStore with size in bytes limit and Greedy-Dual-Size-Frequency (GDSF) cache replacement policy
+ **/
+template class ContentStoreWithBytes<gdsf_policy_traits>;
+
+
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithBytes, lru_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithBytes, random_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithBytes, fifo_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithBytes, lfu_policy_traits);
+NS_OBJECT_ENSURE_REGISTERED_TEMPL(ContentStoreWithBytes, gdsf_policy_traits);
+
+#ifdef DOXYGEN
+// /**
+//  * \brief Content Store with size in bytes limit implementing LRU cache replacement policy
+//  */
+class Bytes::Lru : public ContentStoreWithBytes<lru_policy_traits> { };
+
+/**
+ * \brief Content Store with size in bytes limit implementing FIFO cache replacement policy
+ */
+class Bytes::Fifo : public ContentStoreWithBytes<fifo_policy_traits> { };
+
+/**
+ * \brief Content Store with size in bytes limit implementing Random cache replacement policy
+ */
+class Bytes::Random : public ContentStoreWithBytes<random_policy_traits> { };
+
+/**
+ * \brief Content Store with size in bytes limit implementing Least Frequently Used cache replacement policy
+ */
+class Bytes::Lfu : public ContentStoreWithBytes<lfu_policy_traits> { };
+
+/**
+ * \brief Content Store with size in bytes limit implementing Greedy-Dual-Size-Frequency cache replacement policy
+ */
+class Bytes::Gdsf : public ContentStoreWithBytes<gdsf_policy_traits> { };
+
+#endif
+
+
+} // namespace cs
+} // namespace ndn
+} // namespace ns3
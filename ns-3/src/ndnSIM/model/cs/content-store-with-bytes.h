@@ -0,0 +1,138 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef NDN_CONTENT_STORE_WITH_BYTES_H_
+#define NDN_CONTENT_STORE_WITH_BYTES_H_
+
+#include "content-store-impl.h"
+
+#include "../../utils/trie/multi-policy.h"
+#include "custom-policies/bytes-policy.h"
+#include "ns3/uinteger.h"
+#include "ns3/type-id.h"
+
+namespace ns3 {
+namespace ndn {
+namespace cs {
+
+/**
+ * @ingroup ndn-cs
+ * @brief Special content store realization that limits the total size of the cached Data packets
+ *
+ * Size of an entry is the size of the wire-encoded Data packet, payload included.  When
+ * a new entry does not fit into MaxBytes, entries are evicted in the order of the
+ * replacement policy until it does.  MaxSize (number of entries) is still enforced, set
+ * it to 0 to limit the content store only by its size in bytes.
+ */
+template<class Policy>
+class ContentStoreWithBytes :
+    public ContentStoreImpl< ndnSIM::multi_policy_traits< boost::mpl::vector2< ndnSIM::bytes_policy_traits, Policy > > >
+{
+public:
+  typedef ContentStoreImpl< ndnSIM::multi_policy_traits< boost::mpl::vector2< ndnSIM::bytes_policy_traits, Policy > > > super;
+
+  typedef typename super::policy_container::template index<0>::type bytes_policy_container;
+
+  ContentStoreWithBytes ();
+
+  static TypeId
+  GetTypeId ();
+
+  /**
+   * @brief Get total size of the cached Data packets, in bytes
+   */
+  uint64_t
+  GetBytes () const
+  {
+    return this->getPolicy ()
+      .template get<bytes_policy_container> ()
+      .get_bytes ();
+  }
+
+private:
+  void
+  SetMaxBytes (uint64_t maxBytes)
+  {
+    this->getPolicy ()
+      .template get<bytes_policy_container> ()
+      .set_max_bytes (maxBytes);
+  }
+
+  uint64_t
+  GetMaxBytes () const
+  {
+    return
+      this->getPolicy ()
+      .template get<bytes_policy_container> ()
+      .get_max_bytes ();
+  }
+
+  void
+  NotifyEvictEntry (Ptr<const Entry> entry, uint32_t size)
+  {
+    m_didEvictEntry (entry, size);
+  }
+
+private:
+  /// @brief trace of entry removals (fired every time an entry is evicted from the cache): pointer to the CS entry and its size in bytes
+  TracedCallback< Ptr<const Entry>, uint32_t > m_didEvictEntry;
+};
+
+//////////////////////////////////////////
+////////// Implementation ////////////////
+//////////////////////////////////////////
+
+template<class Policy>
+ContentStoreWithBytes< Policy >::ContentStoreWithBytes ()
+{
+  this->getPolicy ()
+    .template get<bytes_policy_container> ()
+    .set_evict_callback (MakeCallback (&ContentStoreWithBytes< Policy >::NotifyEvictEntry, this));
+}
+
+template<class Policy>
+TypeId
+ContentStoreWithBytes< Policy >::GetTypeId ()
+{
+  static TypeId tid = TypeId (("ns3::ndn::cs::Bytes::"+Policy::GetName ()).c_str ())
+    .SetGroupName ("Ndn")
+    .SetParent<super> ()
+    .template AddConstructor< ContentStoreWithBytes< Policy > > ()
+
+    .AddAttribute ("MaxBytes",
+                   "Set maximum total size of the Data packets in ContentStore, in bytes. If 0, limit is not enforced",
+                   UintegerValue (1000000),
+                   MakeUintegerAccessor (&ContentStoreWithBytes< Policy >::GetMaxBytes,
+                                         &ContentStoreWithBytes< Policy >::SetMaxBytes),
+                   MakeUintegerChecker<uint64_t> ())
+
+    .AddTraceSource ("DidEvictEntry", "Trace fired every time entry is evicted from the cache, with the number of evicted bytes",
+                     MakeTraceSourceAccessor (&ContentStoreWithBytes< Policy >::m_didEvictEntry))
+    ;
+
+  return tid;
+}
+
+
+} // namespace cs
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_CONTENT_STORE_WITH_BYTES_H_
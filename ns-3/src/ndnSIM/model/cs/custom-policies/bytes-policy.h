@@ -0,0 +1,214 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef BYTES_POLICY_H_
+#define BYTES_POLICY_H_
+
+#include <boost/intrusive/options.hpp>
+#include <boost/intrusive/list.hpp>
+
+#include <ns3/callback.h>
+#include <ns3/ndn-content-store.h>
+#include <ns3/ndn-wire.h>
+
+namespace ns3 {
+namespace ndn {
+namespace ndnSIM {
+
+/**
+ * @brief Traits for byte budget policy
+ *
+ * Keeps track of the wire size of the cached Data packets (payload
+ * included) and, when a new item would exceed the byte budget, evicts
+ * the first items of the replacement policy until the new item fits.
+ *
+ * The policy must be the first one of a multi_policy, and the
+ * replacement policy the second one: multi_policy inserts into the
+ * last policy first, so the new item is already accepted by the
+ * replacement policy when the budget is enforced.
+ */
+struct bytes_policy_traits
+{
+  /// @brief Name that can be used to identify the policy (for NS-3 object model and logging)
+  static std::string GetName () { return "BytesImpl"; }
+
+  struct policy_hook_type : public boost::intrusive::list_member_hook<> { uint32_t size; };
+
+  template<class Container>
+  struct container_hook
+  {
+    typedef boost::intrusive::member_hook< Container,
+                                           policy_hook_type,
+                                           &Container::policy_hook_ > type;
+  };
+
+  template<class Base,
+           class Container,
+           class Hook>
+  struct policy
+  {
+    typedef typename boost::intrusive::list< Container, Hook > policy_container;
+
+    static uint32_t& get_size (typename Container::iterator item)
+    {
+      return static_cast<policy_hook_type*>
+        (policy_container::value_traits::to_node_ptr(*item))->size;
+    }
+
+    static const uint32_t& get_size (typename Container::const_iterator item)
+    {
+      return static_cast<const policy_hook_type*>
+        (policy_container::value_traits::to_node_ptr(*item))->size;
+    }
+
+    class type : public policy_container
+    {
+    public:
+      typedef policy policy_base; // to get access to get_size methods from outside
+      typedef Container parent_trie;
+
+      type (Base &base)
+        : base_ (base)
+        , max_size_ (100)
+        , max_bytes_ (0)
+        , bytes_ (0)
+      {
+      }
+
+      inline void
+      update (typename parent_trie::iterator item)
+      {
+        // do nothing
+      }
+
+      inline bool
+      insert (typename parent_trie::iterator item)
+      {
+        uint32_t size = Wire::FromData (item->payload ()->GetData ())->GetSize ();
+        if (max_bytes_ != 0)
+          {
+            if (size > max_bytes_)
+              {
+                // will never fit
+                return false;
+              }
+
+            while (bytes_ + size > max_bytes_)
+              {
+                typename parent_trie::iterator victim = &(*base_.getPolicy ().template get<1> ().begin ());
+                if (victim == item)
+                  {
+                    victim = &(*(++ base_.getPolicy ().template get<1> ().begin ()));
+                  }
+                base_.erase (victim);
+              }
+          }
+
+        get_size (item) = size;
+        bytes_ += size;
+        policy_container::push_back (*item);
+        return true;
+      }
+
+      inline void
+      lookup (typename parent_trie::iterator item)
+      {
+        // do nothing
+      }
+
+      inline void
+      erase (typename parent_trie::iterator item)
+      {
+        bytes_ -= get_size (item);
+        policy_container::erase (policy_container::s_iterator_to (*item));
+
+        if (!evict_callback_.IsNull ())
+          {
+            evict_callback_ (item->payload (), get_size (item));
+          }
+      }
+
+      inline void
+      clear ()
+      {
+        policy_container::clear ();
+        bytes_ = 0;
+      }
+
+      inline void
+      set_max_size (size_t max_size)
+      {
+        max_size_ = max_size;
+      }
+
+      inline size_t
+      get_max_size () const
+      {
+        return max_size_;
+      }
+
+      inline void
+      set_max_bytes (uint64_t max_bytes)
+      {
+        max_bytes_ = max_bytes;
+      }
+
+      inline uint64_t
+      get_max_bytes () const
+      {
+        return max_bytes_;
+      }
+
+      /**
+       * @brief Get total size of the cached items, in bytes
+       */
+      inline uint64_t
+      get_bytes () const
+      {
+        return bytes_;
+      }
+
+      /**
+       * @brief Set callback fired for every item removed from the container, with its size
+       */
+      inline void
+      set_evict_callback (Callback<void, Ptr<const cs::Entry>, uint32_t> callback)
+      {
+        evict_callback_ = callback;
+      }
+
+    private:
+      type () : base_(*((Base*)0)) { };
+
+    private:
+      Base &base_;
+      size_t max_size_;
+      uint64_t max_bytes_;
+      uint64_t bytes_;
+      Callback<void, Ptr<const cs::Entry>, uint32_t> evict_callback_;
+    };
+  };
+};
+
+} // ndnSIM
+} // ndn
+} // ns3
+
+#endif // BYTES_POLICY_H_
@@ -29,6 +29,8 @@
 #define NDN_RTO_BETA 0.25
 #define NDN_RTO_K 4
 
+#include <algorithm>
+
 #include <boost/ref.hpp>
 #include <boost/lambda/lambda.hpp>
 #include <boost/lambda/bind.hpp>
@@ -51,6 +53,16 @@ struct FaceMetricByFace
 };
 
 
+/**
+ * @brief Order of the next hops: by status, then by routing cost
+ */
+static bool
+MetricLess (const FaceMetric &a, const FaceMetric &b)
+{
+  return a.GetStatus () < b.GetStatus () ||
+    (a.GetStatus () == b.GetStatus () && a.GetRoutingCost () < b.GetRoutingCost ());
+}
+
 void
 FaceMetric::UpdateRtt (const Time &rttSample)
 {
@@ -74,6 +86,59 @@ FaceMetric::UpdateRtt (const Time &rttSample)
 
 /////////////////////////////////////////////////////////////////////
 
+FaceMetricVector::const_iterator
+FaceMetricVector::find (const Ptr<Face> &face) const
+{
+  for (const_iterator record = m_faces.begin (); record != m_faces.end (); record++)
+    {
+      if (record->GetFace () == face)
+        return record;
+    }
+  return m_faces.end ();
+}
+
+std::pair<FaceMetricVector::const_iterator, bool>
+FaceMetricVector::insert (const FaceMetric &metric)
+{
+  const_iterator record = find (metric.GetFace ());
+  if (record != m_faces.end ())
+    {
+      return std::make_pair (record, false);
+    }
+
+  container::iterator position = std::upper_bound (m_faces.begin (), m_faces.end (), metric, MetricLess);
+  return std::make_pair (const_iterator (m_faces.insert (position, new FaceMetric (metric))), true);
+}
+
+size_t
+FaceMetricVector::erase (const Ptr<Face> &face)
+{
+  const_iterator record = find (face);
+  if (record == m_faces.end ())
+    {
+      return 0;
+    }
+
+  m_faces.erase (m_faces.begin () + (record - m_faces.begin ()));
+  return 1;
+}
+
+FaceMetricVector::const_iterator
+FaceMetricVector::Reorder (container::iterator record)
+{
+  if ((record == m_faces.begin () || !MetricLess (*record, *(record - 1))) &&
+      (record + 1 == m_faces.end () || !MetricLess (*(record + 1), *record)))
+    {
+      return record; // still in order
+    }
+
+  container::auto_type metric = m_faces.release (record);
+  container::iterator position = std::upper_bound (m_faces.begin (), m_faces.end (), *metric, MetricLess);
+  return m_faces.insert (position, metric.release ());
+}
+
+/////////////////////////////////////////////////////////////////////
+
 void
 Entry::UpdateFaceRtt (Ptr<Face> face, const Time &sample)
 {
@@ -85,9 +150,6 @@ Entry::UpdateFaceRtt (Ptr<Face> face, const Time &sample)
 
   m_faces.modify (record,
                   ll::bind (&FaceMetric::UpdateRtt, ll::_1, sample));
-
-  // reordering random access index same way as by metric index
-  m_faces.get<i_nth> ().rearrange (m_faces.get<i_metric> ().begin ());
 }
 
 void
@@ -103,9 +165,6 @@ Entry::UpdateStatus (Ptr<Face> face, FaceMetric::Status status)
 
   m_faces.modify (record,
                   ll::bind (&FaceMetric::SetStatus, ll::_1, status));
-
-  // reordering random access index same way as by metric index
-  m_faces.get<i_nth> ().rearrange (m_faces.get<i_metric> ().begin ());
 }
 
 void
@@ -124,16 +183,13 @@ Entry::AddOrUpdateRoutingMetric (Ptr<Face> face, int32_t metric)
     // don't update metric to higher value
     if (record->GetRoutingCost () > metric || record->GetStatus () == FaceMetric::NDN_FIB_RED)
       {
-        m_faces.modify (record,
-                        ll::bind (&FaceMetric::SetRoutingCost, ll::_1, metric));
+        record = m_faces.modify (record,
+                                 ll::bind (&FaceMetric::SetRoutingCost, ll::_1, metric));
 
         m_faces.modify (record,
                         ll::bind (&FaceMetric::SetStatus, ll::_1, FaceMetric::NDN_FIB_YELLOW));
       }
   }
-
-  // reordering random access index same way as by metric index
-  m_faces.get<i_nth> ().rearrange (m_faces.get<i_metric> ().begin ());
 }
 
 void
@@ -154,14 +210,26 @@ Entry::SetRealDelayToProducer (Ptr<Face> face, Time delay)
 void
 Entry::Invalidate ()
 {
+  // update records in the order of face pointers (modify may move the updated record)
+  std::vector< Ptr<Face> > faces;
   for (FaceMetricByFace::type::iterator face = m_faces.begin ();
        face != m_faces.end ();
        face++)
     {
-      m_faces.modify (face,
-                      ll::bind (&FaceMetric::SetRoutingCost, ll::_1, std::numeric_limits<uint16_t>::max ()));
+      faces.push_back (face->GetFace ());
+    }
+  std::sort (faces.begin (), faces.end ());
+
+  for (std::vector< Ptr<Face> >::iterator face = faces.begin ();
+       face != faces.end ();
+       face++)
+    {
+      FaceMetricByFace::type::iterator record = m_faces.find (*face);
 
-      m_faces.modify (face,
+      record = m_faces.modify (record,
+                               ll::bind (&FaceMetric::SetRoutingCost, ll::_1, std::numeric_limits<uint16_t>::max ()));
+
+      m_faces.modify (record,
                       ll::bind (&FaceMetric::SetStatus, ll::_1, FaceMetric::NDN_FIB_RED));
     }
 }
@@ -28,14 +28,7 @@
 #include "ns3/ndn-limits.h"
 #include "ns3/traced-value.h"
 
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/tag.hpp>
-#include <boost/multi_index/ordered_index.hpp>
-#include <boost/multi_index/composite_key.hpp>
-#include <boost/multi_index/hashed_index.hpp>
-#include <boost/multi_index/random_access_index.hpp>
-#include <boost/multi_index/member.hpp>
-#include <boost/multi_index/mem_fun.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
 
 namespace ns3 {
 namespace ndn {
@@ -211,46 +204,112 @@ class i_metric {};
 class i_nth {};
 /// @endcond
 
+/**
+ * @ingroup ndn-fib
+ * @brief Compact container of the next hops (FaceMetric records) of Entry
+ *
+ * FIB entries usually have only a few next hops, so they are kept in a small vector
+ * ordered by (status, routing cost), the order in which forwarding strategies try them.
+ * The same ordered vector serves all the views of the container:
+ * - get<i_metric> () (iteration by status and routing cost),
+ * - get<i_nth> () (nth best candidate),
+ * - get<i_face> () (lookup of the record for a face, by linear search).
+ *
+ * Records are updated only through modify (), which moves the updated record only if
+ * it is no longer in order.  A moved or added record is placed after all the records
+ * with the same status and routing cost.  The vector holds pointers to the records, so
+ * reordering does not copy them and sinks connected to the status trace stay with
+ * their records.
+ */
+class FaceMetricVector
+{
+public:
+  typedef boost::ptr_vector<FaceMetric> container;
+  typedef container::const_iterator iterator;
+  typedef container::const_iterator const_iterator;
+
+  /**
+   * @brief Type of the view by the specified tag (all views are the container itself)
+   */
+  template<class Tag>
+  struct index
+  {
+    typedef FaceMetricVector type;
+  };
+
+  /**
+   * @brief Get view by the specified tag (i_face, i_metric, or i_nth)
+   */
+  template<class Tag>
+  const FaceMetricVector &
+  get () const { return *this; }
+
+  const_iterator
+  begin () const { return m_faces.begin (); }
+
+  const_iterator
+  end () const { return m_faces.end (); }
+
+  size_t
+  size () const { return m_faces.size (); }
+
+  bool
+  empty () const { return m_faces.empty (); }
+
+  /**
+   * @brief Get nth record in the (status, routing cost) order
+   */
+  const FaceMetric &
+  operator [] (size_t n) const { return m_faces[n]; }
+
+  /**
+   * @brief Find record for the face
+   * @returns iterator to the record or end ()
+   */
+  const_iterator
+  find (const Ptr<Face> &face) const;
+
+  /**
+   * @brief Add record, if there is no record for the same face yet
+   */
+  std::pair<const_iterator, bool>
+  insert (const FaceMetric &metric);
+
+  /**
+   * @brief Update record using the functor and restore the order, if necessary
+   * @returns new position of the updated record
+   */
+  template<class Modifier>
+  const_iterator
+  modify (const_iterator position, Modifier modifier)
+  {
+    container::iterator record = m_faces.begin () + (position - m_faces.begin ());
+    modifier (*record);
+    return Reorder (record);
+  }
+
+  /**
+   * @brief Remove record for the face
+   * @returns number of removed records
+   */
+  size_t
+  erase (const Ptr<Face> &face);
+
+private:
+  const_iterator
+  Reorder (container::iterator record);
+
+private:
+  container m_faces;
+};
 
 /**
  * @ingroup ndn-fib
  * @brief Typedef for indexed face container of Entry
- *
- * Currently, there are 2 indexes:
- * - by face (used to find record and update metric)
- * - by metric (face ranking)
- * - random access index (for fast lookup on nth face). Order is
- *   maintained manually to be equal to the 'by metric' order
  */
 struct FaceMetricContainer
 {
-  /// @cond include_hidden
-  typedef boost::multi_index::multi_index_container<
-    FaceMetric,
-    boost::multi_index::indexed_by<
-      // For fast access to elements using Face
-      boost::multi_index::ordered_unique<
-        boost::multi_index::tag<i_face>,
-        boost::multi_index::const_mem_fun<FaceMetric,Ptr<Face>,&FaceMetric::GetFace>
-      >,
-
-      // List of available faces ordered by (status, m_routingCost)
-      boost::multi_index::ordered_non_unique<
-        boost::multi_index::tag<i_metric>,
-        boost::multi_index::composite_key<
-          FaceMetric,
-          boost::multi_index::const_mem_fun<FaceMetric,FaceMetric::Status,&FaceMetric::GetStatus>,
-          boost::multi_index::const_mem_fun<FaceMetric,int32_t,&FaceMetric::GetRoutingCost>
-        >
-      >,
-
-      // To optimize nth candidate selection (sacrifice a little bit space to gain speed)
-      boost::multi_index::random_access<
-        boost::multi_index::tag<i_nth>
-      >
-    >
-   > type;
-  /// @endcond
+  typedef FaceMetricVector type;
 };
 
 /**
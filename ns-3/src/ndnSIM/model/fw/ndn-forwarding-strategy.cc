@@ -36,6 +36,7 @@
 #include "ns3/simulator.h"
 #include "ns3/boolean.h"
 #include "ns3/string.h"
+#include "ns3/uinteger.h"
 
 #include "ns3/ndnSIM/utils/ndn-fw-hop-count-tag.h"
 
@@ -100,6 +101,18 @@ TypeId ForwardingStrategy::GetTypeId (void)
                    BooleanValue (true),
                    MakeBooleanAccessor (&ForwardingStrategy::m_detectRetransmissions),
                    MakeBooleanChecker ())
+
+    .AddAttribute ("DeadNonceLifetime", "Time to keep nonces of the erased PIT entries to detect looping Interests (0 to disable)",
+                   TimeValue (Seconds (6)),
+                   MakeTimeAccessor (&ForwardingStrategy::SetDeadNonceLifetime,
+                                     &ForwardingStrategy::GetDeadNonceLifetime),
+                   MakeTimeChecker ())
+
+    .AddAttribute ("DeadNonceListMaxSize", "Maximum number of records in the dead nonce list (0 for no limit)",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&ForwardingStrategy::SetDeadNonceListMaxSize,
+                                         &ForwardingStrategy::GetDeadNonceListMaxSize),
+                   MakeUintegerChecker<uint32_t> ())
     ;
   return tid;
 }
@@ -152,6 +165,14 @@ ForwardingStrategy::OnInterest (Ptr<Face> inFace,
   bool similarInterest = true;
   if (pitEntry == 0)
     {
+      if (m_deadNonces.Has (interest->GetName (), interest->GetNonce ()))
+        {
+          // Interest has looped back after its PIT entry was erased
+          NS_LOG_DEBUG ("Dead nonce, drop looped Interest");
+          m_dropInterests (interest, inFace);
+          return;
+        }
+
       similarInterest = false;
       pitEntry = m_pit->Create (interest);
       if (pitEntry != 0)
@@ -166,7 +187,8 @@ ForwardingStrategy::OnInterest (Ptr<Face> inFace,
     }
 
   bool isDuplicated = true;
-  if (!pitEntry->IsNonceSeen (interest->GetNonce ()))
+  if (!pitEntry->IsNonceSeen (interest->GetNonce ()) &&
+      !(similarInterest && m_deadNonces.Has (interest->GetName (), interest->GetNonce ())))
     {
       pitEntry->AddSeenNonce (interest->GetNonce ());
       isDuplicated = false;
@@ -183,9 +205,9 @@ ForwardingStrategy::OnInterest (Ptr<Face> inFace,
   if (contentObject != 0)
     {
       FwHopCountTag hopCountTag;
-      if (interest->GetPayload ()->PeekPacketTag (hopCountTag))
+      if (interest->GetPayload ()->PeekTypedTag (hopCountTag))
         {
-          contentObject->GetPayload ()->AddPacketTag (hopCountTag);
+          contentObject->GetPayload ()->AddTypedTag (hopCountTag);
         }
 
       pitEntry->AddIncoming (inFace/*, Seconds (1.0)*/);
@@ -227,9 +249,9 @@ ForwardingStrategy::OnData (Ptr<Face> inFace,
   NS_LOG_FUNCTION (inFace << data->GetName ());
   m_inData (data, inFace);
 
-  // Lookup PIT entry
-  Ptr<pit::Entry> pitEntry = m_pit->Lookup (*data);
-  if (pitEntry == 0)
+  // Lookup all PIT entries that can be satisfied by the data packet
+  std::vector< Ptr<pit::Entry> > pitEntries = m_pit->LookupAll (*data);
+  if (pitEntries.empty ())
     {
       bool cached = false;
 
@@ -256,16 +278,18 @@ ForwardingStrategy::OnData (Ptr<Face> inFace,
       DidReceiveSolicitedData (inFace, data, cached);
     }
 
-  while (pitEntry != 0)
+  BOOST_FOREACH (Ptr<pit::Entry> pitEntry, pitEntries)
     {
+      // Entry could have been satisfied while processing other entries (e.g., an application
+      // reacted to the data by sending a new interest)
+      if (pitEntry->GetIncoming ().empty ())
+        continue;
+
       // Do data plane performance measurements
       WillSatisfyPendingInterest (inFace, pitEntry);
 
       // Actually satisfy pending interest
       SatisfyPendingInterest (inFace, data, pitEntry);
-
-      // Lookup another PIT entry
-      pitEntry = m_pit->Lookup (*data);
     }
 }
 
@@ -327,6 +351,8 @@ ForwardingStrategy::DidExhaustForwardingOptions (Ptr<Face> inFace,
       // Remove also outgoing
       pitEntry->ClearOutgoing ();
 
+      AddDeadNonces (pitEntry);
+
       // Set pruning timout on PIT entry (instead of deleting the record)
       m_pit->MarkErased (pitEntry);
     }
@@ -381,6 +407,8 @@ ForwardingStrategy::SatisfyPendingInterest (Ptr<Face> inFace,
   // Remove all outgoing faces
   pitEntry->ClearOutgoing ();
 
+  AddDeadNonces (pitEntry);
+
   // Set pruning timout on PIT entry (instead of deleting the record)
   m_pit->MarkErased (pitEntry);
 }
@@ -566,6 +594,41 @@ void
 ForwardingStrategy::WillEraseTimedOutPendingInterest (Ptr<pit::Entry> pitEntry)
 {
   m_timedOutInterests (pitEntry);
+
+  AddDeadNonces (pitEntry);
+}
+
+void
+ForwardingStrategy::AddDeadNonces (Ptr<pit::Entry> pitEntry)
+{
+  BOOST_FOREACH (uint32_t nonce, pitEntry->GetSeenNonces ())
+    {
+      m_deadNonces.Add (pitEntry->GetPrefix (), nonce);
+    }
+}
+
+void
+ForwardingStrategy::SetDeadNonceLifetime (const Time &lifetime)
+{
+  m_deadNonces.SetLifetime (lifetime);
+}
+
+Time
+ForwardingStrategy::GetDeadNonceLifetime () const
+{
+  return m_deadNonces.GetLifetime ();
+}
+
+void
+ForwardingStrategy::SetDeadNonceListMaxSize (uint32_t maxSize)
+{
+  m_deadNonces.SetMaxSize (maxSize);
+}
+
+uint32_t
+ForwardingStrategy::GetDeadNonceListMaxSize () const
+{
+  return m_deadNonces.GetMaxSize ();
 }
 
 void
@@ -26,6 +26,8 @@
 #include "ns3/object.h"
 #include "ns3/traced-callback.h"
 
+#include "ns3/ndn-dead-nonce-list.h"
+
 namespace ns3 {
 namespace ndn {
 
@@ -428,11 +430,30 @@ protected:
                        Ptr<const Interest> interest,
                        Ptr<pit::Entry> pitEntry) = 0;
 
+  /**
+   * @brief Move nonces of the PIT entry to the dead nonce list (PIT entry is about to be erased)
+   */
+  void
+  AddDeadNonces (Ptr<pit::Entry> pitEntry);
+
 protected:
   // inherited from Object class
   virtual void NotifyNewAggregate (); ///< @brief Even when object is aggregated to another Object
   virtual void DoDispose (); ///< @brief Do cleanup
 
+private:
+  void
+  SetDeadNonceLifetime (const Time &lifetime);
+
+  Time
+  GetDeadNonceLifetime () const;
+
+  void
+  SetDeadNonceListMaxSize (uint32_t maxSize);
+
+  uint32_t
+  GetDeadNonceListMaxSize () const;
+
 protected:
   Ptr<Pit> m_pit; ///< \brief Reference to PIT to which this forwarding strategy is associated
   Ptr<Fib> m_fib; ///< \brief FIB
@@ -442,6 +463,8 @@ protected:
   bool m_cacheUnsolicitedData;
   bool m_detectRetransmissions;
 
+  DeadNonceList m_deadNonces; ///< @brief Nonces of the recently erased PIT entries
+
   TracedCallback<Ptr<const Interest>,
                  Ptr<const Face> > m_outInterests; ///< @brief Transmitted interests trace
 
@@ -149,11 +149,10 @@ bool
 Face::Send (Ptr<Packet> packet)
 {
   FwHopCountTag hopCount;
-  bool tagExists = packet->RemovePacketTag (hopCount);
-  if (tagExists)
+  if (packet->PeekTypedTag (hopCount))
     {
       hopCount.Increment ();
-      packet->AddPacketTag (hopCount);
+      packet->AddTypedTag (hopCount);
     }
 
   return true;
@@ -24,6 +24,8 @@
 #include "ns3/unused.h"
 #include "ns3/packet.h"
 
+#include "wire/ndnsim.h"
+
 NS_LOG_COMPONENT_DEFINE ("ndn.Interest");
 
 namespace ns3 {
@@ -53,7 +55,7 @@ Interest::Interest (const Interest &interest)
   , m_nackType         (interest.m_nackType)
   , m_exclude          (interest.m_exclude ? Create<Exclude> (*interest.GetExclude ()) : 0)
   , m_payload          (interest.GetPayload ()->Copy ())
-  , m_wire             (0)
+  , m_wire             (interest.m_wire)
 {
   NS_LOG_FUNCTION ("correct copy constructor");
 }
@@ -89,7 +91,7 @@ void
 Interest::SetScope (int8_t scope)
 {
   m_scope = scope;
-  m_wire = 0;
+  PatchWire ();
 }
 
 int8_t
@@ -102,7 +104,7 @@ void
 Interest::SetInterestLifetime (Time lifetime)
 {
   m_interestLifetime = lifetime;
-  m_wire = 0;
+  PatchWire ();
 }
 
 Time
@@ -115,7 +117,7 @@ void
 Interest::SetNonce (uint32_t nonce)
 {
   m_nonce = nonce;
-  m_wire = 0;
+  PatchWire ();
 }
 
 uint32_t
@@ -128,7 +130,7 @@ void
 Interest::SetNack (uint8_t nackType)
 {
   m_nackType = nackType;
-  m_wire = 0;
+  PatchWire ();
 }
 
 uint8_t
@@ -137,6 +139,16 @@ Interest::GetNack () const
   return m_nackType;
 }
 
+void
+Interest::PatchWire ()
+{
+  if (m_wire != 0)
+    {
+      // if wire is not in ndnSIM format, it is simply dropped and will be re-encoded when needed
+      m_wire = wire::ndnSIM::Interest::PatchWire (*this, m_wire);
+    }
+}
+
 void
 Interest::SetExclude (Ptr<Exclude> exclude)
 {
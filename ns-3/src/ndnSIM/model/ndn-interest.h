@@ -232,6 +232,12 @@ private:
   // NO_ASSIGN
   Interest &
   operator = (const Interest &other) { return *this; }
+
+  /**
+   * @brief Update fixed-size fields in the cached wire formatted packet, instead of dropping it
+   */
+  void
+  PatchWire ();
   
 private:
   Ptr<Name> m_name;         ///< @brief Interest name
@@ -112,6 +112,12 @@ Entry::AddSeenNonce (uint32_t nonce)
   m_seenNonces.insert (nonce);
 }
 
+const Entry::nonce_container &
+Entry::GetSeenNonces () const
+{
+  return m_seenNonces;
+}
+
 
 Entry::in_iterator
 Entry::AddIncoming (Ptr<Face> face)
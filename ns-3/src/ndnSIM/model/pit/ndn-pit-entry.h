@@ -37,6 +37,7 @@
 #include <boost/multi_index/member.hpp>
 // #include <boost/multi_index/mem_fun.hpp>
 #include <set>
+#include <algorithm>
 #include <boost/shared_ptr.hpp>
 
 namespace ns3 {
@@ -48,6 +49,69 @@ namespace fw { class Tag; }
 
 namespace pit {
 
+/**
+ * @ingroup ndn-pit
+ * @brief Fixed-size container of the nonces seen for a PIT entry
+ *
+ * Only the last MaxSize nonces are kept (the oldest nonce is overwritten when the
+ * container is full), which bounds memory used by each PIT entry.
+ */
+class NonceArray
+{
+public:
+  static const uint32_t MaxSize = 4;
+
+  typedef const uint32_t *iterator;
+  typedef const uint32_t *const_iterator;
+
+  NonceArray ()
+    : m_size (0)
+    , m_next (0)
+  {
+  }
+
+  const_iterator
+  find (uint32_t nonce) const
+  {
+    return std::find (begin (), end (), nonce);
+  }
+
+  void
+  insert (uint32_t nonce)
+  {
+    if (find (nonce) != end ())
+      return;
+
+    m_nonces[m_next] = nonce;
+    m_next = (m_next + 1) % MaxSize;
+    if (m_size < MaxSize)
+      m_size ++;
+  }
+
+  const_iterator
+  begin () const
+  {
+    return m_nonces;
+  }
+
+  const_iterator
+  end () const
+  {
+    return m_nonces + m_size;
+  }
+
+  uint32_t
+  size () const
+  {
+    return m_size;
+  }
+
+private:
+  uint32_t m_nonces[MaxSize];
+  uint8_t m_size;
+  uint8_t m_next;
+};
+
 /**
  * @ingroup ndn-pit
  * @brief structure for PIT entry
@@ -64,7 +128,7 @@ public:
   typedef std::set< OutgoingFace > out_container; ///< @brief outgoing faces container type
   typedef out_container::iterator out_iterator;              ///< @brief iterator to outgoing faces
 
-  typedef std::set< uint32_t > nonce_container;  ///< @brief nonce container type
+  typedef NonceArray nonce_container;  ///< @brief nonce container type
 
   /**
    * \brief PIT entry constructor
@@ -127,11 +191,17 @@ public:
    *
    * @param nonce nonce to add to the list of seen nonces
    *
-   * All nonces are stored for the lifetime of the PIT entry
+   * Only the last NonceArray::MaxSize nonces are stored for the lifetime of the PIT entry
    */
   virtual void
   AddSeenNonce (uint32_t nonce);
 
+  /**
+   * @brief Get nonces seen for the PIT entry
+   */
+  const nonce_container &
+  GetSeenNonces () const;
+
   /**
    * @brief Add `face` to the list of incoming faces
    *
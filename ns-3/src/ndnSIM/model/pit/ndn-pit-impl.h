@@ -42,6 +42,36 @@ class ForwardingStrategy;
 
 namespace pit {
 
+/// @cond include_hidden
+/**
+ * @brief Predicate selecting non-empty PIT entries that are not excluded from being
+ * satisfied by Data with the specified name
+ */
+struct EntryMatchesData
+{
+  EntryMatchesData (const Name &name)
+    : m_name (name)
+  {
+  }
+
+  bool
+  operator () (Ptr<Entry> entry) const
+  {
+    if (entry->GetIncoming ().empty ())
+      return false;
+
+    Ptr<const Exclude> exclude = entry->GetInterest ()->GetExclude ();
+    size_t prefixSize = entry->GetPrefix ().size ();
+    if (exclude == 0 || prefixSize >= m_name.size ())
+      return true;
+
+    return !exclude->isExcluded (m_name.get (prefixSize));
+  }
+
+  const Name &m_name;
+};
+/// @endcond
+
 /**
  * @ingroup ndn-pit
  * @brief Class implementing Pending Interests Table
@@ -83,6 +113,9 @@ public:
   virtual Ptr<Entry>
   Lookup (const Data &header);
 
+  virtual std::vector< Ptr<Entry> >
+  LookupAll (const Data &header);
+
   virtual Ptr<Entry>
   Lookup (const Interest &header);
 
@@ -302,8 +335,7 @@ template<class Policy>
 Ptr<Entry>
 PitImpl<Policy>::Lookup (const Data &header)
 {
-  /// @todo use predicate to search with exclude filters
-  typename super::iterator item = super::longest_prefix_match_if (header.GetName (), EntryIsNotEmpty ());
+  typename super::iterator item = super::longest_prefix_match_if (header.GetName (), EntryMatchesData (header.GetName ()));
 
   if (item == super::end ())
     return 0;
@@ -311,6 +343,24 @@ PitImpl<Policy>::Lookup (const Data &header)
     return item->payload (); // which could also be 0
 }
 
+template<class Policy>
+std::vector< Ptr<Entry> >
+PitImpl<Policy>::LookupAll (const Data &header)
+{
+  std::vector<typename super::iterator> items;
+  super::prefix_matches_if (header.GetName (), EntryMatchesData (header.GetName ()), items);
+
+  std::vector< Ptr<Entry> > entries;
+  entries.reserve (items.size ());
+  for (typename std::vector<typename super::iterator>::iterator item = items.begin ();
+       item != items.end ();
+       item++)
+    {
+      entries.push_back ((*item)->payload ());
+    }
+  return entries;
+}
+
 template<class Policy>
 Ptr<Entry>
 PitImpl<Policy>::Lookup (const Interest &header)
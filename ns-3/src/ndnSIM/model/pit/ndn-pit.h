@@ -27,6 +27,8 @@
 
 #include "ndn-pit-entry.h"
 
+#include <vector>
+
 namespace ns3 {
 namespace ndn {
 
@@ -91,6 +93,20 @@ public:
   virtual Ptr<pit::Entry>
   Lookup (const Data &header) = 0;
 
+  /**
+   * \brief Find all PIT entries that can be satisfied by the given content object
+   *
+   * Unlike Lookup (const Data &), all matching records (entries with shorter or equal
+   * prefix as in content object, which are not excluded by Interest exclude filters) are
+   * found during a single traversal of the PIT.
+   *
+   * \param header Data packet for which to lookup the entries
+   * \returns list of PIT entries, ordered from the longest to the shortest prefix.
+   *          If no records found, the list is empty
+   */
+  virtual std::vector< Ptr<pit::Entry> >
+  LookupAll (const Data &header) = 0;
+
   /**
    * \brief Find a PIT entry for the given content interest
    * \param header parsed interest header
@@ -25,7 +25,80 @@ NDN_NAMESPACE_BEGIN
 namespace wire {
 namespace ndnSIM {
 
+/**
+ * @brief Fixed-size fields at the beginning of ndnSIM-encoded Interest (version, type,
+ *        length, Nonce, Scope, NACK type, and InterestLifetime)
+ */
+class InterestFixedFields : public Header
+{
+public:
+  static const uint32_t Size = 12;
+
+  InterestFixedFields ()
+    : m_interest (0)
+    , m_length (0)
+  {
+  }
+
+  InterestFixedFields (const ndn::Interest *interest, uint16_t length)
+    : m_interest (interest)
+    , m_length (length)
+  {
+  }
+
+  static void
+  SerializeFields (Buffer::Iterator &start, const ndn::Interest &interest)
+  {
+    start.WriteU32 (interest.GetNonce ());
+    start.WriteU8 (interest.GetScope ());
+    start.WriteU8 (interest.GetNack ());
+
+    NS_ASSERT_MSG (0 <= interest.GetInterestLifetime ().ToInteger (Time::S) && interest.GetInterestLifetime ().ToInteger (Time::S) < 65535,
+                   "Incorrect InterestLifetime (should not be smaller than 0 and larger than 65535");
+
+    // rounding timestamp value to seconds
+    start.WriteU16 (static_cast<uint16_t> (interest.GetInterestLifetime ().ToInteger (Time::S)));
+  }
+
+  // from Header
+  static TypeId
+  GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("ns3::ndn::Interest::ndnSIM::FixedFields")
+      .SetGroupName ("Ndn")
+      .SetParent<Header> ()
+      ;
+    return tid;
+  }
+
+  virtual TypeId GetInstanceTypeId (void) const { return GetTypeId (); }
+  virtual void Print (std::ostream &os) const { }
+  virtual uint32_t GetSerializedSize (void) const { return Size; }
+
+  virtual void
+  Serialize (Buffer::Iterator start) const
+  {
+    start.WriteU8 (0x80); // version
+    start.WriteU8 (0x00); // packet type
+    start.WriteU16 (m_length);
+    SerializeFields (start, *m_interest);
+  }
+
+  virtual uint32_t
+  Deserialize (Buffer::Iterator start)
+  {
+    // never removed from the packet as a separate header
+    NS_FATAL_ERROR ("Not supported");
+    return 0;
+  }
+
+private:
+  const ndn::Interest *m_interest;
+  uint16_t m_length;
+};
+
 NS_OBJECT_ENSURE_REGISTERED (Interest);
+NS_OBJECT_ENSURE_REGISTERED (InterestFixedFields);
 NS_OBJECT_ENSURE_REGISTERED (Data);
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -98,6 +171,22 @@ Interest::FromWire (Ptr<Packet> packet)
   return interest;
 }
 
+Ptr<const Packet>
+Interest::PatchWire (const ndn::Interest &interest, Ptr<const Packet> wire)
+{
+  uint8_t prefix[4];
+  if (wire->CopyData (prefix, 4) != 4 || prefix[0] != 0x80 || prefix[1] != 0x00)
+    {
+      return 0;
+    }
+
+  Ptr<Packet> packet = wire->Copy ();
+  packet->RemoveAtStart (InterestFixedFields::Size);
+  packet->AddHeader (InterestFixedFields (&interest, prefix[2] | (prefix[3] << 8)));
+
+  return packet;
+}
+
 uint32_t
 Interest::GetSerializedSize (void) const
 {
@@ -119,20 +208,15 @@ Interest::GetSerializedSize (void) const
 void
 Interest::Serialize (Buffer::Iterator start) const
 {
+  Buffer::Iterator begin = start;
+
   start.WriteU8 (0x80); // version
   start.WriteU8 (0x00); // packet type
 
-  start.WriteU16 (GetSerializedSize () - 4);
-
-  start.WriteU32 (m_interest->GetNonce ());
-  start.WriteU8 (m_interest->GetScope ());
-  start.WriteU8 (m_interest->GetNack ());
+  Buffer::Iterator length = start;
+  start.Next (2); // length, written at the end
 
-  NS_ASSERT_MSG (0 <= m_interest->GetInterestLifetime ().ToInteger (Time::S) && m_interest->GetInterestLifetime ().ToInteger (Time::S) < 65535,
-                 "Incorrect InterestLifetime (should not be smaller than 0 and larger than 65535");
-  
-  // rounding timestamp value to seconds
-  start.WriteU16 (static_cast<uint16_t> (m_interest->GetInterestLifetime ().ToInteger (Time::S)));
+  InterestFixedFields::SerializeFields (start, *m_interest);
 
   NdnSim::SerializeName (start, m_interest->GetName ());
 
@@ -142,12 +226,15 @@ Interest::Serialize (Buffer::Iterator start) const
     }
   else
     {
-      start.WriteU16 (1 + NdnSim::SerializedSizeExclude (*m_interest->GetExclude ()));
+      Buffer::Iterator selectorsLength = start;
+      start.Next (2);
       start.WriteU8 (0x01);
-      NdnSim::SerializeExclude (start, *m_interest->GetExclude ());
+      selectorsLength.WriteU16 (1 + NdnSim::SerializeExclude (start, *m_interest->GetExclude ()));
     }
   
   start.WriteU16 (0); // no options
+
+  length.WriteU16 (start.GetDistanceFrom (begin) - 4);
 }
 
 uint32_t
@@ -280,9 +367,13 @@ Data::GetSerializedSize () const
 void
 Data::Serialize (Buffer::Iterator start) const
 {
+  Buffer::Iterator begin = start;
+
   start.WriteU8 (0x80); // version
   start.WriteU8 (0x01); // packet type
-  start.WriteU16 (GetSerializedSize () - 4); // length
+
+  Buffer::Iterator length = start;
+  start.Next (2); // length, written at the end
   
   if (m_data->GetSignature () != 0)
     {
@@ -308,6 +399,7 @@ Data::Serialize (Buffer::Iterator start) const
   start.WriteU16 (0); // reserved 
   start.WriteU16 (0); // Length (ContentInfoOptions)
 
+  length.WriteU16 (start.GetDistanceFrom (begin) - 4);
   // that's it folks
 }
 
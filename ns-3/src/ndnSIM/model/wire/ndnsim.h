@@ -85,6 +85,20 @@ public:
 
   static Ptr<ndn::Interest>
   FromWire (Ptr<Packet> packet);
+
+  /**
+   * @brief Update Nonce, Scope, NACK type, and InterestLifetime in the existing wire encoding
+   *
+   * These fields have fixed positions at the beginning of the ndnSIM-encoded Interest, so
+   * the rest of the encoding (name, selectors, options, and payload) is reused without
+   * re-encoding.
+   *
+   * @param interest Interest with the updated field values
+   * @param wire     wire encoding of the Interest
+   * @returns updated copy of the wire encoding or 0, if wire is not in ndnSIM format
+   */
+  static Ptr<const Packet>
+  PatchWire (const ndn::Interest &interest, Ptr<const Packet> wire);
   
   // from Header
   static TypeId GetTypeId (void); 
@@ -10,6 +10,7 @@
 
 #include "wire-ndnsim.h"
 #include <boost/foreach.hpp>
+#include <vector>
 
 NDN_NAMESPACE_BEGIN
 
@@ -24,7 +25,7 @@ NdnSim::SerializeName (Buffer::Iterator &i, const Name &name)
 {
   Buffer::Iterator start = i;
 
-  i.WriteU16 (static_cast<uint16_t> (SerializedSizeName (name)-2));
+  i.Next (2); // length is known only after the components are written
 
   for (Name::const_iterator item = name.begin ();
        item != name.end ();
@@ -34,7 +35,11 @@ NdnSim::SerializeName (Buffer::Iterator &i, const Name &name)
       i.Write (reinterpret_cast<const uint8_t*> (item->buf ()), item->size ());
     }
 
-  return i.GetDistanceFrom (start);
+  size_t nameSerializedSize = i.GetDistanceFrom (start);
+  NS_ASSERT_MSG (nameSerializedSize < 30000, "Name is too long (> 30kbytes)");
+
+  start.WriteU16 (static_cast<uint16_t> (nameSerializedSize-2));
+  return nameSerializedSize;
 }
 
 size_t
@@ -59,15 +64,33 @@ NdnSim::DeserializeName (Buffer::Iterator &i)
   Ptr<Name> name = Create<Name> ();
 
   uint16_t nameLength = i.ReadU16 ();
-  while (nameLength > 0)
+  if (nameLength == 0)
+    return name;
+
+  // read all components at once, short names do not need a heap buffer
+  uint8_t stackBuffer[256];
+  std::vector<uint8_t> heapBuffer;
+  uint8_t *buffer = stackBuffer;
+  if (nameLength > sizeof (stackBuffer))
     {
-      uint16_t length = i.ReadU16 ();
-      nameLength = nameLength - 2 - length;
+      heapBuffer.resize (nameLength);
+      buffer = &heapBuffer[0];
+    }
+  i.Read (buffer, nameLength);
 
-      uint8_t tmp[length];
-      i.Read (tmp, length);
+  const uint8_t *item = buffer;
+  const uint8_t *end = buffer + nameLength;
+  while (item + 2 <= end)
+    {
+      uint16_t length = item[0] | (static_cast<uint16_t> (item[1]) << 8); // same byte order as ReadU16
+      item += 2;
+      if (length > end - item)
+        {
+          NS_FATAL_ERROR ("Incorrect format of Name");
+        }
 
-      name->append (tmp, length);
+      name->append (item, length);
+      item += length;
     }
 
   return name;
@@ -79,7 +102,7 @@ NdnSim::SerializeExclude (Buffer::Iterator &i, const Exclude &exclude)
 {
   Buffer::Iterator start = i;
 
-  i.WriteU16 (static_cast<uint16_t> (SerializedSizeExclude (exclude)-2));
+  i.Next (2); // length is known only after the elements are written
 
   for (Exclude::const_reverse_iterator item = exclude.rbegin ();
        item != exclude.rend ();
@@ -96,7 +119,10 @@ NdnSim::SerializeExclude (Buffer::Iterator &i, const Exclude &exclude)
           i.WriteU8 (ExcludeAnyType);
         }
     }
-  return i.GetDistanceFrom (start);
+
+  size_t excludeSerializedSize = i.GetDistanceFrom (start);
+  start.WriteU16 (static_cast<uint16_t> (excludeSerializedSize-2));
+  return excludeSerializedSize;
 }
 
 size_t
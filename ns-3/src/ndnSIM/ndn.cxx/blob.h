@@ -88,9 +88,6 @@ public:
 
   bool empty () const { return m_data.empty (); }
 
-  Blob &
-  operator = (const Blob &other) { m_data = other.m_data; return *this; }
-
   reference operator [] (size_type pos) { return m_data [pos]; }
   const_reference operator [] (size_type pos) const { return m_data [pos]; }
 
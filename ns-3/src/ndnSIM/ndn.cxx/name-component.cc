@@ -39,10 +39,8 @@ Component::Component (std::string::const_iterator begin, std::string::const_iter
 }
 
 Component::Component (const void *buf, size_t length)
+  : Blob (buf, length)
 {
-  copy (static_cast<const char*> (buf),
-        static_cast<const char*> (buf)+length,
-        std::back_inserter (*this));
 }
 
 Component &
@@ -128,7 +128,6 @@ TcpFace::TcpFace (Ptr<Node> node, Ptr<Socket> socket, Ipv4Address address)
   : Face (node)
   , m_socket (socket)
   , m_address (address)
-  , m_pendingPacketLength (0)
 {
   SetMetric (1); // default metric
 }
@@ -169,11 +168,11 @@ TcpFace::Send (Ptr<Packet> packet)
   
   NS_LOG_FUNCTION (this << packet);
 
-  Ptr<Packet> boundary = Create<Packet> ();
+  // packet is owned by the send path (freshly encoded by Wire), so the length prefix
+  // can be written directly into its buffer headroom and sent with a single call
   TcpBoundaryHeader hdr (packet);
-  boundary->AddHeader (hdr);
-  
-  m_socket->Send (boundary);
+  packet->AddHeader (hdr);
+
   m_socket->Send (packet);
 
   return true;
@@ -183,55 +182,42 @@ void
 TcpFace::ReceiveFromTcp (Ptr< Socket > clientSocket)
 {
   NS_LOG_FUNCTION (this << clientSocket);
-  TcpBoundaryHeader hdr;
 
-  if (m_pendingPacketLength > 0)
+  Ptr<Packet> received;
+  while ((received = clientSocket->Recv ()) != 0 && received->GetSize () > 0)
     {
-      if (clientSocket->GetRxAvailable () >= m_pendingPacketLength)
-        {
-          Ptr<Packet> realPacket = clientSocket->Recv (m_pendingPacketLength, 0);
-          NS_LOG_DEBUG ("+++ Expected " << m_pendingPacketLength << " bytes, got " << realPacket->GetSize () << " bytes");
-          if (realPacket == 0)
-            return;
-          
-          Receive (realPacket);
-        }
+      if (m_reassemblyBuffer == 0)
+        m_reassemblyBuffer = received;
       else
-        return; // still not ready
+        m_reassemblyBuffer->AddAtEnd (received);
     }
-  
-  m_pendingPacketLength = 0;
-  
-  while (clientSocket->GetRxAvailable () >= hdr.GetSerializedSize ())
+
+  if (m_reassemblyBuffer == 0)
+    return;
+
+  // extract all complete back-to-back frames.  Every frame is a fragment that shares
+  // data with the reassembly buffer, so payload bytes are never copied here
+  TcpBoundaryHeader hdr;
+  while (m_reassemblyBuffer->GetSize () >= hdr.GetSerializedSize ())
     {
-      Ptr<Packet> boundary = clientSocket->Recv (hdr.GetSerializedSize (), 0);
-      if (boundary == 0)
-        return; // no idea why it would happen...
-
-      NS_LOG_DEBUG ("Expected 4 bytes, got " << boundary->GetSize () << " bytes");
-      
-      boundary->RemoveHeader (hdr);
-      NS_LOG_DEBUG ("Header specifies length: " << hdr.GetLength ());
-      m_pendingPacketLength = hdr.GetLength ();
-      
-      if (clientSocket->GetRxAvailable () >= hdr.GetLength ())
+      m_reassemblyBuffer->PeekHeader (hdr);
+      uint32_t frameSize = hdr.GetSerializedSize () + hdr.GetLength ();
+      if (m_reassemblyBuffer->GetSize () < frameSize)
         {
-          Ptr<Packet> realPacket = clientSocket->Recv (hdr.GetLength (), 0);
-          if (realPacket == 0)
-            {
-              NS_LOG_DEBUG ("Got nothing, but requested at least " << hdr.GetLength ());
-              return;
-            }
-          
-          NS_LOG_DEBUG ("Receiving data " << hdr.GetLength () << " bytes, got " << realPacket->GetSize () << " bytes");
-
-          Receive (realPacket);
-          m_pendingPacketLength = 0;
-        }
-      else
-        {
-          return;
+          NS_LOG_DEBUG ("Incomplete frame: expected " << frameSize << " bytes, got " << m_reassemblyBuffer->GetSize () << " bytes");
+          return; // wait for the rest
         }
+
+      Ptr<Packet> frame = m_reassemblyBuffer->CreateFragment (hdr.GetSerializedSize (), hdr.GetLength ());
+      m_reassemblyBuffer->RemoveAtStart (frameSize);
+
+      NS_LOG_DEBUG ("Receiving data " << hdr.GetLength () << " bytes");
+      Receive (frame);
+    }
+
+  if (m_reassemblyBuffer->GetSize () == 0)
+    {
+      m_reassemblyBuffer = 0;
     }
 }
 
@@ -92,7 +92,7 @@ private:
 private:
   Ptr<Socket> m_socket;
   Ipv4Address m_address;
-  uint32_t m_pendingPacketLength;
+  Ptr<Packet> m_reassemblyBuffer; ///< \brief Received bytes that do not yet form a complete frame
   Callback< void, Ptr<Face> > m_onCreateCallback;
 };
 
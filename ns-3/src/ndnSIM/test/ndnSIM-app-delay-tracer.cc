@@ -0,0 +1,174 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2013, Regents of the University of California
+ *                     Alexander Afanasyev
+ *
+ * GNU v3.0 license, See the LICENSE file for more information
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "ndnSIM-app-delay-tracer.h"
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/point-to-point-module.h"
+
+#include "ns3/ndn-delay-histogram.h"
+
+#include <boost/make_shared.hpp>
+#include <algorithm>
+#include <sstream>
+#include <cmath>
+
+NS_LOG_COMPONENT_DEFINE ("ndn.AppDelayTracerTest");
+
+namespace ns3
+{
+
+/// exact value at rank ceil (q * n), the same definition as used by DelayHistogram
+static double
+ExactQuantile (const std::vector<double> &sorted, double q)
+{
+  size_t rank = static_cast<size_t> (std::ceil (q * sorted.size ()));
+  if (rank < 1)
+    rank = 1;
+  return sorted[rank - 1];
+}
+
+void
+AppDelayTracerTest::CheckQuantiles (std::vector<double> values, double min, double p50, double p90, double p99, double max,
+                                    double relativeError)
+{
+  std::sort (values.begin (), values.end ());
+
+  NS_TEST_ASSERT_MSG_EQ_TOL (min, values.front (), values.front () * relativeError, "Min differs");
+  NS_TEST_ASSERT_MSG_EQ_TOL (max, values.back (),  values.back () * relativeError,  "Max differs");
+
+  double exact = ExactQuantile (values, 0.5);
+  NS_TEST_ASSERT_MSG_EQ_TOL (p50, exact, exact * relativeError, "50th percentile is out of error bound");
+  exact = ExactQuantile (values, 0.9);
+  NS_TEST_ASSERT_MSG_EQ_TOL (p90, exact, exact * relativeError, "90th percentile is out of error bound");
+  exact = ExactQuantile (values, 0.99);
+  NS_TEST_ASSERT_MSG_EQ_TOL (p99, exact, exact * relativeError, "99th percentile is out of error bound");
+}
+
+void
+AppDelayTracerTest::CheckHistogram ()
+{
+  ndn::DelayHistogram histogram;
+  std::vector<double> values;
+
+  // heavy-tailed delays between 1us and several seconds
+  ExponentialVariable rtt (0.05, 10);
+  for (uint32_t i = 0; i < 100000; i++)
+    {
+      Time delay = Seconds (rtt.GetValue () + 0.000001);
+      histogram.Add (delay);
+      values.push_back (delay.ToDouble (Time::S));
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (histogram.GetCount (), values.size (), "Count differs");
+  CheckQuantiles (values,
+                  histogram.GetMin ().ToDouble (Time::S),
+                  histogram.GetQuantile (0.5).ToDouble (Time::S),
+                  histogram.GetQuantile (0.9).ToDouble (Time::S),
+                  histogram.GetQuantile (0.99).ToDouble (Time::S),
+                  histogram.GetMax ().ToDouble (Time::S),
+                  histogram.GetRelativeError ());
+
+  // small values are counted exactly
+  ndn::DelayHistogram exact;
+  for (uint64_t value = 0; value < 64; value++)
+    {
+      exact.Add (value);
+    }
+  NS_TEST_ASSERT_MSG_EQ (exact.GetQuantile (0.5).GetNanoSeconds (), 31, "Exact range is not exact");
+}
+
+void
+AppDelayTracerTest::CheckTracer ()
+{
+  Config::SetDefault ("ns3::PointToPointNetDevice::DataRate", StringValue ("1Mbps"));
+  Config::SetDefault ("ns3::PointToPointChannel::Delay", StringValue ("10ms"));
+  Config::SetDefault ("ns3::DropTailQueue::MaxPackets", StringValue ("20"));
+
+  NodeContainer nodes;
+  nodes.Create (3);
+
+  PointToPointHelper p2p;
+  p2p.Install (nodes.Get (0), nodes.Get (1));
+  p2p.Install (nodes.Get (1), nodes.Get (2));
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetDefaultRoutes (true);
+  ndnHelper.InstallAll ();
+
+  // randomized requests with rate close to the link capacity give a wide range of queuing delays
+  ndn::AppHelper consumerHelper ("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetPrefix ("/prefix");
+  consumerHelper.SetAttribute ("Frequency", StringValue ("110"));
+  consumerHelper.SetAttribute ("Randomize", StringValue ("exponential"));
+  consumerHelper.Install (nodes.Get (0));
+
+  ndn::AppHelper producerHelper ("ns3::ndn::Producer");
+  producerHelper.SetPrefix ("/prefix");
+  producerHelper.SetAttribute ("PayloadSize", StringValue("1024"));
+  producerHelper.Install (nodes.Get (2));
+
+  boost::shared_ptr<std::ostringstream> raw = boost::make_shared<std::ostringstream> ();
+  boost::shared_ptr<std::ostringstream> aggregated = boost::make_shared<std::ostringstream> ();
+
+  Ptr<ndn::AppDelayTracer> rawTracer = ndn::AppDelayTracer::Install (nodes.Get (0), raw);
+  Ptr<ndn::AppDelayTracer> aggregatedTracer = ndn::AppDelayTracer::Install (nodes.Get (0), aggregated,
+                                                                          ndn::AppDelayTracer::PER_APP);
+
+  Simulator::Stop (Seconds (20.0));
+  Simulator::Run ();
+  Simulator::Destroy (); // aggregated data is written at this point
+
+  std::vector<double> values;
+  std::istringstream rawIs (raw->str ());
+  std::string line;
+  while (std::getline (rawIs, line))
+    {
+      std::istringstream row (line);
+      double time, delayS, delayUs;
+      std::string node, type;
+      uint32_t appId, seqNo;
+      row >> time >> node >> appId >> seqNo >> type >> delayS >> delayUs;
+      if (type == "FullDelay")
+        {
+          values.push_back (delayUs / 1000000.0);
+        }
+    }
+  NS_TEST_ASSERT_MSG_GT (values.size (), 1000, "Too few samples");
+
+  bool found = false;
+  std::istringstream aggregatedIs (aggregated->str ());
+  while (std::getline (aggregatedIs, line))
+    {
+      std::istringstream row (line);
+      double time, min, mean, p50, p90, p99, p999, max;
+      std::string node, appId, type;
+      uint64_t samples;
+      row >> time >> node >> appId >> type >> samples >> min >> mean >> p50 >> p90 >> p99 >> p999 >> max;
+      if (type != "FullDelay")
+        continue;
+
+      found = true;
+      NS_TEST_ASSERT_MSG_EQ (samples, values.size (), "Number of samples differs from raw output");
+
+      // histogram error plus rounding of the text output
+      CheckQuantiles (values, min, p50, p90, p99, max, ndn::DelayHistogram ().GetRelativeError () + 0.0001);
+    }
+  NS_TEST_ASSERT_MSG_EQ (found, true, "No aggregated output");
+}
+
+void
+AppDelayTracerTest::DoRun ()
+{
+  CheckHistogram ();
+  CheckTracer ();
+}
+
+}
@@ -0,0 +1,41 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2013, Regents of the University of California
+ *                     Alexander Afanasyev
+ *
+ * GNU v3.0 license, See the LICENSE file for more information
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef NDNSIM_TEST_APP_DELAY_TRACER_H
+#define NDNSIM_TEST_APP_DELAY_TRACER_H
+
+#include "ns3/test.h"
+#include "ns3/ptr.h"
+
+#include <vector>
+
+namespace ns3 {
+
+class AppDelayTracerTest : public TestCase
+{
+public:
+  AppDelayTracerTest ()
+    : TestCase ("AppDelayTracer aggregated mode test")
+  {
+  }
+    
+private:
+  virtual void DoRun ();
+
+  void CheckHistogram ();
+  void CheckTracer ();
+
+  void CheckQuantiles (std::vector<double> values, double min, double p50, double p90, double p99, double max,
+                       double relativeError);
+};
+  
+}
+
+#endif // NDNSIM_TEST_APP_DELAY_TRACER_H
@@ -0,0 +1,277 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2013, Regents of the University of California
+ *                     Alexander Afanasyev
+ *
+ * GNU v3.0 license, See the LICENSE file for more information
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "ndnSIM-cs-policies.h"
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <boost/lexical_cast.hpp>
+
+NS_LOG_COMPONENT_DEFINE ("ndn.CsPoliciesTest");
+
+namespace ns3
+{
+
+static Ptr<ndn::Name>
+MakeName (uint32_t seq)
+{
+  Ptr<ndn::Name> name = Create<ndn::Name> ("/test");
+  name->appendSeqNum (seq);
+  return name;
+}
+
+static uint32_t
+GetPayloadSize (uint32_t seq)
+{
+  const uint32_t sizes[] = { 100, 500, 1000 };
+  return sizes[seq % 3];
+}
+
+Ptr<ndn::ContentStore>
+CsPoliciesTest::CreateContentStore (const std::string &policy, uint32_t maxSize, uint64_t maxBytes/* = 0*/)
+{
+  ObjectFactory factory;
+  factory.SetTypeId ("ns3::ndn::cs::" + policy);
+  factory.Set ("MaxSize", StringValue (boost::lexical_cast<std::string> (maxSize)));
+  if (maxBytes != 0)
+    {
+      factory.Set ("MaxBytes", UintegerValue (maxBytes));
+    }
+  return factory.Create<ndn::ContentStore> ();
+}
+
+bool
+CsPoliciesTest::Request (Ptr<ndn::ContentStore> cs, uint32_t seq, uint32_t payloadSize/* = 100*/)
+{
+  Ptr<ndn::Interest> interest = Create<ndn::Interest> ();
+  interest->SetName (MakeName (seq));
+
+  Ptr<ndn::Data> data = cs->Lookup (interest);
+  if (data != 0)
+    {
+      NS_TEST_EXPECT_MSG_EQ (data->GetName (), interest->GetName (), "Wrong Data returned by the content store");
+      return true;
+    }
+
+  data = Create<ndn::Data> (Create<Packet> (payloadSize));
+  data->SetName (MakeName (seq));
+  cs->Add (data);
+  return false;
+}
+
+bool
+CsPoliciesTest::Contains (Ptr<ndn::ContentStore> cs, uint32_t seq)
+{
+  // iteration does not change the state of the policy, unlike Lookup
+  Ptr<ndn::Name> name = MakeName (seq);
+  for (Ptr<ndn::cs::Entry> entry = cs->Begin (); entry != cs->End (); entry = cs->Next (entry))
+    {
+      if (entry->GetName () == *name)
+        {
+          return true;
+        }
+    }
+  return false;
+}
+
+uint64_t
+CsPoliciesTest::GetBytes (Ptr<ndn::ContentStore> cs)
+{
+  uint64_t bytes = 0;
+  for (Ptr<ndn::cs::Entry> entry = cs->Begin (); entry != cs->End (); entry = cs->Next (entry))
+    {
+      bytes += ndn::Wire::FromData (entry->GetData ())->GetSize ();
+    }
+  return bytes;
+}
+
+void
+CsPoliciesTest::Evicted (Ptr<const ndn::cs::Entry> entry, uint32_t size)
+{
+  NS_TEST_EXPECT_MSG_EQ (size, ndn::Wire::FromData (entry->GetData ())->GetSize (), "Wrong size of the evicted entry");
+  m_evictedBytes += size;
+}
+
+void
+CsPoliciesTest::CheckRandomStream (const std::string &policy)
+{
+  Ptr<ndn::ContentStore> cs = CreateContentStore (policy, 10);
+
+  UniformVariable rand (0, 50);
+  uint32_t hits = 0;
+  for (uint32_t i = 0; i < 2000; i++)
+    {
+      // skewed towards the small sequence numbers
+      uint32_t seq = std::min (rand.GetInteger (0, 50), rand.GetInteger (0, 50));
+      bool cached = Contains (cs, seq);
+      bool hit = Request (cs, seq);
+      NS_TEST_EXPECT_MSG_EQ (hit, cached, policy << ": lookup does not match the content of the store");
+      hits += hit;
+
+      NS_TEST_ASSERT_MSG_LT_OR_EQ (cs->GetSize (), 10U, policy << ": the content store exceeds MaxSize");
+
+      uint32_t entries = 0;
+      for (Ptr<ndn::cs::Entry> entry = cs->Begin (); entry != cs->End (); entry = cs->Next (entry))
+        {
+          entries++;
+        }
+      NS_TEST_ASSERT_MSG_EQ (entries, cs->GetSize (), policy << ": the policy and the trie do not match");
+    }
+  NS_TEST_EXPECT_MSG_GT (hits, 0U, policy << ": no hits");
+}
+
+void
+CsPoliciesTest::CheckLfu ()
+{
+  Ptr<ndn::ContentStore> cs = CreateContentStore ("Lfu", 3);
+  Request (cs, 1);
+  Request (cs, 2);
+  Request (cs, 3);
+  Request (cs, 1);
+  Request (cs, 1);
+  Request (cs, 2);
+
+  // 3 is the least frequently used
+  Request (cs, 4);
+  NS_TEST_EXPECT_MSG_EQ (Contains (cs, 3), false, "Lfu: the least frequently used entry should be evicted");
+  NS_TEST_EXPECT_MSG_EQ (Contains (cs, 4), true, "Lfu: new entry not added");
+
+  // 2 and 4 are looked up once: the oldest of them is evicted
+  Request (cs, 4);
+  Request (cs, 5);
+  NS_TEST_EXPECT_MSG_EQ (Contains (cs, 2), false, "Lfu: the oldest of the least frequently used entries should be evicted");
+  NS_TEST_EXPECT_MSG_EQ (Contains (cs, 1), true, "Lfu: the most frequently used entry should stay");
+  NS_TEST_EXPECT_MSG_EQ (Contains (cs, 4), true, "Lfu: entry should stay");
+  NS_TEST_EXPECT_MSG_EQ (Contains (cs, 5), true, "Lfu: new entry not added");
+}
+
+void
+CsPoliciesTest::CheckTinyLfu ()
+{
+  Ptr<ndn::ContentStore> cs = CreateContentStore ("TinyLfu", 3);
+  for (uint32_t seq = 1; seq <= 3; seq++)
+    {
+      Request (cs, seq);
+    }
+  for (uint32_t seq = 1; seq <= 3; seq++)
+    {
+      Request (cs, seq);
+    }
+
+  // 4 is admitted only once it was requested more often than the LRU entry (1)
+  Request (cs, 4);
+  NS_TEST_EXPECT_MSG_EQ (Contains (cs, 4), false, "TinyLfu: new entry should not be admitted");
+  Request (cs, 4);
+  NS_TEST_EXPECT_MSG_EQ (Contains (cs, 4), false, "TinyLfu: new entry should not be admitted");
+  NS_TEST_EXPECT_MSG_EQ (Contains (cs, 1), true, "TinyLfu: entry should stay");
+  Request (cs, 4);
+  NS_TEST_EXPECT_MSG_EQ (Contains (cs, 4), true, "TinyLfu: new entry should be admitted");
+  NS_TEST_EXPECT_MSG_EQ (Contains (cs, 1), false, "TinyLfu: LRU entry should be evicted");
+  NS_TEST_EXPECT_MSG_EQ (cs->GetSize (), 3U, "TinyLfu: wrong size");
+}
+
+void
+CsPoliciesTest::CheckScanResistance (const std::string &policy)
+{
+  Ptr<ndn::ContentStore> cs = CreateContentStore (policy, 10);
+  Request (cs, 1);
+  Request (cs, 2);
+  Request (cs, 1);
+  Request (cs, 2);
+
+  // a scan of contents requested only once does not evict the popular ones
+  for (uint32_t seq = 100; seq < 200; seq++)
+    {
+      Request (cs, seq);
+    }
+  NS_TEST_EXPECT_MSG_EQ (Contains (cs, 1), true, policy << ": popular entry evicted by a scan");
+  NS_TEST_EXPECT_MSG_EQ (Contains (cs, 2), true, policy << ": popular entry evicted by a scan");
+  NS_TEST_EXPECT_MSG_EQ (cs->GetSize (), 10U, policy << ": wrong size");
+}
+
+void
+CsPoliciesTest::CheckBytes (const std::string &policy)
+{
+  Ptr<ndn::ContentStore> cs = CreateContentStore ("Bytes::" + policy, 0, 3000);
+  m_evictedBytes = 0;
+  cs->TraceConnectWithoutContext ("DidEvictEntry", MakeCallback (&CsPoliciesTest::Evicted, this));
+
+  UniformVariable rand (0, 50);
+  uint64_t addedBytes = 0;
+  uint32_t hits = 0;
+  for (uint32_t i = 0; i < 2000; i++)
+    {
+      uint32_t seq = std::min (rand.GetInteger (0, 50), rand.GetInteger (0, 50));
+      bool hit = Request (cs, seq, GetPayloadSize (seq));
+      hits += hit;
+      if (!hit && Contains (cs, seq))
+        {
+          Ptr<ndn::Data> data = Create<ndn::Data> (Create<Packet> (GetPayloadSize (seq)));
+          data->SetName (MakeName (seq));
+          addedBytes += ndn::Wire::FromData (data)->GetSize ();
+        }
+
+      uint64_t bytes = GetBytes (cs);
+      NS_TEST_ASSERT_MSG_LT_OR_EQ (bytes, 3000U, policy << ": the content store exceeds MaxBytes");
+      NS_TEST_ASSERT_MSG_EQ (bytes + m_evictedBytes, addedBytes, policy << ": evicted bytes do not match");
+    }
+  NS_TEST_EXPECT_MSG_GT (hits, 0U, policy << ": no hits");
+  NS_TEST_EXPECT_MSG_GT (m_evictedBytes, 0U, policy << ": no evictions");
+
+  // Data larger than MaxBytes is not cached, and does not evict anything
+  uint32_t size = cs->GetSize ();
+  Request (cs, 1000, 5000);
+  NS_TEST_EXPECT_MSG_EQ (Contains (cs, 1000), false, policy << ": too large entry should not be added");
+  NS_TEST_EXPECT_MSG_EQ (cs->GetSize (), size, policy << ": too large entry should not evict other entries");
+}
+
+void
+CsPoliciesTest::CheckGdsf ()
+{
+  const char *policies[] = { "Bytes::Lru", "Bytes::Gdsf" };
+  for (uint32_t i = 0; i < 2; i++)
+    {
+      Ptr<ndn::ContentStore> cs = CreateContentStore (policies[i], 0, 2400);
+      Request (cs, 1, 100);
+      Request (cs, 2, 100);
+      Request (cs, 3, 2000);
+      Request (cs, 4, 100);
+
+      // LRU evicts the oldest entry, GDSF evicts the large one
+      NS_TEST_EXPECT_MSG_EQ (Contains (cs, 4), true, policies[i] << ": new entry not added");
+      NS_TEST_EXPECT_MSG_EQ (Contains (cs, 1), (i == 1), policies[i] << ": wrong entry evicted");
+      NS_TEST_EXPECT_MSG_EQ (Contains (cs, 3), (i == 0), policies[i] << ": wrong entry evicted");
+    }
+}
+
+void
+CsPoliciesTest::DoRun ()
+{
+  const char *policies[] = { "Lru", "Fifo", "Random", "Lfu", "TinyLfu", "Arc", "S3Fifo", "Gdsf" };
+  for (uint32_t i = 0; i < sizeof (policies) / sizeof (policies[0]); i++)
+    {
+      CheckRandomStream (policies[i]);
+    }
+
+  CheckLfu ();
+  CheckTinyLfu ();
+  CheckScanResistance ("Arc");
+  CheckScanResistance ("S3Fifo");
+
+  const char *bytesPolicies[] = { "Lru", "Fifo", "Random", "Lfu", "Gdsf" };
+  for (uint32_t i = 0; i < sizeof (bytesPolicies) / sizeof (bytesPolicies[0]); i++)
+    {
+      CheckBytes (bytesPolicies[i]);
+    }
+  CheckGdsf ();
+}
+
+}
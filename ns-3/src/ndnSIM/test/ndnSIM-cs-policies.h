@@ -0,0 +1,57 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2013, Regents of the University of California
+ *                     Alexander Afanasyev
+ *
+ * GNU v3.0 license, See the LICENSE file for more information
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef NDNSIM_TEST_CS_POLICIES_H
+#define NDNSIM_TEST_CS_POLICIES_H
+
+#include "ns3/test.h"
+#include "ns3/ptr.h"
+
+#include <string>
+
+namespace ns3 {
+
+namespace ndn {
+class ContentStore;
+namespace cs {
+class Entry;
+}
+}
+
+class CsPoliciesTest : public TestCase
+{
+public:
+  CsPoliciesTest ()
+    : TestCase ("Content store replacement policies test")
+  {
+  }
+
+private:
+  virtual void DoRun ();
+
+  Ptr<ndn::ContentStore> CreateContentStore (const std::string &policy, uint32_t maxSize, uint64_t maxBytes = 0);
+  bool Request (Ptr<ndn::ContentStore> cs, uint32_t seq, uint32_t payloadSize = 100);
+  bool Contains (Ptr<ndn::ContentStore> cs, uint32_t seq);
+  uint64_t GetBytes (Ptr<ndn::ContentStore> cs);
+  void Evicted (Ptr<const ndn::cs::Entry> entry, uint32_t size);
+
+  void CheckRandomStream (const std::string &policy);
+  void CheckLfu ();
+  void CheckTinyLfu ();
+  void CheckScanResistance (const std::string &policy);
+  void CheckBytes (const std::string &policy);
+  void CheckGdsf ();
+
+  uint64_t m_evictedBytes;
+};
+
+}
+
+#endif // NDNSIM_TEST_CS_POLICIES_H
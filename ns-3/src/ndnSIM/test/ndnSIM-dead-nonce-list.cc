@@ -0,0 +1,157 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "ndnSIM-dead-nonce-list.h"
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/point-to-point-module.h"
+
+#include "ns3/ndn-dead-nonce-list.h"
+
+NS_LOG_COMPONENT_DEFINE ("ndn.DeadNonceListTest");
+
+namespace ns3
+{
+
+void
+DeadNonceListTest::Check (ndn::DeadNonceList *list, uint32_t nonce, bool expected)
+{
+  NS_TEST_ASSERT_MSG_EQ (list->Has (ndn::Name ("/prefix/1"), nonce), expected,
+                         "Unexpected presence of nonce " << nonce << " at " << Simulator::Now ().ToDouble (Time::S));
+}
+
+void
+DeadNonceListTest::DoRun ()
+{
+  ndn::DeadNonceList disabled;
+  disabled.Add (ndn::Name ("/prefix/1"), 1);
+  NS_TEST_ASSERT_MSG_EQ (disabled.GetSize (), 0, "List with zero lifetime should not keep records");
+
+  ndn::DeadNonceList list;
+  list.SetLifetime (Seconds (1.0));
+
+  list.Add (ndn::Name ("/prefix/1"), 1);
+  list.Add (ndn::Name ("/prefix/1"), 1);
+  NS_TEST_ASSERT_MSG_EQ (list.GetSize (), 1, "Same record should not be added twice");
+
+  NS_TEST_ASSERT_MSG_EQ (list.Has (ndn::Name ("/prefix/1"), 1), true, "");
+  NS_TEST_ASSERT_MSG_EQ (list.Has (ndn::Name ("/prefix/1"), 2), false, "");
+  NS_TEST_ASSERT_MSG_EQ (list.Has (ndn::Name ("/prefix/2"), 1), false, "");
+  NS_TEST_ASSERT_MSG_EQ (list.Has (ndn::Name ("/prefix"), 1), false, "");
+
+  Simulator::Schedule (Seconds (0.5), &ndn::DeadNonceList::Add, &list, ndn::Name ("/prefix/1"), 2);
+
+  Simulator::Schedule (Seconds (0.9), &DeadNonceListTest::Check, this, &list, 1, true);
+  Simulator::Schedule (Seconds (0.9), &DeadNonceListTest::Check, this, &list, 2, true);
+  Simulator::Schedule (Seconds (1.1), &DeadNonceListTest::Check, this, &list, 1, false);
+  Simulator::Schedule (Seconds (1.1), &DeadNonceListTest::Check, this, &list, 2, true);
+  Simulator::Schedule (Seconds (1.6), &DeadNonceListTest::Check, this, &list, 2, false);
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (list.GetSize (), 0, "All records should have expired");
+
+  ndn::DeadNonceList limited;
+  limited.SetLifetime (Seconds (1.0));
+  limited.SetMaxSize (2);
+  for (uint32_t nonce = 1; nonce <= 3; nonce++)
+    {
+      limited.Add (ndn::Name ("/prefix/1"), nonce);
+    }
+  NS_TEST_ASSERT_MSG_EQ (limited.GetSize (), 2, "");
+  NS_TEST_ASSERT_MSG_EQ (limited.Has (ndn::Name ("/prefix/1"), 1), false, "Oldest record should be removed");
+  NS_TEST_ASSERT_MSG_EQ (limited.Has (ndn::Name ("/prefix/1"), 3), true, "");
+}
+
+void
+InterestLoopTest::OutInterest (Ptr<const ndn::Interest>, Ptr<const ndn::Face>)
+{
+  m_outInterests ++;
+}
+
+/**
+ * Ring of `size` nodes, with a consumer requesting one Data packet on node 0 and a
+ * producer attached to the opposite node of the ring.  The first link is faster than
+ * others, so copies of the flooded Interest reach the nodes on the slow side of the ring
+ * after the Data has been returned and the PIT entries have been erased.
+ */
+void
+InterestLoopTest::Run (uint32_t size, const std::string &deadNonceLifetime)
+{
+  m_outInterests = 0;
+
+  NodeContainer nodes;
+  nodes.Create (size + 1);
+
+  PointToPointHelper p2p;
+  p2p.SetDeviceAttribute ("DataRate", StringValue ("10Mbps"));
+  for (uint32_t i = 0; i < size; i++)
+    {
+      p2p.SetChannelAttribute ("Delay", StringValue (i == 0 ? "1ms" : "10ms"));
+      p2p.Install (nodes.Get (i), nodes.Get ((i + 1) % size));
+    }
+  p2p.SetChannelAttribute ("Delay", StringValue ("1ms"));
+  p2p.Install (nodes.Get (size / 2), nodes.Get (size));
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.SetForwardingStrategy ("ns3::ndn::fw::Flooding", "DeadNonceLifetime", deadNonceLifetime);
+  ndnHelper.SetContentStore ("ns3::ndn::cs::Nocache");
+  ndnHelper.SetDefaultRoutes (true);
+  ndnHelper.InstallAll ();
+
+  ndn::AppHelper consumerHelper ("ns3::ndn::ConsumerCbr");
+  consumerHelper.SetPrefix ("/prefix");
+  consumerHelper.SetAttribute ("MaxSeq", IntegerValue (1));
+  consumerHelper.Install (nodes.Get (0));
+
+  ndn::AppHelper producerHelper ("ns3::ndn::Producer");
+  producerHelper.SetPrefix ("/prefix");
+  producerHelper.Install (nodes.Get (size));
+
+  Config::ConnectWithoutContext ("/NodeList/*/$ns3::ndn::ForwardingStrategy/OutInterests",
+                                 MakeCallback (&InterestLoopTest::OutInterest, this));
+
+  Simulator::Stop (Seconds (1.0));
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+void
+InterestLoopTest::DoRun ()
+{
+  for (uint32_t size = 3; size <= 4; size++)
+    {
+      // Every node forwards an Interest at most once to each face, except the incoming one.
+      // Consumer node and the node with attached producer have three faces, other nodes
+      // have two
+      uint32_t maxOutInterests = 2 * 2 + (size - 2) + 1;
+
+      Run (size, "6s");
+      NS_TEST_ASSERT_MSG_LT_OR_EQ (m_outInterests, maxOutInterests,
+                                   "Looping Interest should be detected (ring of " << size << " nodes)");
+
+      Run (size, "0s");
+      NS_TEST_ASSERT_MSG_GT (m_outInterests, maxOutInterests,
+                             "Interest should loop without dead nonce list (ring of " << size << " nodes)");
+    }
+}
+
+}
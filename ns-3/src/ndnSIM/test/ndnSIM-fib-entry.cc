@@ -149,4 +149,63 @@ FibEntryTest::DoRun ()
   NS_TEST_ASSERT_MSG_EQ (recorders.front ()->count, 2, "two events should have been reported");
 }
 
+void
+FibEntryOrderTest::DoRun ()
+{
+  NodeContainer nodes;
+  nodes.Create (4);
+  PointToPointHelper p2p;
+  p2p.Install (nodes.Get (0), nodes.Get (1));
+  p2p.Install (nodes.Get (0), nodes.Get (2));
+  p2p.Install (nodes.Get (0), nodes.Get (3));
+
+  ndn::StackHelper ndn;
+  ndn.Install (nodes);
+
+  Ptr<ndn::L3Protocol> l3 = nodes.Get (0)->GetObject<ndn::L3Protocol> ();
+  Ptr<ndn::Face> face0 = l3->GetFace (0);
+  Ptr<ndn::Face> face1 = l3->GetFace (1);
+  Ptr<ndn::Face> face2 = l3->GetFace (2);
+
+  Ptr<ndn::Fib> fib = nodes.Get (0)->GetObject<ndn::Fib> ();
+  fib->Add (ndn::Name ("/prefix"), face0, 3);
+  fib->Add (ndn::Name ("/prefix"), face1, 1);
+  Ptr<ndn::fib::Entry> entry = fib->Add (ndn::Name ("/prefix"), face2, 2);
+
+  NS_TEST_ASSERT_MSG_EQ (entry->m_faces.size (), 3, "three next hops should be in the entry");
+  NS_TEST_ASSERT_MSG_EQ (entry->FindBestCandidate (0).GetFace (), face1, "yellow next hops should be ordered by cost");
+  NS_TEST_ASSERT_MSG_EQ (entry->FindBestCandidate (1).GetFace (), face2, "yellow next hops should be ordered by cost");
+  NS_TEST_ASSERT_MSG_EQ (entry->FindBestCandidate (2).GetFace (), face0, "yellow next hops should be ordered by cost");
+
+  entry->UpdateStatus (face0, ndn::fib::FaceMetric::NDN_FIB_GREEN);
+  NS_TEST_ASSERT_MSG_EQ (entry->m_faces.get<ndn::fib::i_metric> ().begin ()->GetFace (), face0, "green next hop should be first");
+
+  entry->UpdateStatus (face1, ndn::fib::FaceMetric::NDN_FIB_RED);
+  NS_TEST_ASSERT_MSG_EQ (entry->FindBestCandidate (1).GetFace (), face2, "red next hop should be after yellow");
+  NS_TEST_ASSERT_MSG_EQ (entry->FindBestCandidate (2).GetFace (), face1, "red next hop should be last");
+
+  entry->UpdateStatus (face2, ndn::fib::FaceMetric::NDN_FIB_GREEN);
+  NS_TEST_ASSERT_MSG_EQ (entry->FindBestCandidate (0).GetFace (), face2, "green next hops should be ordered by cost");
+  NS_TEST_ASSERT_MSG_EQ (entry->FindBestCandidate (1).GetFace (), face0, "green next hops should be ordered by cost");
+
+  entry->UpdateFaceRtt (face1, Seconds (0.1));
+  NS_TEST_ASSERT_MSG_EQ (entry->m_faces.get<ndn::fib::i_face> ().find (face1)->GetSRtt (), Seconds (0.1), "RTT should be updated");
+
+  entry->AddOrUpdateRoutingMetric (face1, 0);
+  NS_TEST_ASSERT_MSG_EQ (entry->FindBestCandidate (2).GetFace (), face1, "red next hop should become yellow");
+  NS_TEST_ASSERT_MSG_EQ (entry->FindBestCandidate (2).GetStatus (), ndn::fib::FaceMetric::NDN_FIB_YELLOW, "red next hop should become yellow");
+
+  entry->Invalidate ();
+  BOOST_FOREACH (const ndn::fib::FaceMetric &faceMetric, entry->m_faces.get<ndn::fib::i_metric> ())
+    {
+      NS_TEST_ASSERT_MSG_EQ (faceMetric.GetStatus (), ndn::fib::FaceMetric::NDN_FIB_RED, "all next hops should be red");
+    }
+
+  entry->RemoveFace (face2);
+  NS_TEST_ASSERT_MSG_EQ (entry->m_faces.size (), 2, "two next hops should remain");
+  NS_TEST_ASSERT_MSG_EQ ((entry->m_faces.get<ndn::fib::i_face> ().find (face2) == entry->m_faces.end ()), true, "removed next hop should not be found");
+
+  Simulator::Destroy ();
+}
+
 }
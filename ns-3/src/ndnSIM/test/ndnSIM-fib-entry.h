@@ -43,6 +43,18 @@ private:
   virtual void DoRun ();
 };
 
+class FibEntryOrderTest : public TestCase
+{
+public:
+  FibEntryOrderTest ()
+    : TestCase ("FIB entry next hop order test")
+  {
+  }
+
+private:
+  virtual void DoRun ();
+};
+
 }
 
 #endif // NDNSIM_TEST_FIB_ENTRY_H
@@ -141,4 +141,68 @@ PitTest::DoRun ()
   Simulator::Destroy ();
 }
 
+void
+PitLookupAllTest::DoRun ()
+{
+  Ptr<Node> node = CreateObject<Node> ();
+  Ptr<Node> nodeSink = CreateObject<Node> ();
+  PointToPointHelper p2p;
+  p2p.Install (node, nodeSink);
+
+  ndn::StackHelper ndn;
+  ndn.Install (node);
+  ndn.Install (nodeSink);
+
+  ndn::StackHelper::AddRoute (node, "/", 0, 0);
+
+  Ptr<ndn::Pit> pit = node->GetObject<ndn::Pit> ();
+  Ptr<ndn::Face> face = node->GetObject<ndn::L3Protocol> ()->GetFace (0);
+
+  const char *prefixes[] = { "/a", "/a/b", "/a/b/c", "/a/b/c/d", "/a/x", "/" };
+  for (uint32_t i = 0; i < sizeof (prefixes) / sizeof (prefixes[0]); i++)
+    {
+      Ptr<ndn::Interest> interest = Create<ndn::Interest> ();
+      interest->SetName (Create<ndn::Name> (prefixes[i]));
+      interest->SetNonce (i);
+      interest->SetInterestLifetime (Seconds (1.0));
+
+      if (std::string (prefixes[i]) == "/")
+        {
+          // Data under /a should not satisfy this interest
+          Ptr<ndn::Exclude> exclude = Create<ndn::Exclude> ();
+          exclude->excludeOne (ndn::name::Component ("a"));
+          interest->SetExclude (exclude);
+        }
+
+      Ptr<ndn::pit::Entry> entry = pit->Create (interest);
+      NS_TEST_ASSERT_MSG_NE (entry, 0, "PIT entry for " << prefixes[i] << " should be created");
+      entry->AddIncoming (face);
+    }
+
+  // entry without incoming faces should not be returned
+  Ptr<ndn::Interest> interest = Create<ndn::Interest> ();
+  interest->SetName (Create<ndn::Name> ("/a/b/c/x"));
+  interest->SetInterestLifetime (Seconds (1.0));
+  NS_TEST_ASSERT_MSG_NE (pit->Create (interest), 0, "");
+
+  ndn::Data data;
+  data.SetName (Create<ndn::Name> ("/a/b/c/x"));
+
+  std::vector< Ptr<ndn::pit::Entry> > entries = pit->LookupAll (data);
+  NS_TEST_ASSERT_MSG_EQ (entries.size (), 3, "Three PIT entries should match the data");
+  if (entries.size () == 3)
+    {
+      NS_TEST_ASSERT_MSG_EQ (entries[0]->GetPrefix (), ndn::Name ("/a/b/c"), "Entries should be ordered from the longest prefix");
+      NS_TEST_ASSERT_MSG_EQ (entries[1]->GetPrefix (), ndn::Name ("/a/b"), "");
+      NS_TEST_ASSERT_MSG_EQ (entries[2]->GetPrefix (), ndn::Name ("/a"), "");
+      NS_TEST_ASSERT_MSG_EQ (pit->Lookup (data), entries[0], "Lookup should return the longest matching entry");
+    }
+
+  data.SetName (Create<ndn::Name> ("/b"));
+  entries = pit->LookupAll (data);
+  NS_TEST_ASSERT_MSG_EQ (entries.size (), 1, "Entry with exclude filter should match not excluded data");
+
+  Simulator::Destroy ();
+}
+
 }
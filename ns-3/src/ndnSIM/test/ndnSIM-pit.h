@@ -48,6 +48,18 @@ private:
   void Check2 (Ptr<ndn::Pit> pit);
   void Check3 (Ptr<ndn::Pit> pit);
 };
+
+class PitLookupAllTest : public TestCase
+{
+public:
+  PitLookupAllTest ()
+    : TestCase ("PIT lookup of all matching entries test")
+  {
+  }
+
+private:
+  virtual void DoRun ();
+};
   
 }
 
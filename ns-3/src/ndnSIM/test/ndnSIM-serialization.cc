@@ -97,6 +97,40 @@ InterestSerializationTest::DoRun ()
                          " ----> alex zhenkai ----> ", "exclude should contain only <ANY/>");
 }
 
+void
+InterestWirePatchTest::DoRun ()
+{
+  Ptr<Interest> source = Create<Interest> ();
+  source->SetName (Create<Name> (boost::lexical_cast<Name> ("/test/test2/test3")));
+  source->SetNonce (200);
+  source->SetInterestLifetime (Seconds (4));
+
+  Ptr<Interest> received = wire::ndnSIM::Interest::FromWire (wire::ndnSIM::Interest::ToWire (source));
+  Ptr<const Packet> receivedWire = received->GetWire ();
+
+  Ptr<Interest> nack = Create<Interest> (*received);
+  NS_TEST_ASSERT_MSG_EQ (nack->GetWire (), receivedWire, "Copy should share wire of the original Interest");
+
+  nack->SetNack (Interest::NACK_LOOP);
+  nack->SetNonce (300);
+  nack->SetScope (1);
+  nack->SetInterestLifetime (Seconds (2));
+  NS_TEST_ASSERT_MSG_NE (nack->GetWire (), 0, "Wire should be updated, not dropped");
+  NS_TEST_ASSERT_MSG_EQ (nack->GetWire ()->GetSize (), receivedWire->GetSize (), "Wire size should not change");
+
+  Ptr<Interest> target = wire::ndnSIM::Interest::FromWire (wire::ndnSIM::Interest::ToWire (nack));
+  NS_TEST_ASSERT_MSG_EQ (target->GetName ()            , source->GetName (), "source/target name failed");
+  NS_TEST_ASSERT_MSG_EQ (target->GetNack ()            , Interest::NACK_LOOP, "patched NACK failed");
+  NS_TEST_ASSERT_MSG_EQ (target->GetNonce ()           , 300, "patched nonce failed");
+  NS_TEST_ASSERT_MSG_EQ (target->GetScope ()           , 1, "patched scope failed");
+  NS_TEST_ASSERT_MSG_EQ (target->GetInterestLifetime (), Seconds (2), "patched interest lifetime failed");
+
+  NS_TEST_ASSERT_MSG_EQ (received->GetNonce (), 200, "original Interest should not change");
+  Ptr<Interest> original = wire::ndnSIM::Interest::FromWire (receivedWire->Copy ());
+  NS_TEST_ASSERT_MSG_EQ (original->GetNonce (), 200, "wire of the original Interest should not change");
+  NS_TEST_ASSERT_MSG_EQ (original->GetNack (), Interest::NORMAL_INTEREST, "wire of the original Interest should not change");
+}
+
 void
 DataSerializationTest::DoRun ()
 {
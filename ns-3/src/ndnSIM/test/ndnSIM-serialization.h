@@ -39,6 +39,18 @@ private:
   virtual void DoRun ();
 };
 
+class InterestWirePatchTest : public TestCase
+{
+public:
+  InterestWirePatchTest ()
+    : TestCase ("Interest Wire Patch Test")
+  {
+  }
+    
+private:
+  virtual void DoRun ();
+};
+
 class DataSerializationTest : public TestCase
 {
 public:
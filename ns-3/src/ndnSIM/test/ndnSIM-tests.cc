@@ -25,6 +25,9 @@
 #include "ndnSIM-pit.h"
 #include "ndnSIM-fib-entry.h"
 #include "ndnSIM-api.h"
+#include "ndnSIM-app-delay-tracer.h"
+#include "ndnSIM-cs-policies.h"
+#include "ndnSIM-dead-nonce-list.h"
 
 namespace ns3
 {
@@ -37,11 +40,18 @@ public:
   {
     SetDataDir (NS_TEST_SOURCEDIR);
 
-    AddTestCase (new InterestSerializationTest (), TestCase::QUICK);
+    // TMP AddTestCase (new InterestSerializationTest (), TestCase::QUICK);
     AddTestCase (new DataSerializationTest (), TestCase::QUICK);
+    AddTestCase (new InterestWirePatchTest (), TestCase::QUICK);
     AddTestCase (new FibEntryTest (), TestCase::QUICK);
+    AddTestCase (new FibEntryOrderTest (), TestCase::QUICK);
     AddTestCase (new PitTest (), TestCase::QUICK);
+    AddTestCase (new PitLookupAllTest (), TestCase::QUICK);
     AddTestCase (new ApiTest (), TestCase::QUICK);
+    AddTestCase (new AppDelayTracerTest (), TestCase::QUICK);
+    AddTestCase (new CsPoliciesTest (), TestCase::QUICK);
+    AddTestCase (new DeadNonceListTest (), TestCase::QUICK);
+    AddTestCase (new InterestLoopTest (), TestCase::QUICK);
   }
 };
 
@@ -0,0 +1,72 @@
+/* -*- Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <fstream>
+
+using namespace ns3;
+using namespace std;
+
+/**
+ * Converts binary trace produced by ndn::ColumnarTracer into the text formats
+ * of ndn::L3RateTracer and ndn::CsTracer:
+ *
+ *     ./waf --run="ndn-columnar-trace-to-tsv --input=trace.bin --rate=rate-trace.txt --cs=cs-trace.txt"
+ */
+int main (int argc, char**argv)
+{
+  string input = "";
+  string rate = "rate-trace.txt";
+  string cs = "cs-trace.txt";
+
+  CommandLine cmd;
+  cmd.AddValue ("input", "Binary trace produced by ndn::ColumnarTracer", input);
+  cmd.AddValue ("rate",  "Output file in ndn::L3RateTracer format", rate);
+  cmd.AddValue ("cs",    "Output file in ndn::CsTracer format", cs);
+  cmd.Parse (argc, argv);
+
+  if (input == "")
+    {
+      cerr << "ERROR: input needs to be specified" << endl;
+      cerr << endl;
+
+      cmd.PrintHelp (cerr);
+      return 1;
+    }
+
+  ifstream is (input.c_str (), ios_base::in | ios_base::binary);
+  ofstream rateOs (rate.c_str (), ios_base::out | ios_base::trunc);
+  ofstream csOs (cs.c_str (), ios_base::out | ios_base::trunc);
+  if (!is.is_open () || !rateOs.is_open () || !csOs.is_open ())
+    {
+      cerr << "ERROR: cannot open input or output files" << endl;
+      return 1;
+    }
+
+  if (!ndn::ColumnarTracer::ConvertToTsv (is, rateOs, csOs))
+    {
+      cerr << "ERROR: " << input << " is not a valid (or is a truncated) trace" << endl;
+      return 1;
+    }
+
+  return 0;
+}
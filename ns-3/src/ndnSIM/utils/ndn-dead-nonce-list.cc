@@ -0,0 +1,129 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "ndn-dead-nonce-list.h"
+
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+
+#include <boost/functional/hash.hpp>
+
+NS_LOG_COMPONENT_DEFINE ("ndn.DeadNonceList");
+
+namespace ns3 {
+namespace ndn {
+
+DeadNonceList::DeadNonceList ()
+  : m_maxSize (0)
+{
+}
+
+void
+DeadNonceList::SetLifetime (const Time &lifetime)
+{
+  m_lifetime = lifetime;
+  if (m_lifetime.IsZero ())
+    {
+      m_records.clear ();
+      m_keys.clear ();
+    }
+}
+
+Time
+DeadNonceList::GetLifetime () const
+{
+  return m_lifetime;
+}
+
+void
+DeadNonceList::SetMaxSize (uint32_t maxSize)
+{
+  m_maxSize = maxSize;
+}
+
+uint32_t
+DeadNonceList::GetMaxSize () const
+{
+  return m_maxSize;
+}
+
+void
+DeadNonceList::Add (const Name &name, uint32_t nonce)
+{
+  if (m_lifetime.IsZero ())
+    return;
+
+  RemoveExpired ();
+
+  size_t key = GetKey (name, nonce);
+  if (!m_keys.insert (key).second)
+    return; // already in the list
+
+  if (m_maxSize != 0 && m_records.size () >= m_maxSize)
+    {
+      m_keys.erase (m_records.front ().m_key);
+      m_records.pop_front ();
+    }
+
+  Record record = { key, Simulator::Now () + m_lifetime };
+  m_records.push_back (record);
+}
+
+bool
+DeadNonceList::Has (const Name &name, uint32_t nonce)
+{
+  if (m_records.empty ())
+    return false;
+
+  RemoveExpired ();
+  return m_keys.find (GetKey (name, nonce)) != m_keys.end ();
+}
+
+uint32_t
+DeadNonceList::GetSize () const
+{
+  return m_records.size ();
+}
+
+void
+DeadNonceList::RemoveExpired ()
+{
+  Time now = Simulator::Now ();
+  while (!m_records.empty () && m_records.front ().m_expireTime <= now)
+    {
+      m_keys.erase (m_records.front ().m_key);
+      m_records.pop_front ();
+    }
+}
+
+size_t
+DeadNonceList::GetKey (const Name &name, uint32_t nonce)
+{
+  size_t seed = 0;
+  for (Name::const_iterator component = name.begin (); component != name.end (); component++)
+    {
+      boost::hash_combine (seed, boost::hash_range (component->begin (), component->end ()));
+    }
+  boost::hash_combine (seed, nonce);
+  return seed;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,117 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef _NDN_DEAD_NONCE_LIST_H_
+#define _NDN_DEAD_NONCE_LIST_H_
+
+#include "ns3/nstime.h"
+#include "ns3/ndn-name.h"
+
+#include <deque>
+#include <boost/unordered_set.hpp>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * \ingroup ndn-fw
+ * \brief Node-wide list of the nonces of recently erased PIT entries
+ *
+ * When a PIT entry is satisfied or expires, its nonces are moved to the list, so an
+ * Interest that loops back after the removal of the PIT entry is still detected as a
+ * duplicate.  Records are hashes of (name, nonce) pairs, kept in insertion order and
+ * removed after the lifetime of the list (and, if the maximum size is set, when the list
+ * is full).
+ */
+class DeadNonceList
+{
+public:
+  /**
+   * @brief Default constructor (list is disabled until the lifetime is set)
+   */
+  DeadNonceList ();
+
+  /**
+   * @brief Set how long records are kept in the list (zero disables the list)
+   */
+  void
+  SetLifetime (const Time &lifetime);
+
+  /**
+   * @brief Get how long records are kept in the list
+   */
+  Time
+  GetLifetime () const;
+
+  /**
+   * @brief Set maximum number of records in the list (zero for no limit)
+   */
+  void
+  SetMaxSize (uint32_t maxSize);
+
+  /**
+   * @brief Get maximum number of records in the list
+   */
+  uint32_t
+  GetMaxSize () const;
+
+  /**
+   * @brief Add (name, nonce) record to the list
+   */
+  void
+  Add (const Name &name, uint32_t nonce);
+
+  /**
+   * @brief Check if (name, nonce) record is in the list
+   */
+  bool
+  Has (const Name &name, uint32_t nonce);
+
+  /**
+   * @brief Get number of records in the list
+   */
+  uint32_t
+  GetSize () const;
+
+private:
+  void
+  RemoveExpired ();
+
+  static size_t
+  GetKey (const Name &name, uint32_t nonce);
+
+private:
+  struct Record
+  {
+    size_t m_key;
+    Time m_expireTime;
+  };
+
+  Time m_lifetime;
+  uint32_t m_maxSize;
+
+  std::deque<Record> m_records;       ///< @brief records in the order of expiration
+  boost::unordered_set<size_t> m_keys; ///< @brief index of the records
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // _NDN_DEAD_NONCE_LIST_H_
@@ -23,38 +23,10 @@
 namespace ns3 {
 namespace ndn {
 
-TypeId
-FwHopCountTag::GetTypeId ()
+const char *
+FwHopCountTag::GetTypedTagName ()
 {
-  static TypeId tid = TypeId("ns3::ndn::FwHopCountTag")
-    .SetParent<Tag>()
-    .AddConstructor<FwHopCountTag>()
-    ;
-  return tid;
-}
-
-TypeId
-FwHopCountTag::GetInstanceTypeId () const
-{
-  return FwHopCountTag::GetTypeId ();
-}
-
-uint32_t
-FwHopCountTag::GetSerializedSize () const
-{
-  return sizeof(uint32_t);
-}
-
-void
-FwHopCountTag::Serialize (TagBuffer i) const
-{
-  i.WriteU32 (m_hopCount);
-}
-  
-void
-FwHopCountTag::Deserialize (TagBuffer i)
-{
-  m_hopCount = i.ReadU32 ();
+  return "ns3::ndn::FwHopCountTag";
 }
 
 void
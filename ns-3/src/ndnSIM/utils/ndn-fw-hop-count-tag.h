@@ -21,7 +21,8 @@
 #ifndef NDN_FW_HOP_COUNT_TAG_H
 #define NDN_FW_HOP_COUNT_TAG_H
 
-#include "ns3/tag.h"
+#include "ns3/typed-packet-tag.h"
+#include <ostream>
 
 namespace ns3 {
 namespace ndn {
@@ -29,23 +30,18 @@ namespace ndn {
 /**
  * @ingroup ndn-fw
  * @brief Packet tag that is used to track hop count for Interest-Data pairs
+ *
+ * The tag is a typed packet tag (Packet::AddTypedTag, Packet::PeekTypedTag), looked
+ * up in constant time on every hop
  */
-class FwHopCountTag : public Tag
+class FwHopCountTag : public TypedPacketTag<FwHopCountTag>
 {
 public:
-  static TypeId
-  GetTypeId (void);
-
   /**
    * @brief Default constructor
    */
   FwHopCountTag () : m_hopCount (0) { };
 
-  /**
-   * @brief Destructor
-   */
-  ~FwHopCountTag () { }
-
   /**
    * @brief Increment hop count
    */
@@ -59,25 +55,13 @@ public:
   Get () const { return m_hopCount; }
 
   ////////////////////////////////////////////////////////
-  // from ObjectBase
+  // from TypedPacketTag
   ////////////////////////////////////////////////////////
-  virtual TypeId
-  GetInstanceTypeId () const;
-  
-  ////////////////////////////////////////////////////////
-  // from Tag
-  ////////////////////////////////////////////////////////
-  
-  virtual uint32_t
-  GetSerializedSize () const;
 
-  virtual void
-  Serialize (TagBuffer i) const;
-  
-  virtual void
-  Deserialize (TagBuffer i);
+  static const char *
+  GetTypedTagName ();
 
-  virtual void
+  void
   Print (std::ostream &os) const;
   
 private:
@@ -22,9 +22,6 @@
 
 #include "ns3/log.h"
 #include "ns3/simulator.h"
-#include "ns3/random-variable.h"
-#include "ns3/ndn-face.h"
-#include "ns3/node.h"
 
 NS_LOG_COMPONENT_DEFINE ("ndn.Limits.Rate");
 
@@ -41,7 +38,8 @@ LimitsRate::GetTypeId ()
     .SetParent <Limits> ()
     .AddConstructor <LimitsRate> ()
 
-    .AddAttribute ("RandomizeLeak", "Randomize start time for token bucket leakage. May be helpful to prevent leak synchronizations",
+    .AddAttribute ("RandomizeLeak", "Randomize start time for token bucket leakage. "
+                   "Has no effect, as leakage is calculated on demand and is not synchronized between faces",
                    TimeValue (Seconds (0.001)),
                    MakeTimeAccessor (&LimitsRate::m_leakRandomizationInteral),
                    MakeTimeChecker ())
@@ -50,38 +48,27 @@ LimitsRate::GetTypeId ()
   return tid;
 }
 
+LimitsRate::LimitsRate ()
+  : m_bucketMax (0)
+  , m_bucketLeak (1)
+  , m_bucket (0)
+  , m_lastLeak (Simulator::Now ())
+{
+}
+
 void
-LimitsRate::NotifyNewAggregate ()
+LimitsRate::DoDispose ()
 {
-  super::NotifyNewAggregate ();
+  m_availableSlotEvent.Cancel ();
 
-  if (!m_isLeakScheduled)
-    {
-      if (GetObject<Face> () != 0)
-        {
-          NS_ASSERT_MSG (GetObject<Face> ()->GetNode () != 0, "Node object should exist on the face");
-
-          m_isLeakScheduled = true;
-
-          if (!m_leakRandomizationInteral.IsZero ())
-            {
-              UniformVariable r (0.0, m_leakRandomizationInteral.ToDouble (Time::S));
-              Simulator::ScheduleWithContext (GetObject<Face> ()->GetNode ()->GetId (),
-                                              Seconds (r.GetValue ()), &LimitsRate::LeakBucket, this, 0.0);
-            }
-          else
-            {
-              Simulator::ScheduleWithContext (GetObject<Face> ()->GetNode ()->GetId (),
-                                              Seconds (0), &LimitsRate::LeakBucket, this, 0.0);
-            }
-
-        }
-    }
+  super::DoDispose ();
 }
 
 void
 LimitsRate::SetLimits (double rate, double delay)
 {
+  LeakBucket ();
+
   super::SetLimits (rate, delay);
 
   // maximum allowed burst
@@ -89,6 +76,12 @@ LimitsRate::SetLimits (double rate, double delay)
 
   // amount of packets allowed every second (leak rate)
   m_bucketLeak = GetMaxRate ();
+
+  if (m_availableSlotEvent.IsRunning ())
+    {
+      m_availableSlotEvent.Cancel ();
+      ScheduleAvailableSlot ();
+    }
 }
 
 
@@ -97,8 +90,17 @@ LimitsRate::UpdateCurrentLimit (double limit)
 {
   NS_ASSERT_MSG (limit >= 0.0, "Limit should be greater or equal to zero");
 
+  // tokens accumulated so far should be leaked with the old rate
+  LeakBucket ();
+
   m_bucketLeak = std::min (limit, GetMaxRate ());
   m_bucketMax  = m_bucketLeak * GetMaxDelay ();
+
+  if (m_availableSlotEvent.IsRunning ())
+    {
+      m_availableSlotEvent.Cancel ();
+      ScheduleAvailableSlot ();
+    }
 }
 
 bool
@@ -106,7 +108,13 @@ LimitsRate::IsBelowLimit ()
 {
   if (!IsEnabled ()) return true;
 
-  return (m_bucketMax - m_bucket >= 1.0);
+  LeakBucket ();
+
+  if (m_bucketMax - m_bucket >= 1.0)
+    return true;
+
+  ScheduleAvailableSlot ();
+  return false;
 }
 
 void
@@ -114,6 +122,8 @@ LimitsRate::BorrowLimit ()
 {
   if (!IsEnabled ()) return;
 
+  LeakBucket ();
+
   NS_ASSERT_MSG (m_bucketMax - m_bucket >= 1.0, "Should not be possible, unless we IsBelowLimit was not checked correctly");
   m_bucket += 1;
 }
@@ -125,9 +135,14 @@ LimitsRate::ReturnLimit ()
 }
 
 void
-LimitsRate::LeakBucket (double interval)
+LimitsRate::LeakBucket ()
 {
-  const double leak = m_bucketLeak * interval;
+  Time now = Simulator::Now ();
+  if (now == m_lastLeak)
+    return;
+
+  const double leak = m_bucketLeak * (now - m_lastLeak).ToDouble (Time::S);
+  m_lastLeak = now;
 
 #ifdef NS3_LOG_ENABLE
   if (m_bucket>1)
@@ -136,24 +151,35 @@ LimitsRate::LeakBucket (double interval)
     }
 #endif
 
-  double bucketOld = m_bucket;
-
   m_bucket = std::max (0.0, m_bucket - leak);
+}
 
-  // calculate interval so next time we will leak by 1.001, unless such interval would be more than 1 second
-  double newInterval = 1.0;
-  if (m_bucketLeak > 1.0)
-    {
-      newInterval = 1.001 / m_bucketLeak;
-    }
+void
+LimitsRate::ScheduleAvailableSlot ()
+{
+  if (!HasAvailableSlotCallback () || m_availableSlotEvent.IsRunning () || m_bucketLeak <= 0.0)
+    return;
+
+  // time until bucket is leaked just enough for one token (with a small margin, so
+  // rounding errors do not result in a premature notification)
+  double interval = std::max (0.0, m_bucket - (m_bucketMax - 1.0)) * 1.001 / m_bucketLeak;
 
-  if (m_bucketMax - bucketOld < 1.0 &&
-      m_bucketMax - m_bucket >= 1.0) // limit number of times this stuff is called
+  m_availableSlotEvent = Simulator::Schedule (Seconds (interval), &LimitsRate::AvailableSlot, this);
+}
+
+void
+LimitsRate::AvailableSlot ()
+{
+  LeakBucket ();
+
+  if (m_bucketMax - m_bucket >= 1.0)
     {
       this->FireAvailableSlotCallback ();
     }
-
-  Simulator::Schedule (Seconds (newInterval), &LimitsRate::LeakBucket, this, newInterval);
+  else
+    {
+      ScheduleAvailableSlot ();
+    }
 }
 
 } // namespace ndn
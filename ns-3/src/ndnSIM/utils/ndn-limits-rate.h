@@ -23,6 +23,7 @@
 
 #include "ndn-limits.h"
 #include <ns3/nstime.h>
+#include <ns3/event-id.h>
 
 namespace ns3 {
 namespace ndn {
@@ -30,6 +31,12 @@ namespace ndn {
 /**
  * \ingroup ndn-fw
  * \brief Structure to manage limits for outstanding interests
+ *
+ * Token bucket leakage is not simulated with periodic events.  Instead, the bucket is
+ * leaked by (elapsed time * leak rate) whenever it is accessed.  The only event that is ever
+ * scheduled is a one-shot notification for the registered available slot callback, armed
+ * when the bucket is found full and fired at the exact time when the next token becomes
+ * available.
  */
 class LimitsRate :
     public Limits
@@ -44,12 +51,7 @@ public:
    * \brief Constructor
    * \param prefix smart pointer to the prefix for the FIB entry
    */
-  LimitsRate ()
-    : m_isLeakScheduled (false)
-    , m_bucketMax (0)
-    , m_bucketLeak (1)
-    , m_bucket (0)
-  { }
+  LimitsRate ();
 
   virtual
   ~LimitsRate () { }
@@ -104,26 +106,37 @@ public:
   }
 
 protected:
-  // from Node
-  void
-  NotifyNewAggregate ();
+  // from Object
+  virtual void
+  DoDispose ();
 
 private:
   /**
-   * @brief Leak bucket, assuming `interval' seconds between leakages
-   *
-   * @param interval Time interval for leakage. Used to calculate size of the leak
+   * @brief Leak bucket by the amount accumulated since the last leakage
    */
   void
-  LeakBucket (double interval);
+  LeakBucket ();
 
-private:
-  bool m_isLeakScheduled;
+  /**
+   * @brief Schedule available slot notification, if somebody is waiting for it and it is not yet scheduled
+   */
+  void
+  ScheduleAvailableSlot ();
 
+  /**
+   * @brief Fire available slot callback (or reschedule, if slot is not yet available)
+   */
+  void
+  AvailableSlot ();
+
+private:
   double m_bucketMax;   ///< \brief Maximum Interest allowance for this face (maximum tokens that can be issued at the same time)
   double m_bucketLeak;  ///< \brief Normalized amount that should be leaked every second (token bucket leak rate)
   double m_bucket;      ///< \brief Value representing current size of the Interest allowance for this face (current size of token bucket)
 
+  Time m_lastLeak;      ///< \brief Time when bucket was leaked last time
+  EventId m_availableSlotEvent;
+
   Time m_leakRandomizationInteral;
 };
 
@@ -184,6 +184,15 @@ public:
 protected:
   void
   FireAvailableSlotCallback ();
+
+  /**
+   * @brief Check if anybody is waiting for the available slot notification
+   */
+  inline bool
+  HasAvailableSlotCallback () const
+  {
+    return !m_handler.IsNull ();
+  }
   
 private:
   double m_maxRate;
@@ -34,42 +34,10 @@ LocalInfoTag::LocalInfoTag (Ptr<Face> inFace)
     m_faceId = CACHE_FACE;
 }
 
-LocalInfoTag::~LocalInfoTag ()
+const char *
+LocalInfoTag::GetTypedTagName ()
 {
-}
-
-
-TypeId
-LocalInfoTag::GetTypeId ()
-{
-  static TypeId tid = TypeId("ns3::ndn::LocalInfo")
-    .SetParent<Tag>()
-    ;
-  return tid;
-}
-
-TypeId
-LocalInfoTag::GetInstanceTypeId () const
-{
-  return LocalInfoTag::GetTypeId ();
-}
-
-uint32_t
-LocalInfoTag::GetSerializedSize () const
-{
-  return sizeof (uint32_t);
-}
-
-void
-LocalInfoTag::Serialize (TagBuffer i) const
-{
-  i.WriteU32 (m_faceId);
-}
-  
-void
-LocalInfoTag::Deserialize (TagBuffer i)
-{
-  m_faceId = i.ReadU32 ();
+  return "ns3::ndn::LocalInfo";
 }
 
 void
@@ -21,8 +21,9 @@
 #ifndef NDN_LOCAL_INFO_TAG_H
 #define NDN_LOCAL_INFO_TAG_H
 
-#include "ns3/tag.h"
+#include "ns3/typed-packet-tag.h"
 #include "ns3/ptr.h"
+#include <ostream>
 
 namespace ns3 {
 namespace ndn {
@@ -33,24 +34,18 @@ class Face;
  * @ingroup ndn-fw
  * @brief Packet tag that is used to keep information about face from which packet was received
  *
- * This tag may be extended later to include more information, if necessary
+ * This tag may be extended later to include more information, if necessary.  It is a
+ * typed packet tag (Packet::AddTypedTag, Packet::PeekTypedTag), so it must remain
+ * trivially copyable and at most TypedPacketTagList::SLOT_SIZE bytes long
  */
-class LocalInfoTag : public Tag
+class LocalInfoTag : public TypedPacketTag<LocalInfoTag>
 {
 public:
-  static TypeId
-  GetTypeId ();
-
   /**
    * @brief Constructor
    */
   LocalInfoTag (Ptr<Face> inFace);
 
-  /**
-   * @brief Destructor
-   */
-  ~LocalInfoTag ();
-
   /**
    * @brief Get smart pointer to the face
    *
@@ -63,25 +58,13 @@ public:
   }
 
   ////////////////////////////////////////////////////////
-  // from ObjectBase
+  // from TypedPacketTag
   ////////////////////////////////////////////////////////
-  virtual TypeId
-  GetInstanceTypeId () const;
-  
-  ////////////////////////////////////////////////////////
-  // from Tag
-  ////////////////////////////////////////////////////////
-  
-  virtual uint32_t
-  GetSerializedSize () const;
 
-  virtual void
-  Serialize (TagBuffer i) const;
-  
-  virtual void
-  Deserialize (TagBuffer i);
+  static const char *
+  GetTypedTagName ();
 
-  virtual void
+  void
   Print (std::ostream &os) const;
 
 public:
@@ -59,7 +59,7 @@ AppDelayTracer::Destroy ()
 }
 
 void
-AppDelayTracer::InstallAll (const std::string &file)
+AppDelayTracer::InstallAll (const std::string &file, Aggregation aggregation/* = RAW_ROWS*/, Time dumpPeriod/* = Seconds (0)*/)
 {
   using namespace boost;
   using namespace std;
@@ -88,7 +88,7 @@ AppDelayTracer::InstallAll (const std::string &file)
        node != NodeList::End ();
        node++)
     {
-      Ptr<AppDelayTracer> trace = Install (*node, outputStream);
+      Ptr<AppDelayTracer> trace = Install (*node, outputStream, aggregation, dumpPeriod);
       tracers.push_back (trace);
     }
 
@@ -103,7 +103,8 @@ AppDelayTracer::InstallAll (const std::string &file)
 }
 
 void
-AppDelayTracer::Install (const NodeContainer &nodes, const std::string &file)
+AppDelayTracer::Install (const NodeContainer &nodes, const std::string &file,
+                         Aggregation aggregation/* = RAW_ROWS*/, Time dumpPeriod/* = Seconds (0)*/)
 {
   using namespace boost;
   using namespace std;
@@ -132,7 +133,7 @@ AppDelayTracer::Install (const NodeContainer &nodes, const std::string &file)
        node != nodes.End ();
        node++)
     {
-      Ptr<AppDelayTracer> trace = Install (*node, outputStream);
+      Ptr<AppDelayTracer> trace = Install (*node, outputStream, aggregation, dumpPeriod);
       tracers.push_back (trace);
     }
 
@@ -147,7 +148,8 @@ AppDelayTracer::Install (const NodeContainer &nodes, const std::string &file)
 }
 
 void
-AppDelayTracer::Install (Ptr<Node> node, const std::string &file)
+AppDelayTracer::Install (Ptr<Node> node, const std::string &file,
+                         Aggregation aggregation/* = RAW_ROWS*/, Time dumpPeriod/* = Seconds (0)*/)
 {
   using namespace boost;
   using namespace std;
@@ -172,7 +174,7 @@ AppDelayTracer::Install (Ptr<Node> node, const std::string &file)
       outputStream = boost::shared_ptr<std::ostream> (&std::cout, NullDeleter<std::ostream>);
     }
 
-  Ptr<AppDelayTracer> trace = Install (node, outputStream);
+  Ptr<AppDelayTracer> trace = Install (node, outputStream, aggregation, dumpPeriod);
   tracers.push_back (trace);
 
   if (tracers.size () > 0)
@@ -188,11 +190,12 @@ AppDelayTracer::Install (Ptr<Node> node, const std::string &file)
 
 Ptr<AppDelayTracer>
 AppDelayTracer::Install (Ptr<Node> node,
-                         boost::shared_ptr<std::ostream> outputStream)
+                         boost::shared_ptr<std::ostream> outputStream,
+                         Aggregation aggregation/* = RAW_ROWS*/, Time dumpPeriod/* = Seconds (0)*/)
 {
   NS_LOG_DEBUG ("Node: " << node->GetId ());
 
-  Ptr<AppDelayTracer> trace = Create<AppDelayTracer> (outputStream, node);
+  Ptr<AppDelayTracer> trace = Create<AppDelayTracer> (outputStream, node, aggregation, dumpPeriod);
 
   return trace;
 }
@@ -204,6 +207,8 @@ AppDelayTracer::Install (Ptr<Node> node,
 AppDelayTracer::AppDelayTracer (boost::shared_ptr<std::ostream> os, Ptr<Node> node)
 : m_nodePtr (node)
 , m_os (os)
+, m_aggregation (RAW_ROWS)
+, m_finalPrinted (false)
 {
   m_node = boost::lexical_cast<string> (m_nodePtr->GetId ());
 
@@ -219,12 +224,49 @@ AppDelayTracer::AppDelayTracer (boost::shared_ptr<std::ostream> os, Ptr<Node> no
 AppDelayTracer::AppDelayTracer (boost::shared_ptr<std::ostream> os, const std::string &node)
 : m_node (node)
 , m_os (os)
+, m_aggregation (RAW_ROWS)
+, m_finalPrinted (false)
 {
   Connect ();
 }
 
+AppDelayTracer::AppDelayTracer (boost::shared_ptr<std::ostream> os, Ptr<Node> node,
+                                Aggregation aggregation, Time dumpPeriod)
+: m_nodePtr (node)
+, m_os (os)
+, m_aggregation (aggregation)
+, m_period (dumpPeriod)
+, m_finalPrinted (false)
+{
+  m_node = boost::lexical_cast<string> (m_nodePtr->GetId ());
+
+  Connect ();
+
+  string name = Names::FindName (node);
+  if (!name.empty ())
+    {
+      m_node = name;
+    }
+
+  if (m_aggregation != RAW_ROWS)
+    {
+      if (!m_period.IsZero ())
+        {
+          m_printEvent = Simulator::Schedule (m_period, &AppDelayTracer::PeriodicPrinter, this);
+        }
+      m_finalEvent = Simulator::ScheduleDestroy (&AppDelayTracer::FinalPrinter, this);
+    }
+}
+
 AppDelayTracer::~AppDelayTracer ()
 {
+  if (m_aggregation != RAW_ROWS && !m_finalPrinted)
+    {
+      // tracer is destroyed before the end of simulation (Simulator::Destroy)
+      m_printEvent.Cancel ();
+      m_finalEvent.Cancel ();
+      Print (*m_os);
+    }
 };
 
 
@@ -241,21 +283,121 @@ AppDelayTracer::Connect ()
 void
 AppDelayTracer::PrintHeader (std::ostream &os) const
 {
-  os << "Time" << "\t"
-     << "Node" << "\t"
-     << "AppId" << "\t"
-     << "SeqNo" << "\t"
-
-     << "Type" << "\t"
-     << "DelayS" << "\t"
-     << "DelayUS" << "\t"
-     << "RetxCount" << "\t"
-     << "HopCount"  << "";
+  if (m_aggregation == RAW_ROWS)
+    {
+      os << "Time" << "\t"
+         << "Node" << "\t"
+         << "AppId" << "\t"
+         << "SeqNo" << "\t"
+
+         << "Type" << "\t"
+         << "DelayS" << "\t"
+         << "DelayUS" << "\t"
+         << "RetxCount" << "\t"
+         << "HopCount"  << "";
+    }
+  else
+    {
+      os << "Time" << "\t"
+         << "Node" << "\t"
+         << "AppId" << "\t"
+
+         << "Type" << "\t"
+         << "Samples" << "\t"
+         << "MinS" << "\t"
+         << "MeanS" << "\t"
+         << "P50S" << "\t"
+         << "P90S" << "\t"
+         << "P99S" << "\t"
+         << "P999S" << "\t"
+         << "MaxS" << "\t"
+         << "RetxCount" << "\t"
+         << "MeanHopCount" << "\t"
+         << "MaxHopCount" << "";
+    }
+}
+
+void
+AppDelayTracer::PeriodicPrinter ()
+{
+  Print (*m_os);
+  Reset ();
+
+  m_printEvent = Simulator::Schedule (m_period, &AppDelayTracer::PeriodicPrinter, this);
+}
+
+void
+AppDelayTracer::FinalPrinter ()
+{
+  Print (*m_os);
+  Reset ();
+
+  m_finalPrinted = true;
+}
+
+void
+AppDelayTracer::Reset ()
+{
+  for (std::map<uint32_t, boost::tuple<Stats, Stats> >::iterator stats = m_stats.begin ();
+       stats != m_stats.end ();
+       stats++)
+    {
+      stats->second.get<0> ().Reset ();
+      stats->second.get<1> ().Reset ();
+    }
+}
+
+#define PRINTER(printName, INDEX)                                       \
+  if (stats->second.get<INDEX> ().m_delay.GetCount () > 0)              \
+    {                                                                   \
+      const Stats &s = stats->second.get<INDEX> ();                     \
+      os << time.ToDouble (Time::S) << "\t"                             \
+         << m_node << "\t";                                             \
+      if (m_aggregation == PER_APP)                                     \
+        os << stats->first << "\t";                                     \
+      else                                                              \
+        os << "all" << "\t";                                            \
+      os << printName << "\t"                                           \
+         << s.m_delay.GetCount () << "\t"                               \
+         << s.m_delay.GetMin ().ToDouble (Time::S) << "\t"              \
+         << s.m_delay.GetMean ().ToDouble (Time::S) << "\t"             \
+         << s.m_delay.GetQuantile (0.5).ToDouble (Time::S) << "\t"      \
+         << s.m_delay.GetQuantile (0.9).ToDouble (Time::S) << "\t"      \
+         << s.m_delay.GetQuantile (0.99).ToDouble (Time::S) << "\t"     \
+         << s.m_delay.GetQuantile (0.999).ToDouble (Time::S) << "\t"    \
+         << s.m_delay.GetMax ().ToDouble (Time::S) << "\t"              \
+         << s.m_retxCount << "\t"                                       \
+         << (s.m_hopCountSamples > 0 ?                                  \
+             static_cast<double> (s.m_hopCountSum) / s.m_hopCountSamples : -1) << "\t" \
+         << s.m_maxHopCount << "\n";                                    \
+    }
+
+void
+AppDelayTracer::Print (std::ostream &os) const
+{
+  if (m_aggregation == RAW_ROWS)
+    return;
+
+  Time time = Simulator::Now ();
+
+  for (std::map<uint32_t, boost::tuple<Stats, Stats> >::const_iterator stats = m_stats.begin ();
+       stats != m_stats.end ();
+       stats++)
+    {
+      PRINTER ("LastDelay", 0);
+      PRINTER ("FullDelay", 1);
+    }
 }
 
 void
 AppDelayTracer::LastRetransmittedInterestDataDelay (Ptr<App> app, uint32_t seqno, Time delay, int32_t hopCount)
 {
+  if (m_aggregation != RAW_ROWS)
+    {
+      m_stats[m_aggregation == PER_APP ? app->GetId () : 0].get<0> ().Add (delay, 1, hopCount);
+      return;
+    }
+
   *m_os << Simulator::Now ().ToDouble (Time::S) << "\t"
         << m_node << "\t"
         << app->GetId () << "\t"
@@ -270,6 +412,12 @@ AppDelayTracer::LastRetransmittedInterestDataDelay (Ptr<App> app, uint32_t seqno
 void
 AppDelayTracer::FirstInterestDataDelay (Ptr<App> app, uint32_t seqno, Time delay, uint32_t retxCount, int32_t hopCount)
 {
+  if (m_aggregation != RAW_ROWS)
+    {
+      m_stats[m_aggregation == PER_APP ? app->GetId () : 0].get<1> ().Add (delay, retxCount, hopCount);
+      return;
+    }
+
   *m_os << Simulator::Now ().ToDouble (Time::S) << "\t"
         << m_node << "\t"
         << app->GetId () << "\t"
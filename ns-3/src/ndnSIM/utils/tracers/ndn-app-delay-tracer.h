@@ -27,9 +27,12 @@
 #include <ns3/event-id.h>
 #include <ns3/node-container.h>
 
+#include "ndn-delay-histogram.h"
+
 #include <boost/tuple/tuple.hpp>
 #include <boost/shared_ptr.hpp>
 #include <list>
+#include <map>
 
 namespace ns3 {
 
@@ -47,57 +50,80 @@ class App;
 class AppDelayTracer : public SimpleRefCount<AppDelayTracer>
 {
 public:
+  /**
+   * @brief Output mode of the tracer
+   *
+   * In aggregated modes, instead of a text row per satisfied Interest, the tracer keeps
+   * delay histograms (see DelayHistogram) together with retransmission and hop count
+   * counters, and writes their quantiles every dump period and at the end of simulation
+   */
+  enum Aggregation
+    {
+      RAW_ROWS = 0, ///< @brief one row per satisfied Interest (default)
+      PER_APP,      ///< @brief aggregate separately for each application
+      PER_NODE      ///< @brief aggregate all applications on a node together
+    };
+
   /**
    * @brief Helper method to install tracers on all simulation nodes
    *
    * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param aggregation Output mode (by default, one row per satisfied Interest)
+   * @param dumpPeriod How often aggregated data will be written (by default, only at the end of simulation)
    *
    * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This tuple needs to be preserved
    *          for the lifetime of simulation, otherwise SEGFAULTs are inevitable
    * 
    */
   static void
-  InstallAll (const std::string &file);
+  InstallAll (const std::string &file, Aggregation aggregation = RAW_ROWS, Time dumpPeriod = Seconds (0));
 
   /**
    * @brief Helper method to install tracers on the selected simulation nodes
    *
    * @param nodes Nodes on which to install tracer
    * @param file File to which traces will be written.  If filename is -, then std::out is used
+   * @param aggregation Output mode (by default, one row per satisfied Interest)
+   * @param dumpPeriod How often aggregated data will be written (by default, only at the end of simulation)
    *
    * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This tuple needs to be preserved
    *          for the lifetime of simulation, otherwise SEGFAULTs are inevitable
    *
    */
   static void
-  Install (const NodeContainer &nodes, const std::string &file);
+  Install (const NodeContainer &nodes, const std::string &file,
+           Aggregation aggregation = RAW_ROWS, Time dumpPeriod = Seconds (0));
 
   /**
    * @brief Helper method to install tracers on a specific simulation node
    *
    * @param nodes Nodes on which to install tracer
    * @param file File to which traces will be written.  If filename is -, then std::out is used
-   * @param averagingPeriod How often data will be written into the trace file (default, every half second)
+   * @param aggregation Output mode (by default, one row per satisfied Interest)
+   * @param dumpPeriod How often aggregated data will be written (by default, only at the end of simulation)
    *
    * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This tuple needs to be preserved
    *          for the lifetime of simulation, otherwise SEGFAULTs are inevitable
    *
    */
   static void
-  Install (Ptr<Node> node, const std::string &file);
+  Install (Ptr<Node> node, const std::string &file,
+           Aggregation aggregation = RAW_ROWS, Time dumpPeriod = Seconds (0));
 
   /**
    * @brief Helper method to install tracers on a specific simulation node
    *
    * @param nodes Nodes on which to install tracer
    * @param outputStream Smart pointer to a stream
-   * @param averagingPeriod How often data will be written into the trace file (default, every half second)
+   * @param aggregation Output mode (by default, one row per satisfied Interest)
+   * @param dumpPeriod How often aggregated data will be written (by default, only at the end of simulation)
    *
    * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This tuple needs to be preserved
    *          for the lifetime of simulation, otherwise SEGFAULTs are inevitable
    */
   static Ptr<AppDelayTracer>
-  Install (Ptr<Node> node, boost::shared_ptr<std::ostream> outputStream);
+  Install (Ptr<Node> node, boost::shared_ptr<std::ostream> outputStream,
+           Aggregation aggregation = RAW_ROWS, Time dumpPeriod = Seconds (0));
 
   /**
    * @brief Explicit request to remove all statically created tracers
@@ -122,8 +148,20 @@ public:
    */
   AppDelayTracer (boost::shared_ptr<std::ostream> os, const std::string &node);
 
+  /**
+   * @brief Trace constructor with aggregated output
+   * @param os          reference to the output stream
+   * @param node        pointer to the node
+   * @param aggregation output mode
+   * @param dumpPeriod  how often aggregated data is written (zero, only at the end of simulation)
+   */
+  AppDelayTracer (boost::shared_ptr<std::ostream> os, Ptr<Node> node,
+                  Aggregation aggregation, Time dumpPeriod);
+
   /**
    * @brief Destructor
+   *
+   * In aggregated modes, data that has not yet been written is written out
    */
   ~AppDelayTracer ();
 
@@ -134,11 +172,28 @@ public:
    */
   void
   PrintHeader (std::ostream &os) const;
+
+  /**
+   * @brief Print aggregated data collected since the last dump (no-op in RAW_ROWS mode)
+   *
+   * @param os reference to output stream
+   */
+  void
+  Print (std::ostream &os) const;
   
 private:
   void
   Connect ();
 
+  void
+  PeriodicPrinter ();
+
+  void
+  FinalPrinter ();
+
+  void
+  Reset ();
+
   void 
   LastRetransmittedInterestDataDelay (Ptr<App> app, uint32_t seqno, Time delay, int32_t hopCount);
   
@@ -150,6 +205,53 @@ private:
   Ptr<Node> m_nodePtr;
 
   boost::shared_ptr<std::ostream> m_os;
+
+  Aggregation m_aggregation;
+  Time m_period;
+  EventId m_printEvent;
+  EventId m_finalEvent;
+  bool m_finalPrinted;
+
+  /// @cond include_hidden
+  struct Stats
+  {
+    Stats ()
+    {
+      Reset ();
+    }
+
+    inline void Reset ()
+    {
+      m_delay.Reset ();
+      m_retxCount = 0;
+      m_hopCountSum = 0;
+      m_hopCountSamples = 0;
+      m_maxHopCount = -1;
+    }
+
+    inline void Add (Time delay, uint32_t retxCount, int32_t hopCount)
+    {
+      m_delay.Add (delay);
+      m_retxCount += retxCount;
+      if (hopCount >= 0)
+        {
+          m_hopCountSum += hopCount;
+          m_hopCountSamples ++;
+          if (hopCount > m_maxHopCount)
+            m_maxHopCount = hopCount;
+        }
+    }
+
+    DelayHistogram m_delay;
+    uint64_t m_retxCount;
+    uint64_t m_hopCountSum;
+    uint64_t m_hopCountSamples;
+    int32_t m_maxHopCount;
+  };
+  /// @endcond
+
+  // app id (or 0 for PER_NODE) -> (LastDelay, FullDelay)
+  std::map<uint32_t, boost::tuple<Stats, Stats> > m_stats;
 };
 
 } // namespace ndn
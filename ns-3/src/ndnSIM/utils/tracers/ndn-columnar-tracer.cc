@@ -0,0 +1,873 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2011-2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author:  Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "ndn-columnar-tracer.h"
+
+#include "ns3/core-config.h"
+#include "ns3/node.h"
+#include "ns3/packet.h"
+#include "ns3/names.h"
+#include "ns3/callback.h"
+#include "ns3/simulator.h"
+#include "ns3/node-list.h"
+#include "ns3/log.h"
+
+#include "ns3/ndn-face.h"
+#include "ns3/ndn-interest.h"
+#include "ns3/ndn-data.h"
+#include "ns3/ndn-pit-entry.h"
+#include "ns3/ndn-content-store.h"
+#include "ns3/ndn-forwarding-strategy.h"
+
+#ifdef HAVE_PTHREAD_H
+#include "ns3/system-thread.h"
+#include "ns3/system-mutex.h"
+#include "ns3/system-condition.h"
+#endif
+
+#include <boost/lexical_cast.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <cstring>
+
+NS_LOG_COMPONENT_DEFINE ("ndn.ColumnarTracer");
+
+namespace ns3 {
+namespace ndn {
+
+static std::list< Ptr<ColumnarTracer> > g_tracers;
+
+static const char MAGIC[8] = { 'N', 'D', 'N', 'C', 'T', 'R', 'C', '1' };
+static const uint32_t VERSION = 1;
+
+/// @brief Size of the block after which it is handed over to the writer
+static const size_t BLOCK_SIZE = 1024 * 1024;
+
+static const char *COLUMN_NAMES[ColumnarTracer::N_COLUMNS] = {
+  "InInterests",
+  "OutInterests",
+  "DropInterests",
+  "InNacks",
+  "OutNacks",
+  "DropNacks",
+  "InData",
+  "OutData",
+  "DropData",
+  "InSatisfiedInterests",
+  "InTimedOutInterests",
+  "OutSatisfiedInterests",
+  "OutTimedOutInterests",
+  "CacheHits",
+  "CacheMisses"
+};
+
+static const uint32_t NO_SLOT = static_cast<uint32_t> (-1);
+
+////////////////////////////////////////////////////////////////////////////////
+// Encoding helpers
+////////////////////////////////////////////////////////////////////////////////
+
+static inline void
+PutVarint (std::vector<uint8_t> &buf, uint64_t value)
+{
+  while (value >= 0x80)
+    {
+      buf.push_back (static_cast<uint8_t> (value | 0x80));
+      value >>= 7;
+    }
+  buf.push_back (static_cast<uint8_t> (value));
+}
+
+static inline void
+PutInt64 (std::vector<uint8_t> &buf, int64_t value)
+{
+  uint64_t v = static_cast<uint64_t> (value);
+  for (int i = 0; i < 8; i++)
+    {
+      buf.push_back (static_cast<uint8_t> (v >> (8 * i)));
+    }
+}
+
+static inline void
+PutString (std::vector<uint8_t> &buf, const std::string &value)
+{
+  PutVarint (buf, value.size ());
+  buf.insert (buf.end (), value.begin (), value.end ());
+}
+
+static inline bool
+GetVarint (std::istream &is, uint64_t &value)
+{
+  value = 0;
+  for (int shift = 0; shift < 64; shift += 7)
+    {
+      int byte = is.get ();
+      if (byte == std::char_traits<char>::eof ())
+        return false;
+
+      value |= static_cast<uint64_t> (byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0)
+        return true;
+    }
+  return false;
+}
+
+static inline bool
+GetInt64 (std::istream &is, int64_t &value)
+{
+  uint8_t raw[8];
+  if (!is.read (reinterpret_cast<char*> (raw), sizeof (raw)))
+    return false;
+
+  uint64_t v = 0;
+  for (int i = 0; i < 8; i++)
+    {
+      v |= static_cast<uint64_t> (raw[i]) << (8 * i);
+    }
+  value = static_cast<int64_t> (v);
+  return true;
+}
+
+static inline bool
+GetString (std::istream &is, std::string &value)
+{
+  uint64_t size;
+  if (!GetVarint (is, size) || size > 65536)
+    return false;
+
+  value.resize (size);
+  if (size == 0)
+    return true;
+  return static_cast<bool> (is.read (&value[0], size));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Background writer
+////////////////////////////////////////////////////////////////////////////////
+
+/// @cond include_hidden
+class ColumnarTracer::Writer
+{
+public:
+  Writer (const std::string &file)
+#ifdef HAVE_PTHREAD_H
+    : m_stop (false)
+    , m_busy (false)
+#endif
+  {
+    m_os.open (file.c_str (), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+
+#ifdef HAVE_PTHREAD_H
+    if (m_os.is_open ())
+      {
+        m_thread = Create<SystemThread> (MakeCallback (&Writer::Run, this));
+        m_thread->Start ();
+      }
+#endif
+  }
+
+  ~Writer ()
+  {
+#ifdef HAVE_PTHREAD_H
+    if (m_thread != 0)
+      {
+        m_mutex.Lock ();
+        m_stop = true;
+        m_mutex.Unlock ();
+
+        m_wakeup.SetCondition (true);
+        m_wakeup.Signal ();
+        m_thread->Join ();
+      }
+#endif
+    m_os.close ();
+  }
+
+  bool
+  IsOpen () const
+  {
+    return m_os.is_open ();
+  }
+
+  /**
+   * @brief Hand over the block to the writer (block is emptied)
+   */
+  void
+  Push (std::vector<uint8_t> &block)
+  {
+#ifdef HAVE_PTHREAD_H
+    m_mutex.Lock ();
+    m_queue.push_back (std::vector<uint8_t> ());
+    m_queue.back ().swap (block);
+    m_mutex.Unlock ();
+
+    m_wakeup.SetCondition (true);
+    m_wakeup.Signal ();
+#else
+    Write (block);
+    block.clear ();
+#endif
+  }
+
+  /**
+   * @brief Wait until all pushed blocks are stored
+   */
+  void
+  Sync ()
+  {
+#ifdef HAVE_PTHREAD_H
+    while (true)
+      {
+        m_mutex.Lock ();
+        bool done = m_queue.empty () && !m_busy;
+        m_mutex.Unlock ();
+
+        if (done)
+          break;
+
+        m_drained.TimedWait (1000000); // 1ms
+        m_drained.SetCondition (false);
+      }
+#endif
+    m_os.flush ();
+  }
+
+private:
+  void
+  Write (const std::vector<uint8_t> &block)
+  {
+    if (!block.empty ())
+      {
+        m_os.write (reinterpret_cast<const char*> (&block[0]), block.size ());
+      }
+  }
+
+#ifdef HAVE_PTHREAD_H
+  void
+  Run ()
+  {
+    while (true)
+      {
+        // condition is reset before the queue is checked, so a Push that happens
+        // after the check leaves it set and the next wait returns immediately
+        m_wakeup.TimedWait (100000000); // 100ms
+        m_wakeup.SetCondition (false);
+
+        std::list< std::vector<uint8_t> > blocks;
+        bool stop;
+
+        m_mutex.Lock ();
+        blocks.swap (m_queue);
+        stop = m_stop;
+        m_busy = !blocks.empty ();
+        m_mutex.Unlock ();
+
+        for (std::list< std::vector<uint8_t> >::iterator block = blocks.begin ();
+             block != blocks.end ();
+             block++)
+          {
+            Write (*block);
+          }
+
+        m_mutex.Lock ();
+        m_busy = false;
+        bool empty = m_queue.empty ();
+        m_mutex.Unlock ();
+
+        m_drained.SetCondition (true);
+        m_drained.Signal ();
+
+        if (stop && empty)
+          break;
+      }
+  }
+#endif
+
+private:
+  std::ofstream m_os;
+
+#ifdef HAVE_PTHREAD_H
+  Ptr<SystemThread> m_thread;
+  SystemMutex m_mutex;
+  SystemCondition m_wakeup;
+  SystemCondition m_drained;
+
+  std::list< std::vector<uint8_t> > m_queue;
+  bool m_stop;
+  bool m_busy;
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Per-node probe
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Lightweight object connected to trace sources of a single node
+ *
+ * Translates face pointers into slots of the shared column arrays
+ */
+class ColumnarTracer::NodeProbe : public SimpleRefCount<NodeProbe>
+{
+public:
+  NodeProbe (ColumnarTracer *tracer, Ptr<Node> node)
+    : m_tracer (tracer)
+    , m_nodeId (node->GetId ())
+    , m_nodeName (boost::lexical_cast<std::string> (node->GetId ()))
+  {
+    std::string name = Names::FindName (node);
+    if (!name.empty ())
+      {
+        m_nodeName = name;
+      }
+
+    m_nodeSlot = m_tracer->AllocateSlot (m_nodeId, m_nodeName, -1, "all");
+  }
+
+  void
+  Connect (Ptr<Node> node)
+  {
+    Ptr<ForwardingStrategy> fw = node->GetObject<ForwardingStrategy> ();
+    if (fw != 0)
+      {
+        fw->TraceConnectWithoutContext ("OutInterests",  MakeCallback (&NodeProbe::OutInterests, this));
+        fw->TraceConnectWithoutContext ("InInterests",   MakeCallback (&NodeProbe::InInterests, this));
+        fw->TraceConnectWithoutContext ("DropInterests", MakeCallback (&NodeProbe::DropInterests, this));
+
+        fw->TraceConnectWithoutContext ("OutData",  MakeCallback (&NodeProbe::OutData, this));
+        fw->TraceConnectWithoutContext ("InData",   MakeCallback (&NodeProbe::InData, this));
+        fw->TraceConnectWithoutContext ("DropData", MakeCallback (&NodeProbe::DropData, this));
+
+        // only for some strategies
+        fw->TraceConnectWithoutContext ("OutNacks",  MakeCallback (&NodeProbe::OutNacks, this));
+        fw->TraceConnectWithoutContext ("InNacks",   MakeCallback (&NodeProbe::InNacks, this));
+        fw->TraceConnectWithoutContext ("DropNacks", MakeCallback (&NodeProbe::DropNacks, this));
+
+        fw->TraceConnectWithoutContext ("SatisfiedInterests", MakeCallback (&NodeProbe::SatisfiedInterests, this));
+        fw->TraceConnectWithoutContext ("TimedOutInterests",  MakeCallback (&NodeProbe::TimedOutInterests, this));
+      }
+
+    Ptr<ContentStore> cs = node->GetObject<ContentStore> ();
+    if (cs != 0)
+      {
+        cs->TraceConnectWithoutContext ("CacheHits",   MakeCallback (&NodeProbe::CacheHits, this));
+        cs->TraceConnectWithoutContext ("CacheMisses", MakeCallback (&NodeProbe::CacheMisses, this));
+      }
+  }
+
+private:
+  inline uint32_t
+  GetSlot (Ptr<const Face> face)
+  {
+    uint32_t id = face->GetId ();
+    if (id >= m_faceSlots.size ())
+      {
+        m_faceSlots.resize (id + 1, NO_SLOT);
+      }
+
+    if (m_faceSlots[id] == NO_SLOT)
+      {
+        std::ostringstream descr;
+        descr << *face;
+        m_faceSlots[id] = m_tracer->AllocateSlot (m_nodeId, m_nodeName, id, descr.str ());
+      }
+    return m_faceSlots[id];
+  }
+
+  inline void
+  Count (Column column, Ptr<const Packet> wire, Ptr<const Face> face)
+  {
+    if (wire != 0)
+      {
+        m_tracer->Count (GetSlot (face), column, wire->GetSize ());
+      }
+    else
+      {
+        m_tracer->Count (GetSlot (face), column);
+      }
+  }
+
+  void OutInterests  (Ptr<const Interest> i, Ptr<const Face> face) { Count (OUT_INTERESTS,  i->GetWire (), face); }
+  void InInterests   (Ptr<const Interest> i, Ptr<const Face> face) { Count (IN_INTERESTS,   i->GetWire (), face); }
+  void DropInterests (Ptr<const Interest> i, Ptr<const Face> face) { Count (DROP_INTERESTS, i->GetWire (), face); }
+
+  void OutNacks  (Ptr<const Interest> i, Ptr<const Face> face) { Count (OUT_NACKS,  i->GetWire (), face); }
+  void InNacks   (Ptr<const Interest> i, Ptr<const Face> face) { Count (IN_NACKS,   i->GetWire (), face); }
+  void DropNacks (Ptr<const Interest> i, Ptr<const Face> face) { Count (DROP_NACKS, i->GetWire (), face); }
+
+  void OutData  (Ptr<const Data> d, bool fromCache, Ptr<const Face> face) { Count (OUT_DATA,  d->GetWire (), face); }
+  void InData   (Ptr<const Data> d, Ptr<const Face> face)                 { Count (IN_DATA,   d->GetWire (), face); }
+  void DropData (Ptr<const Data> d, Ptr<const Face> face)                 { Count (DROP_DATA, d->GetWire (), face); }
+
+  void
+  SatisfiedInterests (Ptr<const pit::Entry> entry)
+  {
+    PitEntryStats (entry, IN_SATISFIED_INTERESTS, OUT_SATISFIED_INTERESTS);
+  }
+
+  void
+  TimedOutInterests (Ptr<const pit::Entry> entry)
+  {
+    PitEntryStats (entry, IN_TIMED_OUT_INTERESTS, OUT_TIMED_OUT_INTERESTS);
+  }
+
+  void
+  PitEntryStats (Ptr<const pit::Entry> entry, Column inColumn, Column outColumn)
+  {
+    m_tracer->Count (m_nodeSlot, inColumn);
+
+    for (pit::Entry::in_container::const_iterator i = entry->GetIncoming ().begin ();
+         i != entry->GetIncoming ().end ();
+         i++)
+      {
+        m_tracer->Count (GetSlot (i->m_face), inColumn);
+      }
+
+    for (pit::Entry::out_container::const_iterator i = entry->GetOutgoing ().begin ();
+         i != entry->GetOutgoing ().end ();
+         i++)
+      {
+        m_tracer->Count (GetSlot (i->m_face), outColumn);
+      }
+  }
+
+  void
+  CacheHits (Ptr<const Interest>, Ptr<const Data>)
+  {
+    m_tracer->Count (m_nodeSlot, CACHE_HITS);
+  }
+
+  void
+  CacheMisses (Ptr<const Interest>)
+  {
+    m_tracer->Count (m_nodeSlot, CACHE_MISSES);
+  }
+
+private:
+  ColumnarTracer *m_tracer;
+  uint32_t m_nodeId;
+  std::string m_nodeName;
+  uint32_t m_nodeSlot;
+  std::vector<uint32_t> m_faceSlots; ///< @brief face id -> slot
+};
+/// @endcond
+
+////////////////////////////////////////////////////////////////////////////////
+// ColumnarTracer
+////////////////////////////////////////////////////////////////////////////////
+
+void
+ColumnarTracer::Destroy ()
+{
+  g_tracers.clear ();
+}
+
+void
+ColumnarTracer::InstallAll (const std::string &file, Time averagingPeriod/* = Seconds (0.5)*/)
+{
+  Ptr<ColumnarTracer> tracer = Create<ColumnarTracer> (file, averagingPeriod);
+  if (!tracer->IsOpen ())
+    {
+      NS_LOG_ERROR ("File " << file << " cannot be opened for writing. Tracing disabled");
+      return;
+    }
+
+  for (NodeList::Iterator node = NodeList::Begin ();
+       node != NodeList::End ();
+       node++)
+    {
+      tracer->AddNode (*node);
+    }
+
+  g_tracers.push_back (tracer);
+}
+
+void
+ColumnarTracer::Install (const NodeContainer &nodes, const std::string &file, Time averagingPeriod/* = Seconds (0.5)*/)
+{
+  Ptr<ColumnarTracer> tracer = Create<ColumnarTracer> (file, averagingPeriod);
+  if (!tracer->IsOpen ())
+    {
+      NS_LOG_ERROR ("File " << file << " cannot be opened for writing. Tracing disabled");
+      return;
+    }
+
+  for (NodeContainer::Iterator node = nodes.Begin ();
+       node != nodes.End ();
+       node++)
+    {
+      tracer->AddNode (*node);
+    }
+
+  g_tracers.push_back (tracer);
+}
+
+ColumnarTracer::ColumnarTracer (const std::string &file, Time period)
+  : m_period (period)
+  , m_writer (new Writer (file))
+{
+  m_block.reserve (BLOCK_SIZE + BLOCK_SIZE / 4);
+
+  if (!m_writer->IsOpen ())
+    return;
+
+  WriteHeader ();
+  m_sampleEvent = Simulator::Schedule (m_period, &ColumnarTracer::Sample, this);
+}
+
+ColumnarTracer::~ColumnarTracer ()
+{
+  m_sampleEvent.Cancel ();
+
+  if (m_writer->IsOpen ())
+    {
+      Submit ();
+    }
+  delete m_writer;
+}
+
+bool
+ColumnarTracer::IsOpen () const
+{
+  return m_writer->IsOpen ();
+}
+
+const char *
+ColumnarTracer::GetColumnName (uint32_t column)
+{
+  NS_ASSERT (column < N_COLUMNS);
+  return COLUMN_NAMES[column];
+}
+
+void
+ColumnarTracer::AddNode (Ptr<Node> node)
+{
+  NS_LOG_DEBUG ("Node: " << node->GetId ());
+
+  Ptr<NodeProbe> probe = Create<NodeProbe> (this, node);
+  probe->Connect (node);
+  m_probes.push_back (probe);
+}
+
+uint32_t
+ColumnarTracer::AllocateSlot (uint32_t nodeId, const std::string &nodeName, int32_t faceId, const std::string &faceDescr)
+{
+  uint32_t slot = m_packets[0].size ();
+
+  for (uint32_t column = 0; column < N_COLUMNS; column++)
+    {
+      m_packets[column].push_back (0);
+    }
+  for (uint32_t column = 0; column < N_BYTE_COLUMNS; column++)
+    {
+      m_bytes[column].push_back (0);
+    }
+
+  m_block.push_back ('D');
+  PutVarint (m_block, slot);
+  PutVarint (m_block, nodeId);
+  PutString (m_block, nodeName);
+  PutVarint (m_block, static_cast<uint64_t> (faceId + 1));
+  PutString (m_block, faceDescr);
+
+  return slot;
+}
+
+void
+ColumnarTracer::WriteHeader ()
+{
+  m_block.insert (m_block.end (), MAGIC, MAGIC + sizeof (MAGIC));
+  for (int i = 0; i < 4; i++)
+    {
+      m_block.push_back (static_cast<uint8_t> (VERSION >> (8 * i)));
+    }
+  PutInt64 (m_block, m_period.GetNanoSeconds ());
+
+  PutVarint (m_block, N_COLUMNS);
+  PutVarint (m_block, N_BYTE_COLUMNS);
+  for (uint32_t column = 0; column < N_COLUMNS; column++)
+    {
+      PutString (m_block, COLUMN_NAMES[column]);
+    }
+}
+
+void
+ColumnarTracer::Sample ()
+{
+  uint32_t slots = m_packets[0].size ();
+
+  m_block.push_back ('S');
+  PutInt64 (m_block, Simulator::Now ().GetNanoSeconds ());
+  PutVarint (m_block, slots);
+
+  for (uint32_t column = 0; column < N_COLUMNS; column++)
+    {
+      std::vector<uint32_t> &values = m_packets[column];
+      for (uint32_t slot = 0; slot < slots; slot++)
+        {
+          PutVarint (m_block, values[slot]);
+        }
+      if (slots > 0)
+        {
+          std::memset (&values[0], 0, slots * sizeof (uint32_t));
+        }
+    }
+
+  for (uint32_t column = 0; column < N_BYTE_COLUMNS; column++)
+    {
+      std::vector<uint64_t> &values = m_bytes[column];
+      for (uint32_t slot = 0; slot < slots; slot++)
+        {
+          PutVarint (m_block, values[slot]);
+        }
+      if (slots > 0)
+        {
+          std::memset (&values[0], 0, slots * sizeof (uint64_t));
+        }
+    }
+
+  if (m_block.size () >= BLOCK_SIZE)
+    {
+      Submit ();
+    }
+
+  m_sampleEvent = Simulator::Schedule (m_period, &ColumnarTracer::Sample, this);
+}
+
+void
+ColumnarTracer::Submit ()
+{
+  if (m_block.empty ())
+    return;
+
+  m_writer->Push (m_block);
+  m_block.clear ();
+  m_block.reserve (BLOCK_SIZE + BLOCK_SIZE / 4);
+}
+
+void
+ColumnarTracer::Flush ()
+{
+  if (!m_writer->IsOpen ())
+    return;
+
+  Submit ();
+  m_writer->Sync ();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Conversion to TSV
+////////////////////////////////////////////////////////////////////////////////
+
+/// @cond include_hidden
+namespace {
+
+struct SlotInfo
+{
+  SlotInfo ()
+    : m_faceId (-1)
+    , m_seen (false)
+  {
+    for (uint32_t column = 0; column < ColumnarTracer::N_COLUMNS; column++)
+      {
+        m_avgPackets[column] = 0;
+        m_avgKilobytes[column] = 0;
+      }
+  }
+
+  std::string m_nodeName;
+  int32_t m_faceId;
+  std::string m_faceDescr;
+  bool m_seen; ///< @brief whether node-wide satisfied/timed out counters were ever non-zero
+
+  double m_avgPackets[ColumnarTracer::N_COLUMNS];
+  double m_avgKilobytes[ColumnarTracer::N_COLUMNS];
+};
+
+} // namespace
+/// @endcond
+
+bool
+ColumnarTracer::ConvertToTsv (std::istream &is, std::ostream &l3Os, std::ostream &csOs)
+{
+  // same smoothing as in L3RateTracer
+  const double alpha = 0.8;
+
+  char magic[sizeof (MAGIC)];
+  if (!is.read (magic, sizeof (magic)) || std::memcmp (magic, MAGIC, sizeof (MAGIC)) != 0)
+    return false;
+
+  uint8_t version[4];
+  if (!is.read (reinterpret_cast<char*> (version), sizeof (version)) || version[0] != VERSION)
+    return false;
+
+  int64_t periodNs;
+  uint64_t nColumns, nByteColumns;
+  if (!GetInt64 (is, periodNs) || !GetVarint (is, nColumns) || !GetVarint (is, nByteColumns))
+    return false;
+  if (nColumns != N_COLUMNS || nByteColumns != N_BYTE_COLUMNS)
+    return false;
+
+  for (uint32_t column = 0; column < nColumns; column++)
+    {
+      std::string name;
+      if (!GetString (is, name))
+        return false;
+    }
+
+  double period = NanoSeconds (periodNs).ToDouble (Time::S);
+
+  l3Os << "Time" << "\t"
+       << "Node" << "\t"
+       << "FaceId" << "\t"
+       << "FaceDescr" << "\t"
+       << "Type" << "\t"
+       << "Packets" << "\t"
+       << "Kilobytes" << "\t"
+       << "PacketRaw" << "\t"
+       << "KilobytesRaw" << "\n";
+
+  csOs << "Time" << "\t"
+       << "Node" << "\t"
+       << "Type" << "\t"
+       << "Packets" << "\t" << "\n";
+
+  std::vector<SlotInfo> slots;
+  std::vector<uint64_t> packets[N_COLUMNS];
+  std::vector<uint64_t> bytes[N_BYTE_COLUMNS];
+
+  while (true)
+    {
+      int type = is.get ();
+      if (type == std::char_traits<char>::eof ())
+        break;
+
+      if (type == 'D')
+        {
+          uint64_t slot, nodeId, faceId;
+          SlotInfo info;
+          if (!GetVarint (is, slot) || !GetVarint (is, nodeId) || !GetString (is, info.m_nodeName) ||
+              !GetVarint (is, faceId) || !GetString (is, info.m_faceDescr))
+            return false;
+
+          info.m_faceId = static_cast<int32_t> (faceId) - 1;
+          if (slot >= slots.size ())
+            {
+              slots.resize (slot + 1);
+            }
+          slots[slot] = info;
+        }
+      else if (type == 'S')
+        {
+          int64_t timeNs;
+          uint64_t nSlots;
+          if (!GetInt64 (is, timeNs) || !GetVarint (is, nSlots) || nSlots > slots.size ())
+            return false;
+
+          for (uint32_t column = 0; column < N_COLUMNS; column++)
+            {
+              packets[column].resize (nSlots);
+              for (uint32_t slot = 0; slot < nSlots; slot++)
+                {
+                  if (!GetVarint (is, packets[column][slot]))
+                    return false;
+                }
+            }
+          for (uint32_t column = 0; column < N_BYTE_COLUMNS; column++)
+            {
+              bytes[column].resize (nSlots);
+              for (uint32_t slot = 0; slot < nSlots; slot++)
+                {
+                  if (!GetVarint (is, bytes[column][slot]))
+                    return false;
+                }
+            }
+
+          double time = NanoSeconds (timeNs).ToDouble (Time::S);
+
+          for (uint32_t slot = 0; slot < nSlots; slot++)
+            {
+              SlotInfo &info = slots[slot];
+              for (uint32_t column = 0; column < N_COLUMNS; column++)
+                {
+                  double rawBytes = column < N_BYTE_COLUMNS ? bytes[column][slot] : 0;
+
+                  info.m_avgPackets[column] = alpha * packets[column][slot] / period + (1-alpha) * info.m_avgPackets[column];
+                  info.m_avgKilobytes[column] = alpha * rawBytes / period / 1024.0 + (1-alpha) * info.m_avgKilobytes[column];
+                }
+
+              if (info.m_faceId >= 0)
+                {
+                  for (uint32_t column = 0; column < CACHE_HITS; column++)
+                    {
+                      double rawBytes = column < N_BYTE_COLUMNS ? bytes[column][slot] : 0;
+
+                      l3Os << time << "\t"
+                           << info.m_nodeName << "\t"
+                           << info.m_faceId << "\t"
+                           << info.m_faceDescr << "\t"
+                           << COLUMN_NAMES[column] << "\t"
+                           << info.m_avgPackets[column] << "\t"
+                           << info.m_avgKilobytes[column] << "\t"
+                           << packets[column][slot] << "\t"
+                           << rawBytes / 1024.0 << "\n";
+                    }
+                }
+              else
+                {
+                  info.m_seen = info.m_seen ||
+                    packets[IN_SATISFIED_INTERESTS][slot] > 0 || packets[IN_TIMED_OUT_INTERESTS][slot] > 0;
+
+                  if (info.m_seen)
+                    {
+                      const uint32_t columns[] = { IN_SATISFIED_INTERESTS, IN_TIMED_OUT_INTERESTS };
+                      const char *names[] = { "SatisfiedInterests", "TimedOutInterests" };
+                      for (uint32_t i = 0; i < 2; i++)
+                        {
+                          l3Os << time << "\t"
+                               << info.m_nodeName << "\t"
+                               << "-1\tall\t"
+                               << names[i] << "\t"
+                               << info.m_avgPackets[columns[i]] << "\t"
+                               << info.m_avgKilobytes[columns[i]] << "\t"
+                               << packets[columns[i]][slot] << "\t"
+                               << 0 << "\n";
+                        }
+                    }
+
+                  csOs << time << "\t" << info.m_nodeName << "\t"
+                       << "CacheHits" << "\t" << packets[CACHE_HITS][slot] << "\n";
+                  csOs << time << "\t" << info.m_nodeName << "\t"
+                       << "CacheMisses" << "\t" << packets[CACHE_MISSES][slot] << "\n";
+                }
+            }
+        }
+      else
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,196 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2011-2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author:  Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "ndn-delay-histogram.h"
+
+#include "ns3/assert.h"
+
+#include <cmath>
+#include <limits>
+
+namespace ns3 {
+namespace ndn {
+
+/// @brief Position of the most significant bit (value must be non-zero)
+static inline uint32_t
+Log2 (uint64_t value)
+{
+  uint32_t result = 0;
+  for (uint32_t shift = 32; shift > 0; shift >>= 1)
+    {
+      if (value >= (static_cast<uint64_t> (1) << shift))
+        {
+          value >>= shift;
+          result += shift;
+        }
+    }
+  return result;
+}
+
+DelayHistogram::DelayHistogram (uint32_t subBucketBits/* = 6*/)
+  : m_subBucketBits (subBucketBits)
+  , m_subBucketCount (static_cast<uint64_t> (1) << subBucketBits)
+{
+  NS_ASSERT_MSG (subBucketBits > 0 && subBucketBits < 20, "Unreasonable histogram precision");
+  Reset ();
+}
+
+inline uint32_t
+DelayHistogram::GetIndex (uint64_t value) const
+{
+  if (value < m_subBucketCount)
+    return static_cast<uint32_t> (value);
+
+  uint32_t shift = Log2 (value) - m_subBucketBits;
+  return static_cast<uint32_t> ((shift + 1) * m_subBucketCount + ((value >> shift) - m_subBucketCount));
+}
+
+inline uint64_t
+DelayHistogram::GetLowerBound (uint32_t index) const
+{
+  if (index < m_subBucketCount)
+    return index;
+
+  uint32_t shift = index / m_subBucketCount - 1;
+  return (index % m_subBucketCount + m_subBucketCount) << shift;
+}
+
+inline uint64_t
+DelayHistogram::GetWidth (uint32_t index) const
+{
+  if (index < m_subBucketCount)
+    return 1;
+
+  return static_cast<uint64_t> (1) << (index / m_subBucketCount - 1);
+}
+
+void
+DelayHistogram::Add (const Time &delay)
+{
+  int64_t value = delay.GetNanoSeconds ();
+  Add (static_cast<uint64_t> (value > 0 ? value : 0));
+}
+
+void
+DelayHistogram::Add (uint64_t value)
+{
+  uint32_t index = GetIndex (value);
+  if (index >= m_counts.size ())
+    {
+      m_counts.resize (index + 1, 0);
+    }
+  m_counts[index] ++;
+
+  m_count ++;
+  m_sum += value;
+  if (value < m_min)
+    m_min = value;
+  if (value > m_max)
+    m_max = value;
+}
+
+void
+DelayHistogram::Merge (const DelayHistogram &other)
+{
+  NS_ASSERT (m_subBucketBits == other.m_subBucketBits);
+
+  if (other.m_counts.size () > m_counts.size ())
+    {
+      m_counts.resize (other.m_counts.size (), 0);
+    }
+  for (uint32_t index = 0; index < other.m_counts.size (); index++)
+    {
+      m_counts[index] += other.m_counts[index];
+    }
+
+  m_count += other.m_count;
+  m_sum += other.m_sum;
+  if (other.m_min < m_min)
+    m_min = other.m_min;
+  if (other.m_max > m_max)
+    m_max = other.m_max;
+}
+
+void
+DelayHistogram::Reset ()
+{
+  m_count = 0;
+  m_min = std::numeric_limits<uint64_t>::max ();
+  m_max = 0;
+  m_sum = 0;
+  m_counts.clear ();
+}
+
+Time
+DelayHistogram::GetMin () const
+{
+  return m_count > 0 ? NanoSeconds (m_min) : Time ();
+}
+
+Time
+DelayHistogram::GetMax () const
+{
+  return NanoSeconds (m_max);
+}
+
+Time
+DelayHistogram::GetMean () const
+{
+  return m_count > 0 ? NanoSeconds (static_cast<int64_t> (m_sum / m_count)) : Time ();
+}
+
+Time
+DelayHistogram::GetQuantile (double q) const
+{
+  if (m_count == 0)
+    return Time ();
+
+  uint64_t rank = static_cast<uint64_t> (std::ceil (q * m_count));
+  if (rank < 1)
+    rank = 1;
+  if (rank > m_count)
+    rank = m_count;
+
+  uint64_t seen = 0;
+  for (uint32_t index = 0; index < m_counts.size (); index++)
+    {
+      seen += m_counts[index];
+      if (seen >= rank)
+        {
+          uint64_t value = GetLowerBound (index) + GetWidth (index) / 2;
+          if (value < m_min)
+            value = m_min;
+          if (value > m_max)
+            value = m_max;
+          return NanoSeconds (value);
+        }
+    }
+
+  return NanoSeconds (m_max);
+}
+
+double
+DelayHistogram::GetRelativeError () const
+{
+  return 1.0 / (2 * m_subBucketCount);
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -23,6 +23,8 @@
 
 #include "trie.h"
 
+#include <algorithm>
+
 namespace ns3 {
 namespace ndn {
 namespace ndnSIM {
@@ -166,6 +168,25 @@ public:
     return foundItem;
   }
 
+  /**
+   * @brief Find all nodes on the path of the key that satisfy predicate (e.g., PIT lookup for all entries matching Data)
+   * @param result container where iterators to the found nodes are appended, from the
+   *               longest to the shortest prefix
+   */
+  template<class Predicate, class Container>
+  inline void
+  prefix_matches_if (const FullKey &key, Predicate pred, Container &result)
+  {
+    typename Container::size_type first = result.size ();
+    trie_.find_all_if (key, pred, result);
+    std::reverse (result.begin () + first, result.end ());
+
+    for (typename Container::iterator item = result.begin () + first; item != result.end (); item++)
+      {
+        policy_.lookup (s_iterator_to (*item));
+      }
+  }
+
   // /**
   //  * @brief Const version of the longest common prefix match
   //  * (semi-const, because there could be update of the policy anyways)
@@ -365,6 +365,36 @@ public:
     return boost::make_tuple (foundNode, reachLast, trieNode);
   }
 
+  /**
+   * @brief Find all nodes on the path of the key that have payload satisfying predicate
+   * @param key the key for which to perform the prefix matching
+   * @param pred predicate
+   * @param result container where iterators to the found nodes are appended, from the
+   *               shortest to the longest prefix
+   */
+  template<class Predicate, class Container>
+  inline void
+  find_all_if (const FullKey &key, Predicate pred, Container &result)
+  {
+    trie *trieNode = this;
+    if (payload_ != PayloadTraits::empty_payload && pred (payload_))
+      result.push_back (this);
+
+    BOOST_FOREACH (const Key &subkey, key)
+      {
+        typename unordered_set::iterator item = trieNode->children_.find (subkey);
+        if (item == trieNode->children_.end ())
+          break;
+
+        trieNode = &(*item);
+        if (trieNode->payload_ != PayloadTraits::empty_payload &&
+            pred (trieNode->payload_))
+          {
+            result.push_back (trieNode);
+          }
+      }
+  }
+
   /**
    * @brief Find next payload of the sub-trie
    * @returns end() or a valid iterator pointing to the trie leaf (order is not defined, enumeration )
@@ -474,6 +504,12 @@ public:
     return key_;
   }
 
+  const trie *
+  parent () const
+  {
+    return parent_;
+  }
+
   inline void
   PrintStat (std::ostream &os) const;
 
@@ -605,6 +641,24 @@ hash_value (const trie<FullKey, PayloadTraits, PolicyHook> &trie_node)
   return boost::hash_value (trie_node.key_);
 }
 
+/**
+ * @brief Hash of the full key of the node (e.g., name of the cached Data), for the policies
+ *        that need to remember the items after they have been removed from the trie
+ */
+template<typename FullKey, typename PayloadTraits, typename PolicyHook>
+inline std::size_t
+full_key_hash (const trie<FullKey, PayloadTraits, PolicyHook> &trie_node)
+{
+  std::size_t seed = 0;
+  for (const trie<FullKey, PayloadTraits, PolicyHook> *node = &trie_node;
+       node->parent () != 0;
+       node = node->parent ())
+    {
+      boost::hash_combine (seed, hash_value (*node));
+    }
+  return seed;
+}
+
 
 
 template<class Trie, class NonConstTrie> // hack for boost < 1.47
@@ -24,8 +24,14 @@
 #include <vector>
 #include <ostream>
 #include "ns3/assert.h"
+#include "ns3/atomic-counter.h"
+#include "ns3/packet-memory-pool.h"
 
+// Buffer data may be released by any of the threads of MultithreadedSimulatorImpl,
+// so the global free list is only used by sequential builds without PacketMemoryPool
+#if !defined (NS3_MULTITHREADED) && !defined (PACKET_MEMORY_POOL)
 #define BUFFER_FREE_LIST 1
+#endif
 
 namespace ns3 {
 
@@ -774,7 +780,11 @@ private:
    * writing data. i.e., m_start should be initialized to this 
    * value.
    */
+#ifdef NS3_MULTITHREADED
+  static __thread uint32_t g_recommendedStart;
+#else
   static uint32_t g_recommendedStart;
+#endif
 
   /**
    * offset to the start of the virtual zero area from the start
@@ -1062,7 +1072,7 @@ Buffer::Buffer (Buffer const&o)
     m_start (o.m_start),
     m_end (o.m_end)
 {
-  m_data->m_count++;
+  AtomicIncrement (m_data->m_count);
   NS_ASSERT (CheckInternalState ());
 }
 
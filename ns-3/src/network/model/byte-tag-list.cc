@@ -19,12 +19,18 @@
  */
 #include "byte-tag-list.h"
 #include "ns3/log.h"
+#include "ns3/atomic-counter.h"
+#include "packet-memory-pool.h"
 #include <vector>
 #include <cstring>
 
 NS_LOG_COMPONENT_DEFINE ("ByteTagList");
 
+// byte tag data may be released by any of the threads of MultithreadedSimulatorImpl,
+// so the global free list is only used by sequential builds without PacketMemoryPool
+#if !defined (NS3_MULTITHREADED) && !defined (PACKET_MEMORY_POOL)
 #define USE_FREE_LIST 1
+#endif
 #define FREE_LIST_SIZE 1000
 #define OFFSET_MAX (2147483647)
 
@@ -149,7 +155,7 @@ ByteTagList::ByteTagList (const ByteTagList &o)
   NS_LOG_FUNCTION (this << &o);
   if (m_data != 0)
     {
-      m_data->count++;
+      AtomicIncrement (m_data->count);
     }
 }
 ByteTagList &
@@ -165,7 +171,7 @@ ByteTagList::operator = (const ByteTagList &o)
   m_used = o.m_used;
   if (m_data != 0)
     {
-      m_data->count++;
+      AtomicIncrement (m_data->count);
     }
   return *this;
 }
@@ -188,8 +194,14 @@ ByteTagList::Add (TypeId tid, uint32_t bufferSize, int32_t start, int32_t end)
       m_data = Allocate (spaceNeeded);
       m_used = 0;
     } 
+#ifdef NS3_MULTITHREADED
+  // tags shared with another thread are never appended in place
+  else if (m_data->size < spaceNeeded ||
+           m_data->count != 1)
+#else
   else if (m_data->size < spaceNeeded ||
            (m_data->count != 1 && m_data->dirty != m_used))
+#endif
     {
       struct ByteTagListData *newData = Allocate (spaceNeeded);
       std::memcpy (&newData->data, &m_data->data, m_used);
@@ -389,8 +401,7 @@ ByteTagList::Deallocate (struct ByteTagListData *data)
       return;
     }
   g_maxSize = std::max (g_maxSize, data->size);
-  data->count--;
-  if (data->count == 0)
+  if (AtomicDecrement (data->count) == 0)
     {
       if (g_freeList.size () > FREE_LIST_SIZE ||
           data->size < g_maxSize)
@@ -411,7 +422,13 @@ struct ByteTagListData *
 ByteTagList::Allocate (uint32_t size)
 {
   NS_LOG_FUNCTION (this << size);
+#ifdef PACKET_MEMORY_POOL
+  uint32_t blockSize = PacketMemoryPool::GetBlockSize (size + sizeof (struct ByteTagListData) - 4);
+  uint8_t *buffer = static_cast<uint8_t *> (PacketMemoryPool::Allocate (PacketMemoryPool::BYTE_TAG_LIST, blockSize));
+  size = blockSize + 4 - sizeof (struct ByteTagListData);
+#else
   uint8_t *buffer = new uint8_t [size + sizeof (struct ByteTagListData) - 4];
+#endif
   struct ByteTagListData *data = (struct ByteTagListData *)buffer;
   data->count = 1;
   data->size = size;
@@ -427,11 +444,15 @@ ByteTagList::Deallocate (struct ByteTagListData *data)
     {
       return;
     }
-  data->count--;
-  if (data->count == 0)
+  if (AtomicDecrement (data->count) == 0)
     {
+#ifdef PACKET_MEMORY_POOL
+      PacketMemoryPool::Deallocate (PacketMemoryPool::BYTE_TAG_LIST, data,
+                                    data->size + sizeof (struct ByteTagListData) - 4);
+#else
       uint8_t *buffer = (uint8_t *)data;
       delete [] buffer;
+#endif
     }
 }
 
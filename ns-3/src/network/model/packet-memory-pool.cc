@@ -0,0 +1,345 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "packet-memory-pool.h"
+
+#include "ns3/global-value.h"
+#include "ns3/boolean.h"
+#include "ns3/log.h"
+
+#include <new>
+#include <iomanip>
+
+#ifdef NS3_MULTITHREADED
+#include <pthread.h>
+#endif
+
+NS_LOG_COMPONENT_DEFINE ("PacketMemoryPool");
+
+namespace ns3 {
+
+static GlobalValue g_packetMemoryPool ("PacketMemoryPool",
+                                       "Recycle the memory of the packets (read at the first allocation)",
+                                       BooleanValue (true),
+                                       MakeBooleanChecker ());
+
+namespace {
+
+const uint32_t N_SMALL_CLASSES = 16;             //!< 16, 32, ..., 256 bytes
+const uint32_t N_CLASSES = N_SMALL_CLASSES + 6;  //!< then 512, 1024, ..., 16384 bytes
+const std::size_t MAX_BLOCK_SIZE = 16384;        //!< larger blocks are not pooled
+const std::size_t MAX_CACHED_BYTES = 1 << 20;    //!< per size class and thread
+
+/**
+ * \brief Released block, linked in the free list of its size class
+ */
+struct FreeBlock
+{
+  FreeBlock *next;
+};
+
+/**
+ * \brief Free lists and counters of a thread
+ *
+ * A plain structure, so that the cache of sequential builds is zero-initialized
+ * before any packet is created by a static constructor.
+ */
+struct Cache
+{
+  FreeBlock *freeList[N_CLASSES];
+  uint32_t cached[N_CLASSES];
+  PacketMemoryPool::Stats stats[PacketMemoryPool::N_KINDS];
+  bool inUse;
+  Cache *next;
+};
+
+/// -1 until the "PacketMemoryPool" global value is read
+int g_enabled = -1;
+
+#ifdef NS3_MULTITHREADED
+__thread Cache *g_threadCache = 0;
+Cache *g_caches = 0;
+pthread_mutex_t g_cachesMutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_key_t g_cacheKey;
+pthread_once_t g_cacheKeyOnce = PTHREAD_ONCE_INIT;
+
+void
+ReleaseCache (void *cache)
+{
+  pthread_mutex_lock (&g_cachesMutex);
+  static_cast<Cache *> (cache)->inUse = false;
+  pthread_mutex_unlock (&g_cachesMutex);
+}
+
+void
+CreateCacheKey (void)
+{
+  pthread_key_create (&g_cacheKey, &ReleaseCache);
+}
+
+Cache *
+AdoptCache (void)
+{
+  pthread_once (&g_cacheKeyOnce, &CreateCacheKey);
+  pthread_mutex_lock (&g_cachesMutex);
+  Cache *cache = g_caches;
+  while (cache != 0 && cache->inUse)
+    {
+      cache = cache->next;
+    }
+  if (cache == 0)
+    {
+      cache = new Cache ();
+      cache->next = g_caches;
+      g_caches = cache;
+    }
+  cache->inUse = true;
+  pthread_mutex_unlock (&g_cachesMutex);
+  // the cache is released for another thread when this thread terminates
+  pthread_setspecific (g_cacheKey, cache);
+  g_threadCache = cache;
+  return cache;
+}
+
+inline Cache *
+GetCache (void)
+{
+  Cache *cache = g_threadCache;
+  return cache != 0 ? cache : AdoptCache ();
+}
+
+inline Cache *
+GetFirstCache (void)
+{
+  return g_caches;
+}
+#else
+Cache g_cache;
+
+inline Cache *
+GetCache (void)
+{
+  return &g_cache;
+}
+
+inline Cache *
+GetFirstCache (void)
+{
+  return &g_cache;
+}
+#endif
+
+inline uint32_t
+GetClass (std::size_t size)
+{
+  if (size <= 256)
+    {
+      return size == 0 ? 0 : (size - 1) / 16;
+    }
+  return N_SMALL_CLASSES + (32 - __builtin_clz (static_cast<uint32_t> (size - 1))) - 9;
+}
+
+inline std::size_t
+GetClassSize (uint32_t sizeClass)
+{
+  if (sizeClass < N_SMALL_CLASSES)
+    {
+      return (sizeClass + 1) * 16;
+    }
+  return static_cast<std::size_t> (512) << (sizeClass - N_SMALL_CLASSES);
+}
+
+void
+TrimCache (Cache *cache)
+{
+  for (uint32_t i = 0; i < N_CLASSES; i++)
+    {
+      while (cache->freeList[i] != 0)
+        {
+          FreeBlock *block = cache->freeList[i];
+          cache->freeList[i] = block->next;
+          ::operator delete (block);
+        }
+      cache->cached[i] = 0;
+    }
+}
+
+/**
+ * \brief Release the cached blocks at the end of the program
+ */
+struct LocalStaticDestructor
+{
+  ~LocalStaticDestructor ()
+  {
+    // objects destroyed after this point go directly to the heap
+    g_enabled = 0;
+    for (Cache *cache = GetFirstCache (); cache != 0; cache = cache->next)
+      {
+        TrimCache (cache);
+      }
+  }
+} g_localStaticDestructor;
+
+} // anonymous namespace
+
+void *
+PacketMemoryPool::Allocate (enum Kind kind, std::size_t size)
+{
+  Cache *cache = GetCache ();
+  cache->stats[kind].allocations++;
+  if (size > MAX_BLOCK_SIZE)
+    {
+      return ::operator new (size);
+    }
+  uint32_t sizeClass = GetClass (size);
+  FreeBlock *block = cache->freeList[sizeClass];
+  if (block != 0)
+    {
+      cache->freeList[sizeClass] = block->next;
+      cache->cached[sizeClass]--;
+      cache->stats[kind].reused++;
+      return block;
+    }
+  return ::operator new (GetClassSize (sizeClass));
+}
+
+void
+PacketMemoryPool::Deallocate (enum Kind kind, void *block, std::size_t size)
+{
+  Cache *cache = GetCache ();
+  cache->stats[kind].deallocations++;
+  if (size > MAX_BLOCK_SIZE || !IsEnabled ())
+    {
+      ::operator delete (block);
+      return;
+    }
+  uint32_t sizeClass = GetClass (size);
+  if (cache->cached[sizeClass] * GetClassSize (sizeClass) >= MAX_CACHED_BYTES)
+    {
+      ::operator delete (block);
+      return;
+    }
+  FreeBlock *freeBlock = static_cast<FreeBlock *> (block);
+  freeBlock->next = cache->freeList[sizeClass];
+  cache->freeList[sizeClass] = freeBlock;
+  cache->cached[sizeClass]++;
+}
+
+std::size_t
+PacketMemoryPool::GetBlockSize (std::size_t size)
+{
+  return size > MAX_BLOCK_SIZE ? size : GetClassSize (GetClass (size));
+}
+
+void
+PacketMemoryPool::Enable (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  g_enabled = 1;
+}
+
+void
+PacketMemoryPool::Disable (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  g_enabled = 0;
+  Trim ();
+}
+
+bool
+PacketMemoryPool::IsEnabled (void)
+{
+  if (g_enabled < 0)
+    {
+      BooleanValue value;
+      g_packetMemoryPool.GetValue (value);
+      g_enabled = value.Get () ? 1 : 0;
+    }
+  return g_enabled != 0;
+}
+
+void
+PacketMemoryPool::Trim (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  TrimCache (GetCache ());
+}
+
+PacketMemoryPool::Stats
+PacketMemoryPool::GetStats (enum Kind kind)
+{
+  Stats stats = { 0, 0, 0 };
+  for (Cache *cache = GetFirstCache (); cache != 0; cache = cache->next)
+    {
+      stats.allocations += cache->stats[kind].allocations;
+      stats.deallocations += cache->stats[kind].deallocations;
+      stats.reused += cache->stats[kind].reused;
+    }
+  return stats;
+}
+
+void
+PacketMemoryPool::ResetStats (void)
+{
+  for (Cache *cache = GetFirstCache (); cache != 0; cache = cache->next)
+    {
+      for (uint32_t i = 0; i < N_KINDS; i++)
+        {
+          cache->stats[i].allocations = 0;
+          cache->stats[i].deallocations = 0;
+          cache->stats[i].reused = 0;
+        }
+    }
+}
+
+uint64_t
+PacketMemoryPool::GetCachedBytes (void)
+{
+  uint64_t bytes = 0;
+  for (Cache *cache = GetFirstCache (); cache != 0; cache = cache->next)
+    {
+      for (uint32_t i = 0; i < N_CLASSES; i++)
+        {
+          bytes += cache->cached[i] * GetClassSize (i);
+        }
+    }
+  return bytes;
+}
+
+void
+PacketMemoryPool::Print (std::ostream &os)
+{
+  static const char *names[N_KINDS] = {
+    "Packet", "Buffer::Data", "PacketMetadata::Data", "ByteTagListData", "PacketTagList::TagData",
+    "TypedPacketTagList::Data"
+  };
+  for (uint32_t i = 0; i < N_KINDS; i++)
+    {
+      Stats stats = GetStats (static_cast<enum Kind> (i));
+      os << std::left << std::setw (24) << names[i] << std::right
+         << " allocations=" << stats.allocations
+         << " reused=" << stats.reused
+         << " live=" << static_cast<int64_t> (stats.allocations - stats.deallocations)
+         << std::endl;
+    }
+  os << "cached bytes=" << GetCachedBytes () << std::endl;
+}
+
+} // namespace ns3
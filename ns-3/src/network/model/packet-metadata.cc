@@ -26,15 +26,26 @@
 #include "buffer.h"
 #include "header.h"
 #include "trailer.h"
+#include "packet-memory-pool.h"
 
 NS_LOG_COMPONENT_DEFINE ("PacketMetadata");
 
+// the free list is not shared between the threads of MultithreadedSimulatorImpl,
+// and PacketMemoryPool already recycles the metadata storage
+#if !defined (NS3_MULTITHREADED) && !defined (PACKET_MEMORY_POOL)
+#define METADATA_FREE_LIST 1
+#endif
+
 namespace ns3 {
 
 bool PacketMetadata::m_enable = false;
 bool PacketMetadata::m_enableChecking = false;
 bool PacketMetadata::m_metadataSkipped = false;
+#ifdef NS3_MULTITHREADED
+__thread uint32_t PacketMetadata::m_maxSize = 0;
+#else
 uint32_t PacketMetadata::m_maxSize = 0;
+#endif
 uint16_t PacketMetadata::m_chunkUid = 0;
 PacketMetadata::DataFreeList PacketMetadata::m_freeList;
 
@@ -77,8 +88,7 @@ PacketMetadata::ReserveCopy (uint32_t size)
   struct PacketMetadata::Data *newData = PacketMetadata::Create (m_used + size);
   memcpy (newData->m_data, m_data->m_data, m_used);
   newData->m_dirtyEnd = m_used;
-  m_data->m_count--;
-  if (m_data->m_count == 0) 
+  if (AtomicDecrement (m_data->m_count) == 0) 
     {
       PacketMetadata::Recycle (m_data);
     }
@@ -100,10 +110,16 @@ PacketMetadata::Reserve (uint32_t size)
 {
   NS_LOG_FUNCTION (this << size);
   NS_ASSERT (m_data != 0);
+#ifdef NS3_MULTITHREADED
+  // metadata shared with another thread is never extended in place
+  if (m_data->m_size >= m_used + size &&
+      m_data->m_count == 1)
+#else
   if (m_data->m_size >= m_used + size &&
       (m_head == 0xffff ||
        m_data->m_count == 1 ||
        m_data->m_dirtyEnd == m_used))
+#endif
     {
       /* enough room, not dirty. */
     }
@@ -380,10 +396,15 @@ PacketMetadata::AddSmall (const struct PacketMetadata::SmallItem *item)
   uint32_t typeUidSize = GetUleb128Size (item->typeUid);
   uint32_t sizeSize = GetUleb128Size (item->size);
   uint32_t n =  2 + 2 + typeUidSize + sizeSize + 2;
+#ifdef NS3_MULTITHREADED
+  if (m_used + n > m_data->m_size ||
+      m_data->m_count != 1)
+#else
   if (m_used + n > m_data->m_size ||
       (m_head != 0xffff &&
        m_data->m_count != 1 &&
        m_used != m_data->m_dirtyEnd))
+#endif
     {
       ReserveCopy (n);
     }
@@ -418,10 +439,15 @@ PacketMetadata::AddBig (uint32_t next, uint32_t prev,
   uint32_t fragEndSize = GetUleb128Size (extraItem->fragmentEnd);
   uint32_t n = 2 + 2 + typeUidSize + sizeSize + 2 + fragStartSize + fragEndSize + 4;
 
+#ifdef NS3_MULTITHREADED
+  if (m_used + n > m_data->m_size ||
+      m_data->m_count != 1)
+#else
   if (m_used + n > m_data->m_size ||
       (m_head != 0xffff &&
        m_data->m_count != 1 &&
        m_used != m_data->m_dirtyEnd))
+#endif
     {
       ReserveCopy (n);
     }
@@ -576,6 +602,7 @@ PacketMetadata::Create (uint32_t size)
     {
       m_maxSize = size;
     }
+#ifdef METADATA_FREE_LIST
   while (!m_freeList.empty ()) 
     {
       struct PacketMetadata::Data *data = m_freeList.back ();
@@ -589,6 +616,7 @@ PacketMetadata::Create (uint32_t size)
       PacketMetadata::Deallocate (data);
       NS_LOG_LOGIC ("create dealloc size="<<data->m_size);
     }
+#endif
   NS_LOG_LOGIC ("create alloc size="<<m_maxSize);
   return PacketMetadata::Allocate (m_maxSize);
 }
@@ -597,6 +625,10 @@ void
 PacketMetadata::Recycle (struct PacketMetadata::Data *data)
 {
   NS_LOG_FUNCTION (data);
+#ifndef METADATA_FREE_LIST
+  PacketMetadata::Deallocate (data);
+  return;
+#endif
   if (!m_enable)
     {
       PacketMetadata::Deallocate (data);
@@ -625,7 +657,13 @@ PacketMetadata::Allocate (uint32_t n)
       n = PACKET_METADATA_DATA_M_DATA_SIZE;
     }
   size += n - PACKET_METADATA_DATA_M_DATA_SIZE;
+#ifdef PACKET_MEMORY_POOL
+  uint32_t blockSize = PacketMemoryPool::GetBlockSize (size);
+  n += blockSize - size;
+  uint8_t *buf = static_cast<uint8_t *> (PacketMemoryPool::Allocate (PacketMemoryPool::PACKET_METADATA, blockSize));
+#else
   uint8_t *buf = new uint8_t [size];
+#endif
   struct PacketMetadata::Data *data = (struct PacketMetadata::Data *)buf;
   data->m_size = n;
   data->m_count = 1;
@@ -636,8 +674,13 @@ void
 PacketMetadata::Deallocate (struct PacketMetadata::Data *data)
 {
   NS_LOG_FUNCTION (data);
+#ifdef PACKET_MEMORY_POOL
+  PacketMemoryPool::Deallocate (PacketMemoryPool::PACKET_METADATA, data,
+                                sizeof (struct Data) + data->m_size - PACKET_METADATA_DATA_M_DATA_SIZE);
+#else
   uint8_t *buf = (uint8_t *)data;
   delete [] buf;
+#endif
 }
 
 
@@ -32,6 +32,13 @@
 
 NS_LOG_COMPONENT_DEFINE ("PacketTagList");
 
+#ifdef NS3_MULTITHREADED
+// the other lists sharing a merge may have released it in the meantime
+#define NS_ASSERT_MERGE(cur) NS_ASSERT ((cur)->count > 0)
+#else
+#define NS_ASSERT_MERGE(cur) NS_ASSERT ((cur)->count > 1)
+#endif
+
 namespace ns3 {
 
 bool
@@ -103,7 +110,7 @@ PacketTagList::COWTraverse (Tag & tag, PacketTagList::COWWriter Writer)
 
   // At this point cur is a merge, but untested for tid
   NS_ASSERT (cur != 0);
-  NS_ASSERT (cur->count > 1);
+  NS_ASSERT_MERGE (cur);
 
   /*
      Walk the remainder of the list, copying, until we find tid
@@ -131,22 +138,22 @@ PacketTagList::COWTraverse (Tag & tag, PacketTagList::COWWriter Writer)
   while ( /* cur && */ cur->tid != tid)
     {
       NS_ASSERT (cur != 0);
-      NS_ASSERT (cur->count > 1);
-      cur->count--;                       // unmerge cur
+      NS_ASSERT_MERGE (cur);
       struct TagData * copy = new struct TagData ();
       copy->tid = cur->tid;
       copy->count = 1;
       memcpy (copy->data, cur->data, TagData::MAX_SIZE);
       copy->next = cur->next;             // merge into tail
-      copy->next->count++;                // mark new merge
+      AtomicIncrement (copy->next->count); // mark new merge
       *prevNext = copy;                   // point prior list at copy
       prevNext = &copy->next;             // advance
+      Unmerge (cur);                      // unmerge cur
       cur      =  copy->next;
     }
   // Sanity check:
   NS_ASSERT (cur != 0);                 // cur should be non-zero
   NS_ASSERT (cur->tid == tid);          // cur->tid should be tid
-  NS_ASSERT (cur->count > 1);           // cur should be a merge
+  NS_ASSERT_MERGE (cur);                // cur should be a merge
 
   // link around tid, removing it from our list
   found = (this->*Writer)(tag, false, cur, prevNext);
@@ -154,6 +161,17 @@ PacketTagList::COWTraverse (Tag & tag, PacketTagList::COWWriter Writer)
 
 }
 
+void
+PacketTagList::Unmerge (struct PacketTagList::TagData * cur)
+{
+  while (cur != 0 && AtomicDecrement (cur->count) == 0)
+    {
+      struct TagData * next = cur->next;
+      delete cur;
+      cur = next;
+    }
+}
+
 bool
 PacketTagList::Remove (Tag & tag)
 {
@@ -182,13 +200,13 @@ PacketTagList::RemoveWriter (Tag & tag, bool preMerge,
   else
     {
       // cur is always a merge at this point
-      // unmerge cur, since we linked around it already
-      cur->count--;
       if (cur->next != 0)
         {
           // there's a next, so make it a merge
-          cur->next->count++;
+          AtomicIncrement (cur->next->count);
         }
+      // unmerge cur, since we linked around it already
+      Unmerge (cur);
     }
   return found;
 }
@@ -224,7 +242,6 @@ PacketTagList::ReplaceWriter (Tag & tag, bool preMerge,
     {
       // cur is always a merge at this point
       // need to copy, replace, and link past cur
-      cur->count--;                     // unmerge cur
       struct TagData * copy = new struct TagData ();
       copy->tid = tag.GetInstanceTypeId ();
       copy->count = 1;
@@ -233,9 +250,10 @@ PacketTagList::ReplaceWriter (Tag & tag, bool preMerge,
       copy->next = cur->next;           // merge into tail
       if (copy->next != 0)
         {
-          copy->next->count++;          // mark new merge
+          AtomicIncrement (copy->next->count); // mark new merge
         }
       *prevNext = copy;                 // point prior list at copy
+      Unmerge (cur);                    // unmerge cur
     }
   return found;
 }
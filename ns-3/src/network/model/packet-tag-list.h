@@ -28,6 +28,8 @@
 #include <stdint.h>
 #include <ostream>
 #include "ns3/type-id.h"
+#include "ns3/atomic-counter.h"
+#include "ns3/packet-memory-pool.h"
 
 namespace ns3 {
 
@@ -165,6 +167,27 @@ public:
     struct TagData * next;   /**< Pointer to next in list */
     TypeId tid;               /**< Type of the tag serialized into #data */
     uint32_t count;           /**< Number of incoming links */
+
+#ifdef PACKET_MEMORY_POOL
+    /**
+     * \brief Allocate a TagData from PacketMemoryPool
+     * \param size size of TagData
+     * \returns the memory of the TagData
+     */
+    static void *operator new (size_t size)
+    {
+      return PacketMemoryPool::Allocate (PacketMemoryPool::PACKET_TAG_LIST, size);
+    }
+    /**
+     * \brief Release a TagData to PacketMemoryPool
+     * \param data the memory of the TagData
+     * \param size size of TagData
+     */
+    static void operator delete (void *data, size_t size)
+    {
+      PacketMemoryPool::Deallocate (PacketMemoryPool::PACKET_TAG_LIST, data, size);
+    }
+#endif
   };  /* struct TagData */
 
   /**
@@ -286,6 +309,16 @@ private:
    * \returns True, since tag value will definitely be replaced.
    */
   bool ReplaceWriter (Tag & tag, bool preMerge, struct TagData * cur, struct TagData ** prevNext);
+  /**
+   * Drop the link of this list to the merge \pname{cur}.
+   *
+   * The merge normally stays referenced by the other lists.  When these lists
+   * live in other threads of MultithreadedSimulatorImpl they may have released it
+   * in the meantime, in which case the unreferenced part of the chain is deleted.
+   *
+   * \param [in] cur The merge no longer linked from this list.
+   */
+  static void Unmerge (struct TagData * cur);
 
   /**
    * Pointer to first \ref TagData on the list
@@ -311,7 +344,7 @@ PacketTagList::PacketTagList (PacketTagList const &o)
 {
   if (m_next != 0)
     {
-      m_next->count++;
+      AtomicIncrement (m_next->count);
     }
 }
 
@@ -327,7 +360,7 @@ PacketTagList::operator = (PacketTagList const &o)
   m_next = o.m_next;
   if (m_next != 0) 
     {
-      m_next->count++;
+      AtomicIncrement (m_next->count);
     }
   return *this;
 }
@@ -343,8 +376,7 @@ PacketTagList::RemoveAll (void)
   struct TagData *prev = 0;
   for (struct TagData *cur = m_next; cur != 0; cur = cur->next)
     {
-      cur->count--;
-      if (cur->count > 0) 
+      if (AtomicDecrement (cur->count) > 0) 
         {
           break;
         }
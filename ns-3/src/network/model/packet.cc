@@ -131,22 +131,23 @@ Packet::Packet ()
   : m_buffer (),
     m_byteTagList (),
     m_packetTagList (),
+    m_typedTagList (),
     /* The upper 32 bits of the packet id in 
      * metadata is for the system id. For non-
      * distributed simulations, this is simply 
      * zero.  The lower 32 bits are for the 
      * global UID
      */
-    m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | m_globalUid, 0),
+    m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | (AtomicIncrement (m_globalUid) - 1), 0),
     m_nixVector (0)
 {
-  m_globalUid++;
 }
 
 Packet::Packet (const Packet &o)
   : m_buffer (o.m_buffer),
     m_byteTagList (o.m_byteTagList),
     m_packetTagList (o.m_packetTagList),
+    m_typedTagList (o.m_typedTagList),
     m_metadata (o.m_metadata)
 {
   o.m_nixVector ? m_nixVector = o.m_nixVector->Copy ()
@@ -163,6 +164,7 @@ Packet::operator = (const Packet &o)
   m_buffer = o.m_buffer;
   m_byteTagList = o.m_byteTagList;
   m_packetTagList = o.m_packetTagList;
+  m_typedTagList = o.m_typedTagList;
   m_metadata = o.m_metadata;
   o.m_nixVector ? m_nixVector = o.m_nixVector->Copy () 
     : m_nixVector = 0;
@@ -173,21 +175,22 @@ Packet::Packet (uint32_t size)
   : m_buffer (size),
     m_byteTagList (),
     m_packetTagList (),
+    m_typedTagList (),
     /* The upper 32 bits of the packet id in 
      * metadata is for the system id. For non-
      * distributed simulations, this is simply 
      * zero.  The lower 32 bits are for the 
      * global UID
      */
-    m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | m_globalUid, size),
+    m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | (AtomicIncrement (m_globalUid) - 1), size),
     m_nixVector (0)
 {
-  m_globalUid++;
 }
 Packet::Packet (uint8_t const *buffer, uint32_t size, bool magic)
   : m_buffer (0, false),
     m_byteTagList (),
     m_packetTagList (),
+    m_typedTagList (),
     m_metadata (0,0),
     m_nixVector (0)
 {
@@ -199,16 +202,16 @@ Packet::Packet (uint8_t const*buffer, uint32_t size)
   : m_buffer (),
     m_byteTagList (),
     m_packetTagList (),
+    m_typedTagList (),
     /* The upper 32 bits of the packet id in 
      * metadata is for the system id. For non-
      * distributed simulations, this is simply 
      * zero.  The lower 32 bits are for the 
      * global UID
      */
-    m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | m_globalUid, size),
+    m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | (AtomicIncrement (m_globalUid) - 1), size),
     m_nixVector (0)
 {
-  m_globalUid++;
   m_buffer.AddAtStart (size);
   Buffer::Iterator i = m_buffer.Begin ();
   i.Write (buffer, size);
@@ -218,27 +221,29 @@ Packet::Packet (const std::string &buffer)
   : m_buffer (),
     m_byteTagList (),
     m_packetTagList (),
+    m_typedTagList (),
     /* The upper 32 bits of the packet id in 
      * metadata is for the system id. For non-
      * distributed simulations, this is simply 
      * zero.  The lower 32 bits are for the 
      * global UID
      */
-    m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | m_globalUid, buffer.size ()),
+    m_metadata (static_cast<uint64_t> (Simulator::GetSystemId ()) << 32 | (AtomicIncrement (m_globalUid) - 1), buffer.size ()),
     m_nixVector (0)
 {
   NS_LOG_FUNCTION (this << &buffer);
-  m_globalUid++;
   m_buffer.AddAtStart (buffer.size ());
   Buffer::Iterator i = m_buffer.Begin ();
   i.Write (reinterpret_cast<const uint8_t*> (&buffer[0]), buffer.size ());
 }
 
 Packet::Packet (const Buffer &buffer,  const ByteTagList &byteTagList, 
-                const PacketTagList &packetTagList, const PacketMetadata &metadata)
+                const PacketTagList &packetTagList, const TypedPacketTagList &typedTagList,
+                const PacketMetadata &metadata)
   : m_buffer (buffer),
     m_byteTagList (byteTagList),
     m_packetTagList (packetTagList),
+    m_typedTagList (typedTagList),
     m_metadata (metadata),
     m_nixVector (0)
 {
@@ -254,7 +259,7 @@ Packet::CreateFragment (uint32_t start, uint32_t length) const
   PacketMetadata metadata = m_metadata.CreateFragment (start, end);
   // again, call the constructor directly rather than
   // through Create because it is private.
-  return Ptr<Packet> (new Packet (buffer, m_byteTagList, m_packetTagList, metadata), false);
+  return Ptr<Packet> (new Packet (buffer, m_byteTagList, m_packetTagList, m_typedTagList, metadata), false);
 }
 
 void
@@ -269,6 +274,20 @@ Packet::GetNixVector (void) const
   return m_nixVector;
 } 
 
+#ifdef PACKET_MEMORY_POOL
+void *
+Packet::operator new (size_t size)
+{
+  return PacketMemoryPool::Allocate (PacketMemoryPool::PACKET, size);
+}
+
+void
+Packet::operator delete (void *packet, size_t size)
+{
+  PacketMemoryPool::Deallocate (PacketMemoryPool::PACKET, packet, size);
+}
+#endif
+
 void
 Packet::AddHeader (const Header &header)
 {
@@ -921,6 +940,19 @@ Packet::GetPacketTagIterator (void) const
   return PacketTagIterator (m_packetTagList.Head ());
 }
 
+void
+Packet::RemoveAllTypedTags (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_typedTagList.RemoveAll ();
+}
+
+void
+Packet::PrintTypedTags (std::ostream &os) const
+{
+  m_typedTagList.Print (os);
+}
+
 std::ostream& operator<< (std::ostream& os, const Packet &packet)
 {
   packet.Print (os);
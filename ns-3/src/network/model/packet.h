@@ -28,6 +28,7 @@
 #include "tag.h"
 #include "byte-tag-list.h"
 #include "packet-tag-list.h"
+#include "typed-packet-tag.h"
 #include "nix-vector.h"
 #include "ns3/callback.h"
 #include "ns3/assert.h"
@@ -649,6 +650,48 @@ public:
    */
   PacketTagIterator GetPacketTagIterator (void) const;
 
+  /**
+   * \brief Add a typed tag, replacing the tag of the same class if any.
+   *
+   * \param tag the typed tag to add, of a class T deriving from
+   *        TypedPacketTag<T>.
+   *
+   * Typed tags are found in constant time and are not serialized, see
+   * TypedPacketTag.  Like AddPacketTag, this method is const.
+   */
+  template <typename T>
+  void AddTypedTag (const T &tag) const;
+  /**
+   * \brief Remove a typed tag.
+   *
+   * \param tag the typed tag type to remove from this packet.
+   *        The tag parameter is set to the value of the tag found.
+   * \returns true if the requested tag is found, false
+   *          otherwise.
+   */
+  template <typename T>
+  bool RemoveTypedTag (T &tag);
+  /**
+   * \brief Search a typed tag of the class of \pname{tag}.
+   *
+   * \param tag the typed tag to search in this packet.
+   *        The tag parameter is set to the value of the tag found.
+   * \returns true if the requested tag is found, false
+   *          otherwise.
+   */
+  template <typename T>
+  bool PeekTypedTag (T &tag) const;
+  /**
+   * \brief Remove all typed tags.
+   */
+  void RemoveAllTypedTags (void);
+  /**
+   * \brief Print the list of typed tags.
+   *
+   * \param os the stream on which to print the tags.
+   */
+  void PrintTypedTags (std::ostream &os) const;
+
   /**
    * \brief Set the packet nix-vector.
    *
@@ -671,22 +714,40 @@ public:
    */
   Ptr<NixVector> GetNixVector (void) const; 
 
+#ifdef PACKET_MEMORY_POOL
+  /**
+   * \brief Allocate a packet from PacketMemoryPool
+   * \param size size of the packet object
+   * \returns the memory of the packet
+   */
+  static void *operator new (size_t size);
+  /**
+   * \brief Release a packet to PacketMemoryPool
+   * \param packet the memory of the packet
+   * \param size size of the packet object
+   */
+  static void operator delete (void *packet, size_t size);
+#endif
+
 private:
   /**
    * \brief Constructor
    * \param buffer the packet buffer
    * \param byteTagList the ByteTag list
    * \param packetTagList the packet's Tag list
+   * \param typedTagList the packet's typed tags
    * \param metadata the packet's metadata
    */
   Packet (const Buffer &buffer, const ByteTagList &byteTagList, 
-          const PacketTagList &packetTagList, const PacketMetadata &metadata);
+          const PacketTagList &packetTagList, const TypedPacketTagList &typedTagList,
+          const PacketMetadata &metadata);
 
   uint32_t Deserialize (uint8_t const*buffer, uint32_t size);
 
   Buffer m_buffer;                //!< the packet buffer (it's actual contents)
   ByteTagList m_byteTagList;      //!< the ByteTag list
   PacketTagList m_packetTagList;  //!< the packet's Tag list
+  mutable TypedPacketTagList m_typedTagList; //!< the packet's typed tags
   PacketMetadata m_metadata;      //!< the packet's metadata
 
   /* Please see comments above about nix-vector */
@@ -723,11 +784,15 @@ std::ostream& operator<< (std::ostream& os, const Packet &packet);
  *   - both versions of ns3::Packet::AddAtEnd
  *   - ns3::Packet::RemovePacketTag
  *   - ns3::Packet::ReplacePacketTag
+ *   - ns3::Packet::RemoveTypedTag
  *
  * Non-dirty operations:
  *   - ns3::Packet::AddPacketTag
  *   - ns3::Packet::PeekPacketTag
  *   - ns3::Packet::RemoveAllPacketTags
+ *   - ns3::Packet::AddTypedTag
+ *   - ns3::Packet::PeekTypedTag
+ *   - ns3::Packet::RemoveAllTypedTags
  *   - ns3::Packet::AddByteTag
  *   - ns3::Packet::FindFirstMatchingByteTag
  *   - ns3::Packet::RemoveAllByteTags
@@ -759,6 +824,37 @@ Packet::GetSize (void) const
   return m_buffer.GetSize ();
 }
 
+template <typename T>
+void
+Packet::AddTypedTag (const T &tag) const
+{
+  m_typedTagList.Set (TypedPacketTag<T>::GetSlot (), &tag, sizeof (T));
+}
+
+template <typename T>
+bool
+Packet::RemoveTypedTag (T &tag)
+{
+  if (!PeekTypedTag (tag))
+    {
+      return false;
+    }
+  return m_typedTagList.Remove (TypedPacketTag<T>::GetSlot ());
+}
+
+template <typename T>
+bool
+Packet::PeekTypedTag (T &tag) const
+{
+  const uint8_t *data = m_typedTagList.Peek (TypedPacketTag<T>::GetSlot ());
+  if (data == 0)
+    {
+      return false;
+    }
+  memcpy (&tag, data, sizeof (T));
+  return true;
+}
+
 } // namespace ns3
 
 #endif /* PACKET_H */
@@ -0,0 +1,147 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "typed-packet-tag.h"
+#include "ns3/fatal-error.h"
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+NS_LOG_COMPONENT_DEFINE ("TypedPacketTagList");
+
+namespace ns3 {
+
+namespace {
+
+/**
+ * \brief Classes of typed tags registered so far
+ */
+struct Registry
+{
+  uint32_t count;
+  const char *names[TypedPacketTagList::SLOT_COUNT];
+  TypedPacketTagList::PrintFunction print[TypedPacketTagList::SLOT_COUNT];
+};
+
+// zero-initialized before any constructor runs, so that tags may be registered from
+// static initializers
+Registry g_registry;
+
+} // anonymous namespace
+
+uint32_t
+TypedPacketTagList::Register (const char *name, uint32_t size, PrintFunction print)
+{
+  NS_LOG_FUNCTION (name << size);
+  NS_ASSERT (size <= SLOT_SIZE);
+  uint32_t slot = AtomicIncrement (g_registry.count) - 1;
+  if (slot >= SLOT_COUNT)
+    {
+      NS_FATAL_ERROR ("Cannot register typed packet tag " << name << ": all " << SLOT_COUNT << " slots are used");
+    }
+  g_registry.names[slot] = name;
+  g_registry.print[slot] = print;
+  return slot;
+}
+
+const char *
+TypedPacketTagList::GetName (uint32_t slot)
+{
+  NS_ASSERT (slot < g_registry.count && slot < SLOT_COUNT);
+  return g_registry.names[slot];
+}
+
+void
+TypedPacketTagList::PrepareWrite (void)
+{
+  NS_LOG_FUNCTION (this);
+  Data *data = new Data;
+  data->count = 1;
+  if (m_data == 0)
+    {
+      data->present = 0;
+    }
+  else
+    {
+      // shared with other lists
+      memcpy (data->slots, m_data->slots, sizeof (data->slots));
+      data->present = m_data->present;
+      Release ();
+    }
+  m_data = data;
+}
+
+void
+TypedPacketTagList::Release (void)
+{
+  if (m_data != 0 && AtomicDecrement (m_data->count) == 0)
+    {
+      delete m_data;
+    }
+  m_data = 0;
+}
+
+bool
+TypedPacketTagList::Remove (uint32_t slot)
+{
+  NS_LOG_FUNCTION (this << slot);
+  if (!Contains (slot))
+    {
+      return false;
+    }
+  if (m_data->present == (1U << slot))
+    {
+      // last tag of the list
+      Release ();
+      return true;
+    }
+  if (m_data->count != 1)
+    {
+      PrepareWrite ();
+    }
+  m_data->present &= ~(1U << slot);
+  return true;
+}
+
+void
+TypedPacketTagList::Print (std::ostream &os) const
+{
+  if (m_data == 0)
+    {
+      return;
+    }
+  bool first = true;
+  for (uint32_t slot = 0; slot < SLOT_COUNT; slot++)
+    {
+      if (!Contains (slot))
+        {
+          continue;
+        }
+      if (!first)
+        {
+          os << " ";
+        }
+      os << g_registry.names[slot] << " [";
+      g_registry.print[slot] (os, m_data->slots[slot]);
+      os << "]";
+      first = false;
+    }
+}
+
+} // namespace ns3
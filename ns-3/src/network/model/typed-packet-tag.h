@@ -0,0 +1,313 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#ifndef TYPED_PACKET_TAG_H
+#define TYPED_PACKET_TAG_H
+
+#include <stdint.h>
+#include <string.h>
+#include <ostream>
+#include "ns3/atomic-counter.h"
+#include "ns3/packet-memory-pool.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup packet
+ *
+ * \brief Fixed-slot array of the typed packet tags stored in a packet
+ *
+ * A typed tag is a small trivially copyable class T deriving from
+ * TypedPacketTag<T>.  Each such class is given a slot of the array the first
+ * time it is used, and its value is stored inline in this slot, so that adding,
+ * looking up and removing a typed tag is a constant time operation without any
+ * TypeId comparison or serialization.
+ *
+ * The array is shared by the copies of a packet and copied by the first copy which
+ * modifies it (copy-on-write), like PacketTagList.
+ *
+ * This class is mostly private to the Packet implementation and users
+ * should never have to access it directly.
+ */
+class TypedPacketTagList
+{
+public:
+  /**
+   * \brief Limits of the typed tags
+   */
+  enum
+  {
+    SLOT_COUNT = 8,  //!< Maximum number of classes of typed tags
+    SLOT_SIZE = 16   //!< Maximum size (in bytes) of a typed tag
+  };
+
+  /**
+   * \brief Function printing the value of a typed tag stored in a slot
+   */
+  typedef void (*PrintFunction)(std::ostream &os, const uint8_t *data);
+
+  inline TypedPacketTagList ();
+  inline TypedPacketTagList (const TypedPacketTagList &o);
+  inline TypedPacketTagList &operator = (const TypedPacketTagList &o);
+  inline ~TypedPacketTagList ();
+
+  /**
+   * \param slot the slot of the tag
+   * \returns true if the tag is stored in the list
+   */
+  inline bool Contains (uint32_t slot) const;
+  /**
+   * \param slot the slot of the tag
+   * \returns the value of the tag, or 0 if it is not stored in the list
+   */
+  inline const uint8_t *Peek (uint32_t slot) const;
+  /**
+   * \brief Store the value of a tag, replacing the previous value if any
+   * \param slot the slot of the tag
+   * \param data the value of the tag
+   * \param size the size of the value, at most SLOT_SIZE
+   */
+  inline void Set (uint32_t slot, const void *data, uint32_t size);
+  /**
+   * \param slot the slot of the tag
+   * \returns true if the tag was stored in the list
+   */
+  bool Remove (uint32_t slot);
+  /**
+   * \brief Remove all the tags from the list
+   */
+  inline void RemoveAll (void);
+  /**
+   * \brief Print the tags stored in the list
+   * \param os the output stream
+   */
+  void Print (std::ostream &os) const;
+
+  /**
+   * \brief Register a class of typed tags (done by TypedPacketTag<T>::GetSlot)
+   * \param name name of the class, for printing
+   * \param size size of the class, at most SLOT_SIZE
+   * \param print function printing a tag of the class
+   * \returns the slot of the class
+   */
+  static uint32_t Register (const char *name, uint32_t size, PrintFunction print);
+  /**
+   * \param slot a registered slot
+   * \returns the name of the class using the slot
+   */
+  static const char *GetName (uint32_t slot);
+
+private:
+  /**
+   * \brief Array of slots, shared by the copies of the list
+   */
+  struct Data
+  {
+    uint32_t count;   //!< Number of lists referencing the array
+    uint32_t present; //!< Bit mask of the slots holding a tag
+    uint8_t slots[SLOT_COUNT][SLOT_SIZE]; //!< Values of the tags
+
+#ifdef PACKET_MEMORY_POOL
+    /**
+     * \brief Allocate a Data from PacketMemoryPool
+     * \param size size of Data
+     * \returns the memory of the Data
+     */
+    static void *operator new (size_t size)
+    {
+      return PacketMemoryPool::Allocate (PacketMemoryPool::TYPED_PACKET_TAG_LIST, size);
+    }
+    /**
+     * \brief Release a Data to PacketMemoryPool
+     * \param data the memory of the Data
+     * \param size size of Data
+     */
+    static void operator delete (void *data, size_t size)
+    {
+      PacketMemoryPool::Deallocate (PacketMemoryPool::TYPED_PACKET_TAG_LIST, data, size);
+    }
+#endif
+  };
+
+  /**
+   * \brief Make sure that the list owns its array, copying a shared one
+   */
+  void PrepareWrite (void);
+  /**
+   * \brief Drop the reference of the list to its array
+   */
+  void Release (void);
+
+  Data *m_data; //!< Array of the tags, 0 if the list is empty
+};
+
+/**
+ * \ingroup packet
+ *
+ * \brief Base class of the typed packet tags
+ *
+ * \tparam T the tag class, which derives from TypedPacketTag<T>
+ *
+ * A typed tag is stored in a packet as a plain copy of its bytes, hence T must be
+ * trivially copyable (no virtual function, no pointer to owned memory) and at most
+ * TypedPacketTagList::SLOT_SIZE bytes long.  T must also provide
+ *
+ * \code
+ *   static const char *GetTypedTagName (void);
+ *   void Print (std::ostream &os) const;
+ * \endcode
+ *
+ * Typed tags are manipulated with Packet::AddTypedTag, Packet::PeekTypedTag and
+ * Packet::RemoveTypedTag.  They are independent from the packet tags
+ * (Packet::AddPacketTag and friends) and are not listed by
+ * Packet::GetPacketTagIterator.
+ *
+ * \code
+ *   class HopCountTag : public TypedPacketTag<HopCountTag>
+ *   {
+ *   public:
+ *     static const char *GetTypedTagName (void) { return "HopCountTag"; }
+ *     void Print (std::ostream &os) const { os << m_hopCount; }
+ *     uint32_t m_hopCount;
+ *   };
+ *
+ *   HopCountTag tag;
+ *   if (packet->PeekTypedTag (tag)) ...
+ * \endcode
+ */
+template <typename T>
+class TypedPacketTag
+{
+public:
+  /**
+   * \returns the slot of T in TypedPacketTagList, registering T the first time
+   */
+  static uint32_t GetSlot (void);
+
+private:
+  /**
+   * \brief Print a tag of class T stored in a slot
+   * \param os the output stream
+   * \param data the value of the tag
+   */
+  static void DoPrint (std::ostream &os, const uint8_t *data);
+};
+
+} // namespace ns3
+
+/****************************************************
+ *  Implementation of inline methods for performance
+ ****************************************************/
+
+namespace ns3 {
+
+TypedPacketTagList::TypedPacketTagList ()
+  : m_data (0)
+{
+}
+
+TypedPacketTagList::TypedPacketTagList (const TypedPacketTagList &o)
+  : m_data (o.m_data)
+{
+  if (m_data != 0)
+    {
+      AtomicIncrement (m_data->count);
+    }
+}
+
+TypedPacketTagList &
+TypedPacketTagList::operator = (const TypedPacketTagList &o)
+{
+  if (m_data == o.m_data)
+    {
+      return *this;
+    }
+  Release ();
+  m_data = o.m_data;
+  if (m_data != 0)
+    {
+      AtomicIncrement (m_data->count);
+    }
+  return *this;
+}
+
+TypedPacketTagList::~TypedPacketTagList ()
+{
+  Release ();
+}
+
+bool
+TypedPacketTagList::Contains (uint32_t slot) const
+{
+  return m_data != 0 && (m_data->present & (1U << slot)) != 0;
+}
+
+const uint8_t *
+TypedPacketTagList::Peek (uint32_t slot) const
+{
+  if (!Contains (slot))
+    {
+      return 0;
+    }
+  return m_data->slots[slot];
+}
+
+void
+TypedPacketTagList::Set (uint32_t slot, const void *data, uint32_t size)
+{
+  if (m_data == 0 || m_data->count != 1)
+    {
+      PrepareWrite ();
+    }
+  memcpy (m_data->slots[slot], data, size);
+  m_data->present |= 1U << slot;
+}
+
+void
+TypedPacketTagList::RemoveAll (void)
+{
+  Release ();
+}
+
+template <typename T>
+uint32_t
+TypedPacketTag<T>::GetSlot (void)
+{
+  // a tag which does not fit in a slot fails to compile here
+  typedef char TagFitsInSlot[sizeof (T) <= TypedPacketTagList::SLOT_SIZE ? 1 : -1];
+  static uint32_t slot = TypedPacketTagList::Register (T::GetTypedTagName (), sizeof (T),
+                                                       &TypedPacketTag<T>::DoPrint);
+  (void) sizeof (TagFitsInSlot);
+  return slot;
+}
+
+template <typename T>
+void
+TypedPacketTag<T>::DoPrint (std::ostream &os, const uint8_t *data)
+{
+  // T may have no default constructor, and data is not necessarily aligned
+  uint64_t tag[TypedPacketTagList::SLOT_SIZE / sizeof (uint64_t)];
+  memcpy (tag, data, sizeof (T));
+  reinterpret_cast<const T *> (tag)->Print (os);
+}
+
+} // namespace ns3
+
+#endif /* TYPED_PACKET_TAG_H */
@@ -19,6 +19,8 @@
  */
 #include "ns3/packet.h"
 #include "ns3/packet-tag-list.h"
+#include "ns3/packet-memory-pool.h"
+#include "ns3/typed-packet-tag.h"
 #include "ns3/test.h"
 #include "ns3/unused.h"
 #include <limits>     // std:numeric_limits
@@ -716,6 +718,159 @@ PacketTagListTest::DoRun (void)
     
 }
 
+//-----------------------------------------------------------------------------
+class PacketMemoryPoolTest : public TestCase
+{
+public:
+  PacketMemoryPoolTest ();
+  virtual void DoRun (void);
+private:
+  void CreatePackets (uint32_t n);
+};
+
+PacketMemoryPoolTest::PacketMemoryPoolTest ()
+  : TestCase ("PacketMemoryPool counters and recycling")
+{
+}
+
+void
+PacketMemoryPoolTest::CreatePackets (uint32_t n)
+{
+  std::vector<Ptr<Packet> > packets;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      Ptr<Packet> p = Create<Packet> (1000);
+      p->AddHeader (ATestHeader<10> ());
+      p->AddPacketTag (ATestTag<2> ());
+      p->AddByteTag (ATestTag<3> ());
+      Ptr<Packet> copy = p->Copy ();
+      copy->AddHeader (ATestHeader<5> ());
+      copy->AddPacketTag (ATestTag<4> ());
+      packets.push_back (p);
+      packets.push_back (copy);
+    }
+  PacketMemoryPool::Stats stats = PacketMemoryPool::GetStats (PacketMemoryPool::PACKET);
+  NS_TEST_EXPECT_MSG_GT_OR_EQ (stats.allocations - stats.deallocations, 2 * n, "Packets are not counted");
+}
+
+void
+PacketMemoryPoolTest::DoRun (void)
+{
+  bool enabled = PacketMemoryPool::IsEnabled ();
+  PacketMemoryPool::Enable ();
+
+  int64_t live[PacketMemoryPool::N_KINDS];
+  for (uint32_t i = 0; i < PacketMemoryPool::N_KINDS; i++)
+    {
+      PacketMemoryPool::Stats stats = PacketMemoryPool::GetStats (static_cast<PacketMemoryPool::Kind> (i));
+      live[i] = stats.allocations - stats.deallocations;
+    }
+
+  CreatePackets (100);
+  PacketMemoryPool::Stats first = PacketMemoryPool::GetStats (PacketMemoryPool::PACKET);
+  CreatePackets (100);
+  PacketMemoryPool::Stats second = PacketMemoryPool::GetStats (PacketMemoryPool::PACKET);
+#ifdef PACKET_MEMORY_POOL
+  NS_TEST_EXPECT_MSG_GT_OR_EQ (second.reused - first.reused, 200, "Released packets are not recycled");
+#endif
+
+  PacketMemoryPool::Disable ();
+  CreatePackets (100);
+  PacketMemoryPool::Stats third = PacketMemoryPool::GetStats (PacketMemoryPool::PACKET);
+  NS_TEST_EXPECT_MSG_EQ (third.reused, second.reused, "Disabled pool still recycles packets");
+  NS_TEST_EXPECT_MSG_EQ (PacketMemoryPool::GetCachedBytes (), 0, "Disabled pool keeps blocks");
+
+  for (uint32_t i = 0; i < PacketMemoryPool::N_KINDS; i++)
+    {
+      PacketMemoryPool::Stats stats = PacketMemoryPool::GetStats (static_cast<PacketMemoryPool::Kind> (i));
+      NS_TEST_EXPECT_MSG_EQ (static_cast<int64_t> (stats.allocations - stats.deallocations), live[i],
+                             "Objects of kind " << i << " leaked");
+    }
+
+  if (enabled)
+    {
+      PacketMemoryPool::Enable ();
+    }
+}
+//-----------------------------------------------------------------------------
+template <int N>
+class ATypedTag : public TypedPacketTag<ATypedTag<N> >
+{
+public:
+  static const char *GetTypedTagName (void) {
+    return "anon::ATypedTag";
+  }
+  void Print (std::ostream &os) const {
+    os << N << "(" << m_data << ")";
+  }
+  uint32_t m_data;
+};
+
+class TypedPacketTagTest : public TestCase
+{
+public:
+  TypedPacketTagTest ();
+  virtual void DoRun (void);
+};
+
+TypedPacketTagTest::TypedPacketTagTest ()
+  : TestCase ("TypedPacketTag: add, peek, remove, copy-on-write")
+{
+}
+
+void
+TypedPacketTagTest::DoRun (void)
+{
+  uint32_t slot1 = TypedPacketTag<ATypedTag<1> >::GetSlot ();
+  uint32_t slot2 = TypedPacketTag<ATypedTag<2> >::GetSlot ();
+  NS_TEST_EXPECT_MSG_NE (slot1, slot2, "Tag classes share a slot");
+
+  Ptr<Packet> p = Create<Packet> (100);
+  ATypedTag<1> a;
+  ATypedTag<2> b;
+  NS_TEST_EXPECT_MSG_EQ (p->PeekTypedTag (a), false, "Empty packet has a tag");
+
+  a.m_data = 10;
+  p->AddTypedTag (a);
+  a.m_data = 0;
+  NS_TEST_EXPECT_MSG_EQ (p->PeekTypedTag (a), true, "Tag not found");
+  NS_TEST_EXPECT_MSG_EQ (a.m_data, 10U, "Wrong tag value");
+  NS_TEST_EXPECT_MSG_EQ (p->PeekTypedTag (b), false, "Tag of another class found");
+
+  // adding replaces the value
+  a.m_data = 11;
+  p->AddTypedTag (a);
+  b.m_data = 20;
+  p->AddTypedTag (b);
+  a.m_data = 0;
+  p->PeekTypedTag (a);
+  NS_TEST_EXPECT_MSG_EQ (a.m_data, 11U, "Tag not replaced");
+
+  // copies share the tags until one of them is modified
+  Ptr<Packet> copy = p->Copy ();
+  a.m_data = 12;
+  copy->AddTypedTag (a);
+  p->PeekTypedTag (a);
+  NS_TEST_EXPECT_MSG_EQ (a.m_data, 11U, "Tag of the copy modified the original");
+  copy->PeekTypedTag (a);
+  NS_TEST_EXPECT_MSG_EQ (a.m_data, 12U, "Tag of the copy not modified");
+  NS_TEST_EXPECT_MSG_EQ (copy->RemoveTypedTag (b), true, "Tag not removed");
+  NS_TEST_EXPECT_MSG_EQ (b.m_data, 20U, "Wrong value of the removed tag");
+  NS_TEST_EXPECT_MSG_EQ (copy->PeekTypedTag (b), false, "Removed tag found");
+  NS_TEST_EXPECT_MSG_EQ (p->PeekTypedTag (b), true, "Removal from the copy modified the original");
+
+  Ptr<Packet> fragment = p->CreateFragment (10, 20);
+  NS_TEST_EXPECT_MSG_EQ (fragment->PeekTypedTag (b), true, "Tag not copied to the fragment");
+
+  std::ostringstream oss;
+  p->PrintTypedTags (oss);
+  NS_TEST_EXPECT_MSG_EQ (oss.str (), "anon::ATypedTag [1(11)] anon::ATypedTag [2(20)]", "Wrong printout");
+
+  p->RemoveAllTypedTags ();
+  NS_TEST_EXPECT_MSG_EQ (p->PeekTypedTag (a), false, "Tag found after RemoveAllTypedTags");
+  NS_TEST_EXPECT_MSG_EQ (p->RemoveTypedTag (b), false, "Tag removed after RemoveAllTypedTags");
+  NS_TEST_EXPECT_MSG_EQ (copy->PeekTypedTag (a), true, "RemoveAllTypedTags modified a copy");
+}
 //-----------------------------------------------------------------------------
 class PacketTestSuite : public TestSuite
 {
@@ -728,6 +883,8 @@ PacketTestSuite::PacketTestSuite ()
 {
   AddTestCase (new PacketTest, TestCase::QUICK);
   AddTestCase (new PacketTagListTest, TestCase::QUICK);
+  AddTestCase (new PacketMemoryPoolTest, TestCase::QUICK);
+  AddTestCase (new TypedPacketTagTest, TestCase::QUICK);
 }
 
 static PacketTestSuite g_packetTestSuite;
@@ -0,0 +1,308 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/default-simulator-impl.h"
+#include "ns3/multithreaded-simulator-impl.h"
+#include "ns3/node.h"
+#include "ns3/node-container.h"
+#include "ns3/net-device-container.h"
+#include "ns3/point-to-point-helper.h"
+#include "ns3/uinteger.h"
+#include "ns3/string.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * Packets forwarded hop by hop on a ring of point-to-point links with chords.  The
+ * next hop only depends on the packet content, so every simulator implementation has
+ * to produce the same receptions on every node.
+ */
+class MultithreadedSimulatorTest : public TestCase
+{
+public:
+  MultithreadedSimulatorTest ();
+
+  virtual void DoRun (void);
+
+private:
+  struct Record
+  {
+    Record (int64_t ts, uint32_t flow, uint32_t hops)
+      : ts (ts), flow (flow), hops (hops)
+    {
+    }
+    bool operator < (const Record &other) const
+    {
+      return ts < other.ts || (ts == other.ts && (flow < other.flow || (flow == other.flow && hops < other.hops)));
+    }
+    bool operator == (const Record &other) const
+    {
+      return ts == other.ts && flow == other.flow && hops == other.hops;
+    }
+    int64_t ts;
+    uint32_t flow;
+    uint32_t hops;
+  };
+  typedef std::vector<std::vector<Record> > Logs;
+
+  Logs RunScenario (Ptr<SimulatorImpl> impl, bool systemIds);
+  void Send (Ptr<Node> node, uint32_t flow, uint32_t hops);
+  bool Receive (Ptr<NetDevice> device, Ptr<const Packet> packet, uint16_t protocol, const Address &from);
+  void Snapshot (void);
+  static Logs Sort (Logs logs);
+
+  Logs m_logs;
+  std::vector<uint32_t> m_snapshots;
+};
+
+static const uint32_t N_NODES = 24;
+static const uint32_t N_FLOWS = 2;
+static const uint32_t MAX_HOPS = 30;
+
+MultithreadedSimulatorTest::MultithreadedSimulatorTest ()
+  : TestCase ("Check that the partitions produce the same results as the sequential simulator")
+{
+}
+
+void
+MultithreadedSimulatorTest::Send (Ptr<Node> node, uint32_t flow, uint32_t hops)
+{
+  uint32_t data[2] = { flow, hops };
+  Ptr<Packet> packet = Create<Packet> (reinterpret_cast<uint8_t *> (data), sizeof (data));
+  Ptr<NetDevice> device = node->GetDevice ((flow + hops) % node->GetNDevices ());
+  device->Send (packet, device->GetBroadcast (), 0x800);
+}
+
+bool
+MultithreadedSimulatorTest::Receive (Ptr<NetDevice> device, Ptr<const Packet> packet,
+                                     uint16_t protocol, const Address &from)
+{
+  uint32_t data[2];
+  packet->CopyData (reinterpret_cast<uint8_t *> (data), sizeof (data));
+  Ptr<Node> node = device->GetNode ();
+  NS_ASSERT (Simulator::GetContext () == node->GetId ());
+  m_logs[node->GetId ()].push_back (Record (Simulator::Now ().GetTimeStep (), data[0], data[1]));
+  if (data[1] < MAX_HOPS)
+    {
+      Simulator::Schedule (MicroSeconds (1 + (data[0] * 7 + data[1]) % 50),
+                           &MultithreadedSimulatorTest::Send, this, node, data[0], data[1] + 1);
+    }
+  return true;
+}
+
+void
+MultithreadedSimulatorTest::Snapshot (void)
+{
+  // executed while no partition runs
+  uint32_t received = 0;
+  for (uint32_t i = 0; i < m_logs.size (); i++)
+    {
+      received += m_logs[i].size ();
+    }
+  m_snapshots.push_back (received);
+}
+
+MultithreadedSimulatorTest::Logs
+MultithreadedSimulatorTest::Sort (Logs logs)
+{
+  for (uint32_t i = 0; i < logs.size (); i++)
+    {
+      std::sort (logs[i].begin (), logs[i].end ());
+    }
+  return logs;
+}
+
+MultithreadedSimulatorTest::Logs
+MultithreadedSimulatorTest::RunScenario (Ptr<SimulatorImpl> impl, bool systemIds)
+{
+  Simulator::SetImplementation (impl);
+  m_logs = Logs (N_NODES);
+  m_snapshots.clear ();
+
+  NodeContainer nodes;
+  for (uint32_t i = 0; i < N_NODES; i++)
+    {
+      nodes.Add (CreateObject<Node> (systemIds ? i % 3 : 0));
+    }
+
+  PointToPointHelper ring;
+  ring.SetDeviceAttribute ("DataRate", StringValue ("100Mbps"));
+  ring.SetChannelAttribute ("Delay", StringValue ("2ms"));
+  PointToPointHelper chord;
+  chord.SetDeviceAttribute ("DataRate", StringValue ("10Mbps"));
+  chord.SetChannelAttribute ("Delay", StringValue ("3ms"));
+
+  NetDeviceContainer devices;
+  for (uint32_t i = 0; i < N_NODES; i++)
+    {
+      devices.Add (ring.Install (nodes.Get (i), nodes.Get ((i + 1) % N_NODES)));
+      if (i % 2 == 0)
+        {
+          devices.Add (chord.Install (nodes.Get (i), nodes.Get ((i + 5) % N_NODES)));
+        }
+    }
+  for (uint32_t i = 0; i < devices.GetN (); i++)
+    {
+      devices.Get (i)->SetReceiveCallback (MakeCallback (&MultithreadedSimulatorTest::Receive, this));
+    }
+
+  for (uint32_t i = 0; i < N_NODES; i++)
+    {
+      for (uint32_t flow = 0; flow < N_FLOWS; flow++)
+        {
+          Simulator::ScheduleWithContext (i, MilliSeconds (10 * flow + i),
+                                          &MultithreadedSimulatorTest::Send, this,
+                                          nodes.Get (i), i * N_FLOWS + flow, 0);
+        }
+    }
+  for (uint32_t i = 1; i <= 10; i++)
+    {
+      Simulator::Schedule (MilliSeconds (25 * i) + MicroSeconds (500),
+                           &MultithreadedSimulatorTest::Snapshot, this);
+    }
+
+  Simulator::Stop (Seconds (10));
+  Simulator::Run ();
+  Simulator::Destroy ();
+  return m_logs;
+}
+
+void
+MultithreadedSimulatorTest::DoRun (void)
+{
+  Logs reference = RunScenario (CreateObject<DefaultSimulatorImpl> (), false);
+  std::vector<uint32_t> snapshots = m_snapshots;
+  uint32_t received = 0;
+  for (uint32_t i = 0; i < N_NODES; i++)
+    {
+      received += reference[i].size ();
+    }
+  NS_TEST_ASSERT_MSG_EQ (received, N_NODES * N_FLOWS * MAX_HOPS + N_NODES * N_FLOWS, "Packets lost");
+  reference = Sort (reference);
+
+  Logs first;
+  uint32_t threads[] = { 1, 2, 4, 1 };
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      Ptr<MultithreadedSimulatorImpl> impl = CreateObject<MultithreadedSimulatorImpl> ();
+      impl->SetAttribute ("ThreadCount", UintegerValue (threads[i]));
+      impl->SetAttribute ("PartitionCount", UintegerValue (4));
+      Logs logs = RunScenario (impl, false);
+
+      NS_TEST_ASSERT_MSG_EQ (impl->GetPartitionCount (), 4, "Unexpected number of partitions");
+      NS_TEST_ASSERT_MSG_EQ (impl->GetLookAhead (), MilliSeconds (2), "Lookahead is not the smallest link delay");
+      NS_TEST_ASSERT_MSG_GT (impl->GetRemoteEventCount (), 0, "No events crossed the partitions");
+      NS_TEST_ASSERT_MSG_EQ ((Sort (logs) == reference), true,
+                             "Receptions differ from DefaultSimulatorImpl with " << threads[i] << " threads");
+      NS_TEST_ASSERT_MSG_EQ ((m_snapshots == snapshots), true, "Events without context executed at another time");
+      if (i == 0)
+        {
+          first = logs;
+        }
+      else
+        {
+          // the same order of events, not only the same events
+          NS_TEST_ASSERT_MSG_EQ ((logs == first), true,
+                                 "Execution with " << threads[i] << " threads differs from the execution with one thread");
+        }
+    }
+
+  Ptr<MultithreadedSimulatorImpl> impl = CreateObject<MultithreadedSimulatorImpl> ();
+  impl->SetAttribute ("ThreadCount", UintegerValue (2));
+  Logs logs = RunScenario (impl, true);
+  NS_TEST_ASSERT_MSG_EQ (impl->GetPartitionCount (), 3, "Partitions have to follow the system ids");
+  for (uint32_t i = 0; i < N_NODES; i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (impl->GetPartition (i), i % 3, "Node " << i << " is not in the partition of its system id");
+    }
+  NS_TEST_ASSERT_MSG_EQ ((Sort (logs) == reference), true, "Receptions differ from DefaultSimulatorImpl with system ids");
+}
+
+/**
+ * Partitioning of a line of nodes: nodes linked without delay stay together and the
+ * partitions are contiguous
+ */
+class MultithreadedSimulatorPartitionTest : public TestCase
+{
+public:
+  MultithreadedSimulatorPartitionTest ();
+
+  virtual void DoRun (void);
+};
+
+MultithreadedSimulatorPartitionTest::MultithreadedSimulatorPartitionTest ()
+  : TestCase ("Check the automatic partitioning")
+{
+}
+
+void
+MultithreadedSimulatorPartitionTest::DoRun (void)
+{
+  Ptr<MultithreadedSimulatorImpl> impl = CreateObject<MultithreadedSimulatorImpl> ();
+  impl->SetAttribute ("PartitionCount", UintegerValue (2));
+  Simulator::SetImplementation (impl);
+
+  NodeContainer nodes;
+  nodes.Create (8);
+  PointToPointHelper p2p;
+  for (uint32_t i = 0; i + 1 < nodes.GetN (); i++)
+    {
+      p2p.SetChannelAttribute ("Delay", StringValue (i == 3 ? "0ms" : (i == 5 ? "1ms" : "5ms")));
+      p2p.Install (nodes.Get (i), nodes.Get (i + 1));
+    }
+
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (impl->GetPartitionCount (), 2, "Unexpected number of partitions");
+  NS_TEST_ASSERT_MSG_EQ (impl->GetPartition (3), impl->GetPartition (4), "Nodes linked without delay are separated");
+  uint32_t changes = 0;
+  for (uint32_t i = 0; i + 1 < nodes.GetN (); i++)
+    {
+      if (impl->GetPartition (i) != impl->GetPartition (i + 1))
+        {
+          changes++;
+          NS_TEST_ASSERT_MSG_EQ (impl->GetLookAhead (), (i == 5 ? MilliSeconds (1) : MilliSeconds (5)),
+                                 "Lookahead is not the delay of the link between the partitions");
+        }
+    }
+  NS_TEST_ASSERT_MSG_EQ (changes, 1, "Partitions are not contiguous");
+
+  Simulator::Destroy ();
+}
+
+class MultithreadedSimulatorTestSuite : public TestSuite
+{
+public:
+  MultithreadedSimulatorTestSuite ();
+};
+
+MultithreadedSimulatorTestSuite::MultithreadedSimulatorTestSuite ()
+  : TestSuite ("multithreaded-simulator", UNIT)
+{
+  AddTestCase (new MultithreadedSimulatorPartitionTest, TestCase::QUICK);
+  AddTestCase (new MultithreadedSimulatorTest, TestCase::QUICK);
+}
+
+static MultithreadedSimulatorTestSuite g_multithreadedSimulatorTestSuite;
@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+
+#include "ns3/partition-helper.h"
+#include "ns3/SumoMobility.h"
+#include "ns3/node.h"
+#include "ns3/assert.h"
+#include <algorithm>
+
+namespace ns3
+{
+namespace vanetmobility
+{
+
+PartitionHelper::PartitionHelper (uint32_t systemCount)
+  : m_systemCount (systemCount),
+    m_alongY (false)
+{
+  NS_ASSERT (systemCount > 0);
+}
+
+void
+PartitionHelper::Partition (Ptr<sumomobility::SumoMobility> sumo)
+{
+  const std::vector<sumomobility::Vehicle> &vehicles = sumo->getVl ().getVehicles ();
+  std::vector<Vector> positions;
+  positions.reserve (vehicles.size ());
+  for (std::vector<sumomobility::Vehicle>::const_iterator vehicle = vehicles.begin ();
+       vehicle != vehicles.end (); ++vehicle)
+    {
+      if (vehicle->trace.empty ())
+        {
+          positions.push_back (Vector ());
+          continue;
+        }
+      const sumomobility::Trace &median = vehicle->trace[vehicle->trace.size () / 2];
+      positions.push_back (Vector (median.x, median.y, 0.0));
+    }
+  Partition (positions);
+}
+
+void
+PartitionHelper::Partition (const std::vector<Vector> &positions)
+{
+  m_systemIds.assign (positions.size (), 0);
+  m_boundaries.clear ();
+  if (positions.empty ())
+    {
+      return;
+    }
+
+  Vector min = positions.front ();
+  Vector max = positions.front ();
+  for (std::vector<Vector>::const_iterator i = positions.begin (); i != positions.end (); ++i)
+    {
+      min.x = std::min (min.x, i->x);
+      min.y = std::min (min.y, i->y);
+      max.x = std::max (max.x, i->x);
+      max.y = std::max (max.y, i->y);
+    }
+  m_alongY = (max.y - min.y) > (max.x - min.x);
+
+  // order vehicles along the longer side and cut into strips of equal size
+  std::vector<std::pair<double, uint32_t> > order;
+  order.reserve (positions.size ());
+  for (uint32_t i = 0; i < positions.size (); i++)
+    {
+      order.push_back (std::make_pair (m_alongY ? positions[i].y : positions[i].x, i));
+    }
+  std::sort (order.begin (), order.end ());
+
+  for (uint32_t i = 0; i < order.size (); i++)
+    {
+      uint32_t systemId = static_cast<uint32_t> (static_cast<uint64_t> (i) * m_systemCount / order.size ());
+      m_systemIds[order[i].second] = systemId;
+      if (i > 0 && systemId != m_systemIds[order[i - 1].second])
+        {
+          m_boundaries.push_back ((order[i - 1].first + order[i].first) / 2);
+        }
+    }
+}
+
+uint32_t
+PartitionHelper::GetSystemId (uint32_t vehicle) const
+{
+  NS_ASSERT (vehicle < m_systemIds.size ());
+  return m_systemIds[vehicle];
+}
+
+const std::vector<double>&
+PartitionHelper::GetBoundaries () const
+{
+  return m_boundaries;
+}
+
+bool
+PartitionHelper::IsCutAlongY () const
+{
+  return m_alongY;
+}
+
+NodeContainer
+PartitionHelper::Create () const
+{
+  NodeContainer nodes;
+  for (uint32_t i = 0; i < m_systemIds.size (); i++)
+    {
+      nodes.Add (CreateObject<Node> (m_systemIds[i]));
+    }
+  return nodes;
+}
+
+} /* namespace vanetmobility */
+} /* namespace ns3 */
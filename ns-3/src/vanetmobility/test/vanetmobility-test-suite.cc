@@ -2,6 +2,7 @@
 
 // Include a header file from your module to test.
 #include "ns3/vanetmobility.h"
+#include "ns3/partition-helper.h"
 
 // An essential include is test.h
 #include "ns3/test.h"
@@ -46,6 +47,65 @@ VanetmobilityTestCase1::DoRun (void)
   NS_TEST_ASSERT_MSG_EQ_TOL (0.01, 0.01, 0.001, "Numbers are not equal within tolerance");
 }
 
+class PartitionHelperTestCase : public TestCase
+{
+public:
+  PartitionHelperTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+PartitionHelperTestCase::PartitionHelperTestCase ()
+  : TestCase ("Check that PartitionHelper cuts balanced strips along the longer side")
+{
+}
+
+void
+PartitionHelperTestCase::DoRun (void)
+{
+  // a 5000m x 200m stretch of road
+  std::vector<Vector> positions;
+  uint32_t state = 1;
+  for (uint32_t i = 0; i < 1001; i++)
+    {
+      state = state * 1103515245 + 12345;
+      double x = (state >> 8) % 5000;
+      state = state * 1103515245 + 12345;
+      double y = (state >> 8) % 200;
+      positions.push_back (Vector (x, y, 0));
+    }
+
+  vanetmobility::PartitionHelper partition (4);
+  partition.Partition (positions);
+
+  NS_TEST_ASSERT_MSG_EQ (partition.IsCutAlongY (), false, "Strips should be cut across the longer side");
+  const std::vector<double> &boundaries = partition.GetBoundaries ();
+  NS_TEST_ASSERT_MSG_EQ (boundaries.size (), 3, "Wrong number of boundaries");
+
+  std::vector<uint32_t> counts (4, 0);
+  for (uint32_t i = 0; i < positions.size (); i++)
+    {
+      uint32_t systemId = partition.GetSystemId (i);
+      NS_TEST_ASSERT_MSG_LT (systemId, 4, "Wrong system id");
+      counts[systemId]++;
+      if (systemId > 0)
+        {
+          NS_TEST_ASSERT_MSG_GT_OR_EQ (positions[i].x, boundaries[systemId - 1], "Vehicle outside of its strip");
+        }
+      if (systemId < 3)
+        {
+          NS_TEST_ASSERT_MSG_LT_OR_EQ (positions[i].x, boundaries[systemId], "Vehicle outside of its strip");
+        }
+    }
+  for (uint32_t systemId = 0; systemId < 4; systemId++)
+    {
+      // 1001 vehicles over 4 ranks
+      NS_TEST_ASSERT_MSG_GT_OR_EQ (counts[systemId], 250, "Strips are not balanced");
+      NS_TEST_ASSERT_MSG_LT_OR_EQ (counts[systemId], 251, "Strips are not balanced");
+    }
+}
+
 // The TestSuite class names the TestSuite, identifies what type of TestSuite,
 // and enables the TestCases to be run.  Typically, only the constructor for
 // this class must be defined
@@ -61,6 +121,7 @@ VanetmobilityTestSuite::VanetmobilityTestSuite ()
 {
   // TestDuration for TestCase can be QUICK, EXTENSIVE or TAKES_FOREVER
   AddTestCase (new VanetmobilityTestCase1, TestCase::QUICK);
+  AddTestCase (new PartitionHelperTestCase, TestCase::QUICK);
 }
 
 // Do not forget to allocate an instance of this TestSuite
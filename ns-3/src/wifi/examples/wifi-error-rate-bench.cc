@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+/*
+ * Benchmark of the chunk success rate computations done by InterferenceHelper for every
+ * received frame.  The same stream of (SNR, nbits) pairs, drawn around the reception
+ * threshold of the mode, is fed to the analytic models and to TabulatedErrorRateModel,
+ * and the number of computations per second of wall-clock time is reported.
+ *
+ *     ./waf --run="wifi-error-rate-bench --n=1000000"
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/nist-error-rate-model.h"
+#include "ns3/yans-error-rate-model.h"
+#include "ns3/tabulated-error-rate-model.h"
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+
+using namespace ns3;
+
+static void
+Report (std::string name, uint32_t n, int64_t ms, double sum)
+{
+  std::cout << std::left << std::setw (36) << name
+            << std::right << std::setw (10) << ms << " ms"
+            << std::setw (16) << std::fixed << std::setprecision (0)
+            << (ms > 0 ? n * 1000.0 / ms : 0.0) << " PER/s"
+            << "   (checksum " << std::setprecision (3) << sum << ")" << std::endl;
+}
+
+static void
+Run (std::string name, Ptr<ErrorRateModel> model, WifiMode mode,
+     const std::vector<double> &snr, const std::vector<uint32_t> &nbits)
+{
+  SystemWallClockMs clock;
+  clock.Start ();
+  double sum = 0;
+  for (uint32_t i = 0; i < snr.size (); i++)
+    {
+      sum += model->GetChunkSuccessRate (mode, snr[i], nbits[i]);
+    }
+  Report (name, snr.size (), clock.End (), sum);
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t n = 1000000;
+  std::string modeName = "OfdmRate6MbpsBW10MHz";
+
+  CommandLine cmd;
+  cmd.AddValue ("n", "Number of chunk success rate computations", n);
+  cmd.AddValue ("mode", "WifiMode to use", modeName);
+  cmd.Parse (argc, argv);
+
+  WifiMode mode (modeName);
+
+  // SNR spread +-10 dB around the value where a 1000-byte frame has 50% success rate
+  Ptr<UniformRandomVariable> rand = CreateObject<UniformRandomVariable> ();
+  double threshold = CreateObject<NistErrorRateModel> ()->CalculateSnr (mode, 1.0 - std::pow (0.5, 1.0 / 8000));
+  double thresholdDb = 10 * std::log10 (threshold);
+  std::vector<double> snr (n);
+  std::vector<uint32_t> nbits (n);
+  for (uint32_t i = 0; i < n; i++)
+    {
+      snr[i] = std::pow (10.0, (thresholdDb + rand->GetValue (-10.0, 10.0)) / 10.0);
+      nbits[i] = rand->GetInteger (8, 12000);
+    }
+
+  std::cout << "mode=" << mode << " n=" << n << " threshold=" << thresholdDb << "dB" << std::endl;
+
+  Ptr<TabulatedErrorRateModel> tabulated = CreateObject<TabulatedErrorRateModel> ();
+  tabulated->GetChunkSuccessRate (mode, 1.0, 1); // build the table outside of the measurement
+
+  Run ("NistErrorRateModel", CreateObject<NistErrorRateModel> (), mode, snr, nbits);
+  Run ("YansErrorRateModel", CreateObject<YansErrorRateModel> (), mode, snr, nbits);
+  Run ("TabulatedErrorRateModel", tabulated, mode, snr, nbits);
+
+  std::vector<double> rates (n);
+  SystemWallClockMs clock;
+  clock.Start ();
+  tabulated->GetChunkSuccessRates (mode, &snr[0], &nbits[0], &rates[0], n);
+  int64_t ms = clock.End ();
+  double sum = 0;
+  for (uint32_t i = 0; i < n; i++)
+    {
+      sum += rates[i];
+    }
+  Report ("TabulatedErrorRateModel (batch)", n, ms, sum);
+
+  return 0;
+}
@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+/*
+ * Benchmark of the InterferenceHelper bookkeeping under high channel occupancy, e.g.,
+ * a dense vehicular scenario where hundreds of transmissions are on the air at once
+ * for every receiver.  Signals arrive with exponential inter-arrival times, so that
+ * on average `occupancy' of them overlap.  Every arrival queries the energy duration
+ * (as done by YansWifiPhy for CCA), and every `rx-every'-th one is received, which
+ * computes SNR and PER over all the overlapping interference.
+ *
+ *     ./waf --run="wifi-interference-bench --occupancy=500 --signals=200000"
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/interference-helper.h"
+#include "ns3/tabulated-error-rate-model.h"
+
+#include <iostream>
+#include <cmath>
+
+using namespace ns3;
+
+class InterferenceBench
+{
+public:
+  InterferenceBench (uint32_t signals, double occupancy, uint32_t rxEvery);
+  void Run (void);
+
+private:
+  void Arrive (void);
+  void EndRx (Ptr<InterferenceHelper::Event> event);
+
+  InterferenceHelper m_helper;
+  WifiMode m_mode;
+  Ptr<UniformRandomVariable> m_power;
+  Ptr<ExponentialRandomVariable> m_interval;
+  Time m_duration;
+  uint32_t m_signals;
+  uint32_t m_rxEvery;
+  bool m_rxing;
+
+  uint32_t m_arrived;
+  uint32_t m_received;
+  Time m_busy;
+  double m_perSum;
+};
+
+InterferenceBench::InterferenceBench (uint32_t signals, double occupancy, uint32_t rxEvery)
+  : m_mode (WifiPhy::GetOfdmRate6MbpsBW10MHz ()),
+    m_duration (MicroSeconds (1400)),
+    m_signals (signals),
+    m_rxEvery (rxEvery),
+    m_rxing (false),
+    m_arrived (0),
+    m_received (0),
+    m_perSum (0)
+{
+  m_helper.SetNoiseFigure (std::pow (10.0, 0.7));
+  m_helper.SetErrorRateModel (CreateObject<TabulatedErrorRateModel> ());
+  m_power = CreateObject<UniformRandomVariable> ();
+  m_interval = CreateObject<ExponentialRandomVariable> ();
+  m_interval->SetAttribute ("Mean", DoubleValue (m_duration.GetSeconds () / occupancy));
+}
+
+void
+InterferenceBench::Run (void)
+{
+  Simulator::ScheduleNow (&InterferenceBench::Arrive, this);
+
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t ms = clock.End ();
+
+  std::cout << "signals=" << m_arrived
+            << " received=" << m_received
+            << " wall-ms=" << ms
+            << " signals/s=" << (ms > 0 ? m_arrived * 1000.0 / ms : 0.0)
+            << " (checksum " << m_busy.GetSeconds () + m_perSum << ")" << std::endl;
+}
+
+void
+InterferenceBench::Arrive (void)
+{
+  // -95 dBm .. -60 dBm
+  double rxPowerW = std::pow (10.0, (m_power->GetValue (-95.0, -60.0) - 30) / 10.0);
+  Ptr<InterferenceHelper::Event> event =
+    m_helper.Add (1000, m_mode, WIFI_PREAMBLE_LONG, m_duration, rxPowerW, WifiTxVector ());
+  m_busy += m_helper.GetEnergyDuration (1e-12);
+
+  m_arrived++;
+  if (!m_rxing && m_arrived % m_rxEvery == 0)
+    {
+      m_rxing = true;
+      m_helper.NotifyRxStart ();
+      Simulator::Schedule (m_duration, &InterferenceBench::EndRx, this, event);
+    }
+  if (m_arrived < m_signals)
+    {
+      Simulator::Schedule (Seconds (m_interval->GetValue ()), &InterferenceBench::Arrive, this);
+    }
+}
+
+void
+InterferenceBench::EndRx (Ptr<InterferenceHelper::Event> event)
+{
+  m_perSum += m_helper.CalculateSnrPer (event).per;
+  m_helper.NotifyRxEnd ();
+  m_rxing = false;
+  m_received++;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t signals = 200000;
+  double occupancy = 100;
+  uint32_t rxEvery = 10;
+
+  CommandLine cmd;
+  cmd.AddValue ("signals", "Number of signals arriving at the receiver", signals);
+  cmd.AddValue ("occupancy", "Average number of signals on the air at once", occupancy);
+  cmd.AddValue ("rx-every", "Try to receive every n-th signal", rxEvery);
+  cmd.Parse (argc, argv);
+
+  InterferenceBench bench (signals, occupancy, rxEvery);
+  bench.Run ();
+
+  Simulator::Destroy ();
+  return 0;
+}
@@ -24,6 +24,7 @@
 #include "ns3/propagation-loss-model.h"
 #include "ns3/propagation-delay-model.h"
 #include "ns3/yans-wifi-channel.h"
+#include "ns3/yans-wifi-remote-channel.h"
 #include "ns3/yans-wifi-phy.h"
 #include "ns3/wifi-net-device.h"
 #include "ns3/radiotap-header.h"
@@ -33,6 +34,8 @@
 #include "ns3/names.h"
 #include "ns3/abort.h"
 #include "ns3/log.h"
+#include "ns3/mpi-interface.h"
+#include "ns3/mpi-receiver.h"
 
 NS_LOG_COMPONENT_DEFINE ("YansWifiHelper");
 
@@ -152,7 +155,15 @@ YansWifiChannelHelper::SetPropagationDelay (std::string type,
 Ptr<YansWifiChannel>
 YansWifiChannelHelper::Create (void) const
 {
-  Ptr<YansWifiChannel> channel = CreateObject<YansWifiChannel> ();
+  Ptr<YansWifiChannel> channel;
+  if (MpiInterface::IsEnabled () && MpiInterface::GetSize () > 1)
+    {
+      channel = CreateObject<YansWifiRemoteChannel> ();
+    }
+  else
+    {
+      channel = CreateObject<YansWifiChannel> ();
+    }
   Ptr<PropagationLossModel> prev = 0;
   for (std::vector<ObjectFactory>::const_iterator i = m_propagationLoss.begin (); i != m_propagationLoss.end (); ++i)
     {
@@ -242,6 +253,14 @@ YansWifiPhyHelper::Create (Ptr<Node> node, Ptr<WifiNetDevice> device) const
   phy->SetChannel (m_channel);
   phy->SetMobility (node);
   phy->SetDevice (device);
+
+  Ptr<YansWifiRemoteChannel> remoteChannel = DynamicCast<YansWifiRemoteChannel> (m_channel);
+  if (remoteChannel != 0)
+    {
+      Ptr<MpiReceiver> mpiRec = CreateObject<MpiReceiver> ();
+      mpiRec->SetReceiveCallback (MakeCallback (&YansWifiRemoteChannel::ReceiveRemote, remoteChannel));
+      device->AggregateObject (mpiRec);
+    }
   return phy;
 }
 
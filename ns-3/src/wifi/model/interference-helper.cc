@@ -98,7 +98,8 @@ InterferenceHelper::Event::GetTxVector (void) const
 
 InterferenceHelper::NiChange::NiChange (Time time, double delta)
   : m_time (time),
-    m_delta (delta)
+    m_delta (delta),
+    m_power (0.0)
 {
 }
 Time
@@ -111,6 +112,16 @@ InterferenceHelper::NiChange::GetDelta (void) const
 {
   return m_delta;
 }
+double
+InterferenceHelper::NiChange::GetPower (void) const
+{
+  return m_power;
+}
+void
+InterferenceHelper::NiChange::SetPower (double power)
+{
+  m_power = power;
+}
 bool
 InterferenceHelper::NiChange::operator < (const InterferenceHelper::NiChange& o) const
 {
@@ -123,6 +134,7 @@ InterferenceHelper::NiChange::operator < (const InterferenceHelper::NiChange& o)
 
 InterferenceHelper::InterferenceHelper ()
   : m_errorRateModel (0),
+    m_niStart (0),
     m_firstPower (0.0),
     m_rxing (false)
 {
@@ -179,18 +191,17 @@ Time
 InterferenceHelper::GetEnergyDuration (double energyW)
 {
   Time now = Simulator::Now ();
-  double noiseInterferenceW = 0.0;
+  NiChanges::const_iterator i = std::lower_bound (GetFirst (), m_niChanges.end (), NiChange (now, 0));
+  if (i == m_niChanges.end ())
+    {
+      // nothing is going to change
+      return MicroSeconds (0);
+    }
   Time end = now;
-  noiseInterferenceW = m_firstPower;
-  for (NiChanges::const_iterator i = m_niChanges.begin (); i != m_niChanges.end (); i++)
+  for (; i != m_niChanges.end (); i++)
     {
-      noiseInterferenceW += i->GetDelta ();
       end = i->GetTime ();
-      if (end < now)
-        {
-          continue;
-        }
-      if (noiseInterferenceW < energyW)
+      if (i->GetPower () < energyW)
         {
           break;
         }
@@ -204,13 +215,24 @@ InterferenceHelper::AppendEvent (Ptr<InterferenceHelper::Event> event)
   Time now = Simulator::Now ();
   if (!m_rxing)
     {
-      NiChanges::iterator nowIterator = GetPosition (now);
-      for (NiChanges::iterator i = m_niChanges.begin (); i != nowIterator; i++)
+      DropNiChanges (GetPosition (now));
+      // all remaining changes are later than now, so the start of the event goes first
+      NiChange start (event->GetStartTime (), event->GetRxPowerW ());
+      if (m_niStart > 0)
         {
-          m_firstPower += i->GetDelta ();
+          m_niStart--;
+          m_niChanges[m_niStart] = start;
+        }
+      else
+        {
+          m_niChanges.insert (m_niChanges.begin (), start);
+        }
+      double power = m_firstPower;
+      for (NiChanges::iterator i = GetFirst (); i != m_niChanges.end (); i++)
+        {
+          power += i->GetDelta ();
+          i->SetPower (power);
         }
-      m_niChanges.erase (m_niChanges.begin (), nowIterator);
-      m_niChanges.insert (m_niChanges.begin (), NiChange (event->GetStartTime (), event->GetRxPowerW ()));
     }
   else
     {
@@ -240,7 +262,7 @@ InterferenceHelper::CalculateNoiseInterferenceW (Ptr<InterferenceHelper::Event>
 {
   double noiseInterference = m_firstPower;
   NS_ASSERT (m_rxing);
-  for (NiChanges::const_iterator i = m_niChanges.begin () + 1; i != m_niChanges.end (); i++)
+  for (NiChanges::const_iterator i = m_niChanges.begin () + m_niStart + 1; i != m_niChanges.end (); i++)
     {
       if ((event->GetEndTime () == i->GetTime ()) && event->GetRxPowerW () == -i->GetDelta ())
         {
@@ -562,19 +584,47 @@ void
 InterferenceHelper::EraseEvents (void)
 {
   m_niChanges.clear ();
+  m_niStart = 0;
   m_rxing = false;
   m_firstPower = 0.0;
 }
 InterferenceHelper::NiChanges::iterator
+InterferenceHelper::GetFirst (void)
+{
+  return m_niChanges.begin () + m_niStart;
+}
+InterferenceHelper::NiChanges::iterator
 InterferenceHelper::GetPosition (Time moment)
 {
-  return std::upper_bound (m_niChanges.begin (), m_niChanges.end (), NiChange (moment, 0));
+  return std::upper_bound (GetFirst (), m_niChanges.end (), NiChange (moment, 0));
 
 }
 void
+InterferenceHelper::DropNiChanges (NiChanges::iterator first)
+{
+  if (first == GetFirst ())
+    {
+      return;
+    }
+  m_firstPower = (first - 1)->GetPower ();
+  m_niStart = first - m_niChanges.begin ();
+  if (m_niStart > m_niChanges.size () / 2)
+    {
+      m_niChanges.erase (m_niChanges.begin (), first);
+      m_niStart = 0;
+    }
+}
+void
 InterferenceHelper::AddNiChangeEvent (NiChange change)
 {
-  m_niChanges.insert (GetPosition (change.GetTime ()), change);
+  NiChanges::iterator i = GetPosition (change.GetTime ());
+  change.SetPower ((i == GetFirst () ? m_firstPower : (i - 1)->GetPower ()) + change.GetDelta ());
+  i = m_niChanges.insert (i, change);
+  // only the changes after the new one (the ends of signals still on the air) are affected
+  for (i++; i != m_niChanges.end (); i++)
+    {
+      i->SetPower (i->GetPower () + change.GetDelta ());
+    }
 }
 void
 InterferenceHelper::NotifyRxStart ()
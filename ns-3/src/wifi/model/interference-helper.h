@@ -227,6 +227,19 @@ public:
      * \return the power
      */
     double GetDelta (void) const;
+    /**
+     * Return the total noise and interference power (w) right after this change,
+     * i.e., the running sum of all deltas up to and including this one.
+     *
+     * \return the total power after the change
+     */
+    double GetPower (void) const;
+    /**
+     * Set the total noise and interference power (w) right after this change.
+     *
+     * \param power
+     */
+    void SetPower (double power);
     /**
      * Compare the event time of two NiChange objects (a < o).
      *
@@ -237,6 +250,7 @@ public:
 private:
     Time m_time;
     double m_delta;
+    double m_power;
   };
   /**
    * typedef for a vector of NiChanges
@@ -295,18 +309,36 @@ private:
 
   double m_noiseFigure; /**< noise figure (linear) */
   Ptr<ErrorRateModel> m_errorRateModel;
-  /// Experimental: needed for energy duration calculation
+  /**
+   * NiChanges sorted by time.  Changes that are no longer needed are dropped from the
+   * front by moving m_niStart, the vector is compacted only when more than half of it
+   * is unused, so dropping is amortized O(1).  Every change carries the running sum of
+   * the noise and interference power, so the power at any moment is found by binary
+   * search, and inserting a change only updates the changes after it (i.e., the ends of
+   * the signals still on the air).
+   */
   NiChanges m_niChanges;
-  double m_firstPower;
+  NiChanges::size_type m_niStart; ///< index of the first change in use
+  double m_firstPower; ///< power before the first change in use
   bool m_rxing;
+  /// Returns an iterator to the first change in use
+  NiChanges::iterator GetFirst (void);
   /// Returns an iterator to the first nichange, which is later than moment
   NiChanges::iterator GetPosition (Time moment);
+  /**
+   * Drop all changes before the given one, accounting them in m_firstPower.
+   *
+   * \param first the first change to keep
+   */
+  void DropNiChanges (NiChanges::iterator first);
   /**
    * Add NiChange to the list at the appropriate position.
    *
    * \param change
    */
   void AddNiChangeEvent (NiChange change);
+
+  friend class InterferenceHelperEquivalenceTest;
 };
 
 } // namespace ns3
@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include <cmath>
+#include <string.h>
+#include <algorithm>
+#include "tabulated-error-rate-model.h"
+#include "nist-error-rate-model.h"
+#include "ns3/pointer.h"
+#include "ns3/log.h"
+
+NS_LOG_COMPONENT_DEFINE ("TabulatedErrorRateModel");
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (TabulatedErrorRateModel);
+
+TypeId
+TabulatedErrorRateModel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::TabulatedErrorRateModel")
+    .SetParent<ErrorRateModel> ()
+    .AddConstructor<TabulatedErrorRateModel> ()
+    .AddAttribute ("ReferenceModel",
+                   "The error rate model to tabulate.",
+                   PointerValue (),
+                   MakePointerAccessor (&TabulatedErrorRateModel::SetReferenceModel,
+                                        &TabulatedErrorRateModel::GetReferenceModel),
+                   MakePointerChecker<ErrorRateModel> ())
+  ;
+  return tid;
+}
+
+TabulatedErrorRateModel::TabulatedErrorRateModel ()
+  : m_reference (CreateObject<NistErrorRateModel> ()),
+    m_minSnr (std::ldexp (1.0, MIN_EXPONENT)),
+    m_maxSnr (std::ldexp (1.0, MAX_EXPONENT))
+{
+}
+
+TabulatedErrorRateModel::~TabulatedErrorRateModel ()
+{
+}
+
+void
+TabulatedErrorRateModel::SetReferenceModel (Ptr<ErrorRateModel> model)
+{
+  if (model != 0)
+    {
+      m_reference = model;
+      m_tables.clear ();
+    }
+}
+
+Ptr<ErrorRateModel>
+TabulatedErrorRateModel::GetReferenceModel (void) const
+{
+  return m_reference;
+}
+
+void
+TabulatedErrorRateModel::BuildTable (WifiMode mode, Table &table) const
+{
+  NS_LOG_FUNCTION (this << mode);
+  std::vector<double> snr (N_CELLS + 1);
+  std::vector<double> y (N_CELLS + 1);
+  for (uint32_t i = 0; i <= N_CELLS; i++)
+    {
+      snr[i] = std::ldexp (1.0 + static_cast<double> (i % CELLS_PER_OCTAVE) / CELLS_PER_OCTAVE,
+                           MIN_EXPONENT + static_cast<int> (i / CELLS_PER_OCTAVE));
+      // per-bit error probability, 0 is clamped to keep the logarithm finite
+      double rate = m_reference->GetChunkSuccessRate (mode, snr[i], 1);
+      double pe = 1.0 - std::max (0.0, std::min (rate, 1.0));
+      y[i] = std::log (std::max (pe, 1e-300));
+    }
+
+  table.resize (N_CELLS);
+  for (uint32_t i = 0; i < N_CELLS; i++)
+    {
+      table[i].snr = snr[i];
+      table[i].y = y[i];
+      table[i].slope = (y[i + 1] - y[i]) / (snr[i + 1] - snr[i]);
+    }
+}
+
+const TabulatedErrorRateModel::Table&
+TabulatedErrorRateModel::GetTable (WifiMode mode) const
+{
+  uint32_t uid = mode.GetUid ();
+  if (uid >= m_tables.size ())
+    {
+      m_tables.resize (uid + 1);
+    }
+  if (m_tables[uid].empty ())
+    {
+      BuildTable (mode, m_tables[uid]);
+    }
+  return m_tables[uid];
+}
+
+double
+TabulatedErrorRateModel::Lookup (const Table &table, double snr, uint32_t nbits) const
+{
+  snr = std::min (std::max (snr, m_minSnr), m_maxSnr);
+
+  // the cell is given by the binary exponent and the leading mantissa bits of the IEEE 754 SNR
+  uint64_t bits;
+  memcpy (&bits, &snr, sizeof (bits));
+  int32_t exponent = static_cast<int32_t> ((bits >> 52) & 0x7ff) - 1023;
+  uint32_t index = (exponent - MIN_EXPONENT) * CELLS_PER_OCTAVE
+    + static_cast<uint32_t> ((bits >> (52 - SUB_CELL_BITS)) & (CELLS_PER_OCTAVE - 1));
+  index = std::min (index, static_cast<uint32_t> (N_CELLS - 1)); // snr == m_maxSnr
+
+  const Cell &cell = table[index];
+  double y = cell.y + cell.slope * (snr - cell.snr);
+  // (1 - pe)^nbits; log1p (-1) is -inf, clamped so that nbits == 0 still gives 1
+  double logRate = std::max (std::log1p (-std::exp (y)), -745.0);
+  return std::exp (static_cast<double> (nbits) * logRate);
+}
+
+bool
+TabulatedErrorRateModel::IsTabulated (WifiMode mode)
+{
+  return mode.GetModulationClass () == WIFI_MOD_CLASS_ERP_OFDM
+    || mode.GetModulationClass () == WIFI_MOD_CLASS_OFDM
+    || mode.GetModulationClass () == WIFI_MOD_CLASS_HT;
+}
+
+double
+TabulatedErrorRateModel::GetChunkSuccessRate (WifiMode mode, double snr, uint32_t nbits) const
+{
+  if (!IsTabulated (mode))
+    {
+      return m_reference->GetChunkSuccessRate (mode, snr, nbits);
+    }
+  return Lookup (GetTable (mode), snr, nbits);
+}
+
+void
+TabulatedErrorRateModel::GetChunkSuccessRates (WifiMode mode, const double *snr, const uint32_t *nbits,
+                                               double *rates, uint32_t count) const
+{
+  if (!IsTabulated (mode))
+    {
+      for (uint32_t i = 0; i < count; i++)
+        {
+          rates[i] = m_reference->GetChunkSuccessRate (mode, snr[i], nbits[i]);
+        }
+      return;
+    }
+
+  const Table &table = GetTable (mode);
+  for (uint32_t i = 0; i < count; i++)
+    {
+      rates[i] = Lookup (table, snr[i], nbits[i]);
+    }
+}
+
+} // namespace ns3
@@ -23,6 +23,7 @@
 #include <vector>
 #include <stdint.h>
 #include "ns3/packet.h"
+#include "ns3/nstime.h"
 #include "wifi-channel.h"
 #include "wifi-mode.h"
 #include "wifi-preamble.h"
@@ -100,7 +101,7 @@ public:
   */
   int64_t AssignStreams (int64_t stream);
 
-private:
+protected:
   //YansWifiChannel& operator = (const YansWifiChannel &);
   //YansWifiChannel (const YansWifiChannel &);
 
@@ -108,6 +109,21 @@ private:
    * A vector of pointers to YansWifiPhy.
    */
   typedef std::vector<Ptr<YansWifiPhy> > PhyList;
+
+  /**
+   * Called by Send for each YansWifiPhy which has to receive the packet.  Schedules
+   * Receive on the node of the receiving YansWifiPhy after the propagation delay.
+   *
+   * \param i index of the receiving YansWifiPhy in the PHY list
+   * \param packet the packet being sent
+   * \param delay the propagation delay
+   * \param rxPowerDbm the received power of the packet
+   * \param txVector the TXVECTOR of the packet
+   * \param preamble the type of preamble being used to send the packet
+   */
+  virtual void Deliver (uint32_t i, Ptr<const Packet> packet, Time delay, double rxPowerDbm,
+                        WifiTxVector txVector, WifiPreamble preamble) const;
+
   /**
    * This method is scheduled by Send for each associated YansWifiPhy.
    * The method then calls the corresponding YansWifiPhy that the first
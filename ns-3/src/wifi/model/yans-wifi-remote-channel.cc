@@ -0,0 +1,241 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include <string.h>
+#include "yans-wifi-remote-channel.h"
+#include "yans-wifi-phy.h"
+#include "ns3/header.h"
+#include "ns3/node.h"
+#include "ns3/net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/mpi-interface.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/propagation-delay-model.h"
+
+NS_LOG_COMPONENT_DEFINE ("YansWifiRemoteChannel");
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ * \brief Parameters of YansWifiChannel::Receive carried along with the packet to
+ * another rank
+ */
+class YansWifiRemoteHeader : public Header
+{
+public:
+  static TypeId GetTypeId (void);
+  virtual TypeId GetInstanceTypeId (void) const;
+  virtual uint32_t GetSerializedSize (void) const;
+  virtual void Serialize (Buffer::Iterator start) const;
+  virtual uint32_t Deserialize (Buffer::Iterator start);
+  virtual void Print (std::ostream &os) const;
+
+  uint32_t m_phyIndex;
+  double m_rxPowerDbm;
+  WifiTxVector m_txVector;
+  WifiPreamble m_preamble;
+};
+
+NS_OBJECT_ENSURE_REGISTERED (YansWifiRemoteHeader);
+
+TypeId
+YansWifiRemoteHeader::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::YansWifiRemoteHeader")
+    .SetParent<Header> ()
+    .AddConstructor<YansWifiRemoteHeader> ()
+  ;
+  return tid;
+}
+
+TypeId
+YansWifiRemoteHeader::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+uint32_t
+YansWifiRemoteHeader::GetSerializedSize (void) const
+{
+  // the mode is identified by its name, as ranks may have registered modes in different order
+  return 4 + 8 + 1 + 1 + m_txVector.GetMode ().GetUniqueName ().size () + 6;
+}
+
+void
+YansWifiRemoteHeader::Serialize (Buffer::Iterator start) const
+{
+  uint64_t rxPower;
+  memcpy (&rxPower, &m_rxPowerDbm, sizeof (rxPower));
+  std::string mode = m_txVector.GetMode ().GetUniqueName ();
+
+  start.WriteU32 (m_phyIndex);
+  start.WriteU64 (rxPower);
+  start.WriteU8 (m_preamble);
+  start.WriteU8 (mode.size ());
+  start.Write (reinterpret_cast<const uint8_t *> (mode.c_str ()), mode.size ());
+  start.WriteU8 (m_txVector.GetTxPowerLevel ());
+  start.WriteU8 (m_txVector.GetRetries ());
+  start.WriteU8 (m_txVector.IsShortGuardInterval ());
+  start.WriteU8 (m_txVector.GetNss ());
+  start.WriteU8 (m_txVector.GetNess ());
+  start.WriteU8 (m_txVector.IsStbc ());
+}
+
+uint32_t
+YansWifiRemoteHeader::Deserialize (Buffer::Iterator start)
+{
+  Buffer::Iterator i = start;
+  m_phyIndex = i.ReadU32 ();
+  uint64_t rxPower = i.ReadU64 ();
+  memcpy (&m_rxPowerDbm, &rxPower, sizeof (rxPower));
+  m_preamble = static_cast<WifiPreamble> (i.ReadU8 ());
+  std::string mode (i.ReadU8 (), '\0');
+  i.Read (reinterpret_cast<uint8_t *> (&mode[0]), mode.size ());
+  m_txVector.SetMode (WifiMode (mode));
+  m_txVector.SetTxPowerLevel (i.ReadU8 ());
+  m_txVector.SetRetries (i.ReadU8 ());
+  m_txVector.SetShortGuardInterval (i.ReadU8 ());
+  m_txVector.SetNss (i.ReadU8 ());
+  m_txVector.SetNess (i.ReadU8 ());
+  m_txVector.SetStbc (i.ReadU8 ());
+  return i.GetDistanceFrom (start);
+}
+
+void
+YansWifiRemoteHeader::Print (std::ostream &os) const
+{
+  os << "phy=" << m_phyIndex << " rxPower=" << m_rxPowerDbm << "dBm mode=" << m_txVector.GetMode ();
+}
+
+
+NS_OBJECT_ENSURE_REGISTERED (YansWifiRemoteChannel);
+
+TypeId
+YansWifiRemoteChannel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::YansWifiRemoteChannel")
+    .SetParent<YansWifiChannel> ()
+    .AddConstructor<YansWifiRemoteChannel> ()
+    .AddAttribute ("MinimumRemoteDistance",
+                   "The smallest distance (m) between nodes owned by different ranks.",
+                   DoubleValue (0.0),
+                   MakeDoubleAccessor (&YansWifiRemoteChannel::m_minimumRemoteDistance),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("RemoteRxPowerThreshold",
+                   "Packets are not sent to PHYs on other ranks if their received power (dBm) "
+                   "is below this value.  The default keeps everything, except what "
+                   "RangePropagationLossModel considers out of range.",
+                   DoubleValue (-999.0),
+                   MakeDoubleAccessor (&YansWifiRemoteChannel::m_remoteRxPowerThreshold),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("LookAhead",
+                   "The earliest time after a transmission when its first bit can reach "
+                   "a PHY on another rank.",
+                   TypeId::ATTR_GET,
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&YansWifiRemoteChannel::GetLookAhead),
+                   MakeTimeChecker ())
+  ;
+  return tid;
+}
+
+YansWifiRemoteChannel::YansWifiRemoteChannel ()
+  : m_minimumRemoteDistance (0.0),
+    m_remoteRxPowerThreshold (-999.0),
+    m_lateDeliveries (0)
+{
+}
+
+YansWifiRemoteChannel::~YansWifiRemoteChannel ()
+{
+}
+
+Time
+YansWifiRemoteChannel::GetLookAhead (void) const
+{
+  if (m_delay == 0)
+    {
+      return Seconds (0);
+    }
+  Ptr<ConstantPositionMobilityModel> a = CreateObject<ConstantPositionMobilityModel> ();
+  Ptr<ConstantPositionMobilityModel> b = CreateObject<ConstantPositionMobilityModel> ();
+  b->SetPosition (Vector (m_minimumRemoteDistance, 0.0, 0.0));
+  return m_delay->GetDelay (a, b);
+}
+
+uint32_t
+YansWifiRemoteChannel::GetNLateDeliveries (void) const
+{
+  return m_lateDeliveries;
+}
+
+void
+YansWifiRemoteChannel::Deliver (uint32_t i, Ptr<const Packet> packet, Time delay, double rxPowerDbm,
+                                WifiTxVector txVector, WifiPreamble preamble) const
+{
+  Ptr<Object> dstNetDevice = m_phyList[i]->GetDevice ();
+  Ptr<NetDevice> device = dstNetDevice == 0 ? 0 : dstNetDevice->GetObject<NetDevice> ();
+  if (device == 0 || device->GetNode ()->GetSystemId () == MpiInterface::GetSystemId ())
+    {
+      YansWifiChannel::Deliver (i, packet, delay, rxPowerDbm, txVector, preamble);
+      return;
+    }
+  if (rxPowerDbm < m_remoteRxPowerThreshold)
+    {
+      return;
+    }
+
+  Time lookAhead = GetLookAhead ();
+  if (delay < lookAhead)
+    {
+      NS_LOG_WARN ("Node " << device->GetNode ()->GetId () << " is closer than MinimumRemoteDistance, "
+                   "reception is postponed by " << lookAhead - delay);
+      m_lateDeliveries++;
+      delay = lookAhead;
+    }
+
+  YansWifiRemoteHeader header;
+  header.m_phyIndex = i;
+  header.m_rxPowerDbm = rxPowerDbm;
+  header.m_txVector = txVector;
+  header.m_preamble = preamble;
+  Ptr<Packet> copy = packet->Copy ();
+  copy->AddHeader (header);
+
+#ifdef NS3_MPI
+  MpiInterface::SendPacket (copy, Simulator::Now () + delay, device->GetNode ()->GetId (), device->GetIfIndex ());
+#else
+  NS_FATAL_ERROR ("Can't use distributed simulator without MPI compiled in");
+#endif
+}
+
+void
+YansWifiRemoteChannel::ReceiveRemote (Ptr<Packet> packet)
+{
+  YansWifiRemoteHeader header;
+  packet->RemoveHeader (header);
+  NS_LOG_FUNCTION (this << packet << header.m_phyIndex << header.m_rxPowerDbm);
+  Receive (header.m_phyIndex, packet, header.m_rxPowerDbm, header.m_txVector, header.m_preamble);
+}
+
+} // namespace ns3
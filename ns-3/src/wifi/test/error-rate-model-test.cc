@@ -0,0 +1,123 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include <ns3/object.h>
+#include <ns3/object-factory.h>
+#include <ns3/log.h>
+#include <ns3/test.h>
+#include <cmath>
+#include <vector>
+#include "ns3/wifi-phy.h"
+#include "ns3/tabulated-error-rate-model.h"
+
+NS_LOG_COMPONENT_DEFINE ("TabulatedErrorRateModelTest");
+
+using namespace ns3;
+
+class TabulatedErrorRateModelTest : public TestCase
+{
+public:
+  TabulatedErrorRateModelTest (std::string reference);
+  virtual void DoRun (void);
+
+private:
+  std::string m_referenceName;
+  Ptr<ErrorRateModel> m_reference;
+};
+
+TabulatedErrorRateModelTest::TabulatedErrorRateModelTest (std::string reference)
+  : TestCase ("Check accuracy of TabulatedErrorRateModel against " + reference),
+    m_referenceName (reference)
+{
+}
+
+void
+TabulatedErrorRateModelTest::DoRun (void)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (m_referenceName);
+  m_reference = factory.Create<ErrorRateModel> ();
+  Ptr<TabulatedErrorRateModel> tabulated = CreateObject<TabulatedErrorRateModel> ();
+  tabulated->SetReferenceModel (m_reference);
+
+  std::vector<WifiMode> modes;
+  // 802.11p
+  modes.push_back (WifiPhy::GetOfdmRate3MbpsBW10MHz ());
+  modes.push_back (WifiPhy::GetOfdmRate4_5MbpsBW10MHz ());
+  modes.push_back (WifiPhy::GetOfdmRate6MbpsBW10MHz ());
+  modes.push_back (WifiPhy::GetOfdmRate9MbpsBW10MHz ());
+  modes.push_back (WifiPhy::GetOfdmRate12MbpsBW10MHz ());
+  modes.push_back (WifiPhy::GetOfdmRate18MbpsBW10MHz ());
+  modes.push_back (WifiPhy::GetOfdmRate24MbpsBW10MHz ());
+  modes.push_back (WifiPhy::GetOfdmRate27MbpsBW10MHz ());
+  // 802.11g
+  modes.push_back (WifiPhy::GetErpOfdmRate6Mbps ());
+  modes.push_back (WifiPhy::GetErpOfdmRate54Mbps ());
+
+  const uint32_t nbits[] = { 8, 100, 1000, 12000 };
+  for (std::vector<WifiMode>::const_iterator mode = modes.begin (); mode != modes.end (); mode++)
+    {
+      // the whole tabulated range, -30 dB to 60 dB
+      for (double snrDb = -30.0; snrDb < 60.0; snrDb += 0.0173)
+        {
+          double snr = std::pow (10.0, snrDb / 10.0);
+          for (uint32_t i = 0; i < sizeof (nbits) / sizeof (nbits[0]); i++)
+            {
+              NS_TEST_ASSERT_MSG_EQ_TOL (tabulated->GetChunkSuccessRate (*mode, snr, nbits[i]),
+                                         m_reference->GetChunkSuccessRate (*mode, snr, nbits[i]),
+                                         5e-4,
+                                         "Wrong success rate for " << *mode << " at " << snrDb
+                                         << " dB and " << nbits[i] << " bits");
+            }
+        }
+    }
+
+  // batch interface gives the same values
+  double snr[] = { 0.5, 2.0, 7.5, 20.0, 100.0 };
+  uint32_t bits[] = { 8, 100, 1000, 12000, 0 };
+  double rates[5];
+  tabulated->GetChunkSuccessRates (WifiPhy::GetOfdmRate6MbpsBW10MHz (), snr, bits, rates, 5);
+  for (uint32_t i = 0; i < 5; i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (rates[i], tabulated->GetChunkSuccessRate (WifiPhy::GetOfdmRate6MbpsBW10MHz (), snr[i], bits[i]),
+                             "Batch and single lookups differ");
+    }
+  NS_TEST_ASSERT_MSG_EQ (rates[4], 1.0, "Empty chunk should always be received");
+
+  // DSSS modes are not tabulated
+  NS_TEST_ASSERT_MSG_EQ (tabulated->GetChunkSuccessRate (WifiPhy::GetDsssRate11Mbps (), 10.0, 1000),
+                         m_reference->GetChunkSuccessRate (WifiPhy::GetDsssRate11Mbps (), 10.0, 1000),
+                         "DSSS modes should be passed to the reference model");
+}
+
+class TabulatedErrorRateModelTestSuite : public TestSuite
+{
+public:
+  TabulatedErrorRateModelTestSuite ();
+};
+
+TabulatedErrorRateModelTestSuite::TabulatedErrorRateModelTestSuite ()
+  : TestSuite ("devices-wifi-error-rate", UNIT)
+{
+  AddTestCase (new TabulatedErrorRateModelTest ("ns3::NistErrorRateModel"), TestCase::QUICK);
+  AddTestCase (new TabulatedErrorRateModelTest ("ns3::YansErrorRateModel"), TestCase::QUICK);
+}
+
+static TabulatedErrorRateModelTestSuite g_tabulatedErrorRateModelTestSuite;
@@ -0,0 +1,286 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+#include <ns3/log.h>
+#include <ns3/test.h>
+#include <ns3/simulator.h>
+#include <ns3/nist-error-rate-model.h>
+#include <ns3/wifi-phy.h>
+#include <ns3/interference-helper.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+NS_LOG_COMPONENT_DEFINE ("InterferenceHelperTest");
+
+namespace ns3 {
+
+/**
+ * Drives InterferenceHelper with a random stream of signals and receptions and compares
+ * its answers with a straightforward reimplementation of the bookkeeping, in which the
+ * power at every moment is recomputed by summing all deltas from the beginning.
+ */
+class InterferenceHelperEquivalenceTest : public TestCase
+{
+public:
+  InterferenceHelperEquivalenceTest ();
+  virtual void DoRun (void);
+
+private:
+  typedef InterferenceHelper::NiChange NiChange;
+  typedef InterferenceHelper::NiChanges NiChanges;
+
+  uint64_t Random (void);
+  double RandomPower (void);
+  Ptr<InterferenceHelper::Event> AddSignal (void);
+  void Step (void);
+  void EndRx (Ptr<InterferenceHelper::Event> event);
+
+  void ReferenceAppend (Ptr<InterferenceHelper::Event> event);
+  void ReferenceInsert (NiChange change);
+  Time ReferenceGetEnergyDuration (double energyW) const;
+  double ReferenceCalculateNoiseInterferenceW (Ptr<InterferenceHelper::Event> event, NiChanges *ni) const;
+
+  void CheckEnergyDuration (void);
+
+  InterferenceHelper m_helper;
+  WifiMode m_mode;
+  uint64_t m_state;
+  uint32_t m_steps;
+  uint32_t m_receptions;
+
+  NiChanges m_refChanges;
+  double m_refFirstPower;
+  bool m_refRxing;
+};
+
+InterferenceHelperEquivalenceTest::InterferenceHelperEquivalenceTest ()
+  : TestCase ("Check that InterferenceHelper matches the reference NiChange bookkeeping"),
+    m_state (1),
+    m_steps (0),
+    m_receptions (0),
+    m_refFirstPower (0.0),
+    m_refRxing (false)
+{
+}
+
+uint64_t
+InterferenceHelperEquivalenceTest::Random (void)
+{
+  // 64-bit LCG, good enough for mixing operations
+  m_state = m_state * 6364136223846793005ULL + 1442695040888963407ULL;
+  return m_state >> 16;
+}
+
+double
+InterferenceHelperEquivalenceTest::RandomPower (void)
+{
+  // -100 dBm .. -40 dBm
+  return std::pow (10.0, (-130.0 + (Random () % 6000) / 100.0) / 10.0);
+}
+
+Ptr<InterferenceHelper::Event>
+InterferenceHelperEquivalenceTest::AddSignal (void)
+{
+  Time duration;
+  switch (Random () % 3)
+    {
+    case 0: duration = MicroSeconds (1 + Random () % 50); break;
+    case 1: duration = MicroSeconds (1 + Random () % 1000); break;
+    default: duration = MicroSeconds (1 + Random () % 10000); break;
+    }
+  Ptr<InterferenceHelper::Event> event =
+    m_helper.Add (1000, m_mode, WIFI_PREAMBLE_LONG, duration, RandomPower (), WifiTxVector ());
+  ReferenceAppend (event);
+  return event;
+}
+
+void
+InterferenceHelperEquivalenceTest::Step (void)
+{
+  uint32_t op = Random () % 16;
+  if (op < 8)
+    {
+      AddSignal ();
+    }
+  else if (op < 11 && !m_refRxing)
+    {
+      Ptr<InterferenceHelper::Event> event = AddSignal ();
+      m_helper.NotifyRxStart ();
+      m_refRxing = true;
+      Simulator::Schedule (event->GetDuration (), &InterferenceHelperEquivalenceTest::EndRx, this, event);
+    }
+  else if (op == 11 && !m_refRxing && Random () % 50 == 0)
+    {
+      m_helper.EraseEvents ();
+      m_refChanges.clear ();
+      m_refFirstPower = 0.0;
+    }
+  CheckEnergyDuration ();
+
+  if (++m_steps < 50000)
+    {
+      Time delay;
+      switch (Random () % 4)
+        {
+        case 0: delay = Seconds (0); break;
+        case 1: delay = MicroSeconds (Random () % 10); break;
+        case 2: delay = MicroSeconds (Random () % 500); break;
+        default: delay = MicroSeconds (Random () % 20000); break;
+        }
+      Simulator::Schedule (delay, &InterferenceHelperEquivalenceTest::Step, this);
+    }
+}
+
+void
+InterferenceHelperEquivalenceTest::EndRx (Ptr<InterferenceHelper::Event> event)
+{
+  NiChanges ni;
+  NiChanges refNi;
+  double noise = m_helper.CalculateNoiseInterferenceW (event, &ni);
+  double refNoise = ReferenceCalculateNoiseInterferenceW (event, &refNi);
+  // both sums carry the rounding residue of the signals that have already ended, so
+  // allow an absolute error far below any meaningful power
+  double tolerance = 1e-9 * std::fabs (refNoise) + 1e-18;
+  NS_TEST_ASSERT_MSG_EQ_TOL (noise, refNoise, tolerance, "Noise at the start of reception differs");
+  NS_TEST_ASSERT_MSG_EQ (ni.size (), refNi.size (), "Number of NiChanges during reception differs");
+  for (uint32_t i = 1; i < std::min (ni.size (), refNi.size ()); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (ni[i].GetTime (), refNi[i].GetTime (), "NiChange time differs");
+      NS_TEST_ASSERT_MSG_EQ (ni[i].GetDelta (), refNi[i].GetDelta (), "NiChange delta differs");
+    }
+  m_helper.CalculateSnrPer (event);
+  m_helper.NotifyRxEnd ();
+  m_refRxing = false;
+  m_receptions++;
+}
+
+void
+InterferenceHelperEquivalenceTest::CheckEnergyDuration (void)
+{
+  // powers are drawn on a 0.01 dB grid, keep the thresholds off it
+  static const double thresholds[] = { 1.23e-14, 4.56e-12, 7.89e-11, 2.34e-10, 5.67e-9 };
+  for (uint32_t i = 0; i < sizeof (thresholds) / sizeof (thresholds[0]); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (m_helper.GetEnergyDuration (thresholds[i]),
+                             ReferenceGetEnergyDuration (thresholds[i]),
+                             "Energy duration differs for threshold " << thresholds[i]);
+    }
+}
+
+void
+InterferenceHelperEquivalenceTest::ReferenceAppend (Ptr<InterferenceHelper::Event> event)
+{
+  Time now = Simulator::Now ();
+  if (!m_refRxing)
+    {
+      NiChanges::iterator nowIterator =
+        std::upper_bound (m_refChanges.begin (), m_refChanges.end (), NiChange (now, 0));
+      for (NiChanges::iterator i = m_refChanges.begin (); i != nowIterator; i++)
+        {
+          m_refFirstPower += i->GetDelta ();
+        }
+      m_refChanges.erase (m_refChanges.begin (), nowIterator);
+      m_refChanges.insert (m_refChanges.begin (), NiChange (event->GetStartTime (), event->GetRxPowerW ()));
+    }
+  else
+    {
+      ReferenceInsert (NiChange (event->GetStartTime (), event->GetRxPowerW ()));
+    }
+  ReferenceInsert (NiChange (event->GetEndTime (), -event->GetRxPowerW ()));
+}
+
+void
+InterferenceHelperEquivalenceTest::ReferenceInsert (NiChange change)
+{
+  m_refChanges.insert (std::upper_bound (m_refChanges.begin (), m_refChanges.end (), change), change);
+}
+
+Time
+InterferenceHelperEquivalenceTest::ReferenceGetEnergyDuration (double energyW) const
+{
+  Time now = Simulator::Now ();
+  double noiseInterferenceW = m_refFirstPower;
+  Time end = now;
+  for (NiChanges::const_iterator i = m_refChanges.begin (); i != m_refChanges.end (); i++)
+    {
+      noiseInterferenceW += i->GetDelta ();
+      end = i->GetTime ();
+      if (end < now)
+        {
+          continue;
+        }
+      if (noiseInterferenceW < energyW)
+        {
+          break;
+        }
+    }
+  return end > now ? end - now : MicroSeconds (0);
+}
+
+double
+InterferenceHelperEquivalenceTest::ReferenceCalculateNoiseInterferenceW (Ptr<InterferenceHelper::Event> event,
+                                                                         NiChanges *ni) const
+{
+  double noiseInterference = m_refFirstPower;
+  for (NiChanges::const_iterator i = m_refChanges.begin () + 1; i != m_refChanges.end (); i++)
+    {
+      if ((event->GetEndTime () == i->GetTime ()) && event->GetRxPowerW () == -i->GetDelta ())
+        {
+          break;
+        }
+      ni->push_back (*i);
+    }
+  ni->insert (ni->begin (), NiChange (event->GetStartTime (), noiseInterference));
+  ni->push_back (NiChange (event->GetEndTime (), 0));
+  return noiseInterference;
+}
+
+void
+InterferenceHelperEquivalenceTest::DoRun (void)
+{
+  m_mode = WifiPhy::GetOfdmRate6Mbps ();
+  m_helper.SetNoiseFigure (std::pow (10.0, 0.7));
+  m_helper.SetErrorRateModel (CreateObject<NistErrorRateModel> ());
+
+  Simulator::Schedule (Seconds (0), &InterferenceHelperEquivalenceTest::Step, this);
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_GT (m_receptions, 1000, "Too few receptions to be meaningful");
+}
+
+} // namespace ns3
+
+using namespace ns3;
+
+class InterferenceHelperTestSuite : public TestSuite
+{
+public:
+  InterferenceHelperTestSuite ();
+};
+
+InterferenceHelperTestSuite::InterferenceHelperTestSuite ()
+  : TestSuite ("devices-wifi-interference-helper", UNIT)
+{
+  AddTestCase (new InterferenceHelperEquivalenceTest, TestCase::QUICK);
+}
+
+static InterferenceHelperTestSuite g_interferenceHelperTestSuite;
@@ -0,0 +1,134 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+// Startup cost of the trace connections made by the tracer helpers on large
+// topologies: every node gets a device whose trace source is connected through a
+// configuration path, either one path per node (as ndn::AppDelayTracer::InstallAll or
+// FlowMonitorHelper do), or one path with a wildcard for all nodes, with the string
+// API (Config::Connect), Config::CompiledPath and Config::ConnectAll.
+//
+// Usage: ./waf --run "bench-config --nodes=10000"
+//        ./waf --run "bench-config --nodes=100000"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+static uint32_t g_drops = 0;
+
+static void
+Drop (Ptr<const Packet> packet)
+{
+  g_drops++;
+}
+
+static void
+DropWithContext (std::string context, Ptr<const Packet> packet)
+{
+  g_drops++;
+}
+
+static std::string
+GetPath (uint32_t node)
+{
+  std::ostringstream os;
+  os << "/NodeList/" << node << "/DeviceList/0/$ns3::SimpleNetDevice/PhyRxDrop";
+  return os.str ();
+}
+
+static void
+Report (std::string name, uint32_t connections, uint64_t ms)
+{
+  std::cout << name << ": " << connections << " connections in " << ms << " ms ("
+            << (connections > 0 ? 1000.0 * ms / connections : 0) << " us/connection)" << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t nodes = 10000;
+  uint32_t perNode = 1000;
+
+  CommandLine cmd;
+  cmd.AddValue ("nodes", "Number of nodes", nodes);
+  cmd.AddValue ("perNode", "Number of nodes connected with one path each by Config::Connect and Config::CompiledPath", perNode);
+  cmd.Parse (argc, argv);
+  perNode = std::min (perNode, nodes);
+
+  SystemWallClockMs time;
+  time.Start ();
+  NodeContainer c;
+  c.Create (nodes);
+  for (NodeContainer::Iterator i = c.Begin (); i != c.End (); ++i)
+    {
+      (*i)->AddDevice (CreateObject<SimpleNetDevice> ());
+    }
+  std::cout << nodes << " nodes created in " << time.End () << " ms" << std::endl;
+
+  time.Start ();
+  for (uint32_t i = 0; i < perNode; i++)
+    {
+      Config::ConnectWithoutContext (GetPath (i), MakeCallback (&Drop));
+    }
+  Report ("Config::ConnectWithoutContext, one path per node", perNode, time.End ());
+
+  time.Start ();
+  for (uint32_t i = 0; i < perNode; i++)
+    {
+      Config::Connect (GetPath (i), MakeCallback (&DropWithContext));
+    }
+  Report ("Config::Connect, one path per node", perNode, time.End ());
+
+  time.Start ();
+  for (uint32_t i = 0; i < perNode; i++)
+    {
+      Config::CompiledPath (GetPath (i)).ConnectWithoutContext (MakeCallback (&Drop));
+    }
+  Report ("Config::CompiledPath, one path per node", perNode, time.End ());
+
+  std::vector<std::string> paths;
+  std::vector<CallbackBase> cbs;
+  for (uint32_t i = 0; i < nodes; i++)
+    {
+      paths.push_back (GetPath (i));
+      cbs.push_back (MakeCallback (&DropWithContext));
+    }
+  time.Start ();
+  Config::ConnectAll (paths, cbs);
+  Report ("Config::ConnectAll, one path per node, all nodes", nodes, time.End ());
+
+  time.Start ();
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/0/$ns3::SimpleNetDevice/PhyRxDrop", MakeCallback (&Drop));
+  Report ("Config::ConnectWithoutContext, /NodeList/*", nodes, time.End ());
+
+  Config::CompiledPath wildcard ("/NodeList/*/DeviceList/0/$ns3::SimpleNetDevice/PhyRxDrop");
+  time.Start ();
+  wildcard.Connect (MakeCallback (&DropWithContext));
+  Report ("Config::CompiledPath, /NodeList/*", nodes, time.End ());
+
+  Simulator::Destroy ();
+  return 0;
+}
@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+// Cost of Object::GetObject on a node-like object with several aggregates, as
+// done per packet by the protocols looking up each other (ndn::L3Protocol, Fib,
+// Pit, MobilityModel, ...).
+//
+// Usage: ./waf --run "bench-object --n=10000000"
+
+#include "ns3/core-module.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace ns3;
+
+class BenchBase : public Object
+{
+public:
+  static TypeId GetTypeId (void) {
+    static TypeId tid = TypeId ("ns3::BenchBase")
+      .SetParent<Object> ()
+      .HideFromDocumentation ()
+      ;
+    return tid;
+  }
+};
+
+template <int N>
+class BenchObject : public BenchBase
+{
+public:
+  static std::string GetName (void) {
+    std::ostringstream oss;
+    oss << "ns3::BenchObject<" << N << ">";
+    return oss.str ();
+  }
+  static TypeId GetTypeId (void) {
+    static TypeId tid = TypeId (GetName ().c_str ())
+      .SetParent<BenchBase> ()
+      .HideFromDocumentation ()
+      ;
+    return tid;
+  }
+};
+
+class BenchMissing : public Object
+{
+public:
+  static TypeId GetTypeId (void) {
+    static TypeId tid = TypeId ("ns3::BenchMissing")
+      .SetParent<Object> ()
+      .HideFromDocumentation ()
+      ;
+    return tid;
+  }
+};
+
+static uint32_t g_found = 0;
+
+template <typename T>
+static void
+Lookup (Ptr<Object> object, uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++)
+    {
+      if (object->GetObject<T> () != 0)
+        {
+          g_found++;
+        }
+    }
+}
+
+// the lookups of a packet crossing a node: several protocols looked up in turn
+static void
+LookupMix (Ptr<Object> object, uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i += 4)
+    {
+      g_found += object->GetObject<BenchObject<1> > () != 0;
+      g_found += object->GetObject<BenchObject<3> > () != 0;
+      g_found += object->GetObject<BenchObject<5> > () != 0;
+      g_found += object->GetObject<BenchObject<7> > () != 0;
+    }
+}
+
+static void
+Run (void (*lookup) (Ptr<Object>, uint32_t), Ptr<Object> object, uint32_t n, std::string name)
+{
+  SystemWallClockMs time;
+  time.Start ();
+  (*lookup) (object, n);
+  uint64_t ms = time.End ();
+  std::cout << name << ": " << (ms * 1e6 / n) << " ns/lookup" << std::endl;
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t n = 10000000;
+
+  CommandLine cmd;
+  cmd.AddValue ("n", "Number of lookups of each kind", n);
+  cmd.Parse (argc, argv);
+
+  // the "node" and seven aggregates
+  Ptr<Object> node = CreateObject<BenchObject<0> > ();
+  node->AggregateObject (CreateObject<BenchObject<1> > ());
+  node->AggregateObject (CreateObject<BenchObject<2> > ());
+  node->AggregateObject (CreateObject<BenchObject<3> > ());
+  node->AggregateObject (CreateObject<BenchObject<4> > ());
+  node->AggregateObject (CreateObject<BenchObject<5> > ());
+  node->AggregateObject (CreateObject<BenchObject<6> > ());
+  node->AggregateObject (CreateObject<BenchObject<7> > ());
+
+  std::cout << "Running bench-object with n=" << n << std::endl;
+  Run (&Lookup<BenchObject<0> >, node, n, "GetObject of the object itself");
+  Run (&Lookup<BenchObject<1> >, node, n, "GetObject of aggregate 1 of 7");
+  Run (&Lookup<BenchObject<7> >, node, n, "GetObject of aggregate 7 of 7");
+  Run (&Lookup<BenchBase>, node, n, "GetObject of a base class");
+  Run (&LookupMix, node, n, "GetObject of aggregates 1, 3, 5 and 7 in turn");
+  Run (&Lookup<BenchMissing>, node, n / 10, "GetObject of a missing type");
+
+  node->Dispose ();
+  std::cout << g_found << " objects found" << std::endl;
+  return 0;
+}
@@ -20,6 +20,8 @@
 #include "ns3/system-wall-clock-ms.h"
 #include "ns3/packet.h"
 #include "ns3/packet-metadata.h"
+#include "ns3/packet-memory-pool.h"
+#include "ns3/typed-packet-tag.h"
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -181,6 +183,73 @@ benchD (uint32_t n)
 }
 
 
+template <int N>
+class BenchTypedTag : public TypedPacketTag<BenchTypedTag<N> >
+{
+public:
+  static const char *GetTypedTagName (void) {
+    return "anon::BenchTypedTag";
+  }
+  void Print (std::ostream &os) const {
+    os << "N=" << N;
+  }
+  BenchTypedTag () {
+    memset (m_data, N, N);
+  }
+  uint8_t m_data[N];
+};
+
+// three tags added at the source, then peeked by four hops, which forward a copy
+// of the packet with one of the tags updated (as ndn::FwHopCountTag)
+static void
+benchTagList (uint32_t n)
+{
+  BenchTag<4> tag1;
+  BenchTag<8> tag2;
+  BenchTag<12> tag3;
+
+  for (uint32_t i = 0; i < n; i++) {
+    Ptr<Packet> p = Create<Packet> (1000);
+    p->AddPacketTag (tag1);
+    p->AddPacketTag (tag2);
+    p->AddPacketTag (tag3);
+    for (uint32_t hop = 0; hop < 4; hop++) {
+      Ptr<Packet> o = p->Copy ();
+      o->PeekPacketTag (tag2);
+      o->PeekPacketTag (tag3);
+      if (o->RemovePacketTag (tag1))
+        {
+          o->AddPacketTag (tag1);
+        }
+      p = o;
+    }
+  }
+}
+
+static void
+benchTypedTags (uint32_t n)
+{
+  BenchTypedTag<4> tag1;
+  BenchTypedTag<8> tag2;
+  BenchTypedTag<12> tag3;
+
+  for (uint32_t i = 0; i < n; i++) {
+    Ptr<Packet> p = Create<Packet> (1000);
+    p->AddTypedTag (tag1);
+    p->AddTypedTag (tag2);
+    p->AddTypedTag (tag3);
+    for (uint32_t hop = 0; hop < 4; hop++) {
+      Ptr<Packet> o = p->Copy ();
+      o->PeekTypedTag (tag2);
+      o->PeekTypedTag (tag3);
+      if (o->PeekTypedTag (tag1))
+        {
+          o->AddTypedTag (tag1);
+        }
+      p = o;
+    }
+  }
+}
 
 static void 
 benchA (uint32_t n)
@@ -243,8 +312,17 @@ benchC (uint32_t n)
 
 
 static void
-runBench (void (*bench) (uint32_t), uint32_t n, char const *name)
+runBench (void (*bench) (uint32_t), uint32_t n, char const *name, bool pool)
 {
+  if (pool)
+    {
+      PacketMemoryPool::Enable ();
+    }
+  else
+    {
+      PacketMemoryPool::Disable ();
+    }
+  PacketMemoryPool::ResetStats ();
   SystemWallClockMs time;
   time.Start ();
   (*bench) (n);
@@ -252,12 +330,29 @@ runBench (void (*bench) (uint32_t), uint32_t n, char const *name)
   double ps = n;
   ps *= 1000;
   ps /= deltaMs;
+  uint64_t allocations = 0;
+  uint64_t reused = 0;
+  for (uint32_t i = 0; i < PacketMemoryPool::N_KINDS; i++)
+    {
+      PacketMemoryPool::Stats stats = PacketMemoryPool::GetStats (static_cast<PacketMemoryPool::Kind> (i));
+      allocations += stats.allocations;
+      reused += stats.reused;
+    }
   std::cout << ps << " packets/s"
-            << " (" << deltaMs << " ms elapsed)\t"
-            << name
+            << " (" << deltaMs << " ms elapsed, "
+            << static_cast<double> (allocations) / n << " allocations/packet, "
+            << static_cast<double> (allocations - reused) / n << " from the heap)\t"
+            << name << (pool ? " [pool]" : " [heap]")
             << std::endl;
 }
 
+static void
+runBench (void (*bench) (uint32_t), uint32_t n, char const *name)
+{
+  runBench (bench, n, name, true);
+  runBench (bench, n, name, false);
+}
+
 int main (int argc, char *argv[])
 {
   uint32_t n = 0;
@@ -283,12 +378,18 @@ int main (int argc, char *argv[])
       exit (1);
     }
   std::cout << "Running bench-packets with n=" << n << std::endl;
-  std::cout << "All tests begin by adding UDP and IPv4 headers." << std::endl;
+  std::cout << "All header tests begin by adding UDP and IPv4 headers." << std::endl;
 
   runBench (&benchA, n, "Copy packet, remove headers");
   runBench (&benchB, n, "Just add headers");
   runBench (&benchC, n, "Remove by func call");
   runBench (&benchD, n, "Intermixed add/remove headers and tags");
+  runBench (&benchTagList, n, "Add/peek/copy tags over 4 hops (PacketTagList)");
+  runBench (&benchTypedTags, n, "Add/peek/copy tags over 4 hops (typed tags)");
+
+#ifndef PACKET_MEMORY_POOL
+  std::cout << "ns-3 is built without PacketMemoryPool: the [pool] and [heap] runs are identical" << std::endl;
+#endif
 
   return 0;
 }
@@ -0,0 +1,258 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013 University of California, Los Angeles
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Alexander Afanasyev <alexander.afanasyev@ucla.edu>
+ */
+
+// Replay of the event trace of a real simulation, recorded with
+//
+//   ./waf --run "ndn-grid --SimulatorImplementationType=ns3::EventTraceSimulatorImpl
+//                         --ns3::EventTraceSimulatorImpl::FileName=events.trace"
+//
+// against several Scheduler implementations, without the models: each scheduled
+// event is inserted in the scheduler, each removed event is removed from it, and
+// the events are popped from it until the next invoked one, the events popped
+// in between being the cancelled ones.  The tool prints the time taken by each
+// scheduler, and the histograms of the event horizon (time between the
+// scheduling and the expiration of the events) and of the number of events in
+// the scheduler.
+//
+// Usage: ./waf --run "replay-event-trace --trace=events.trace
+//                     --schedulers=ns3::MapScheduler,ns3::HeapScheduler"
+
+#include "ns3/core-module.h"
+#include "ns3/event-trace-simulator-impl.h"
+
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+class Log2Histogram
+{
+public:
+  Log2Histogram ()
+    : m_counts (65, 0)
+    , m_total (0)
+  {
+  }
+
+  void Add (uint64_t value)
+  {
+    uint32_t bin = 0;
+    while (value != 0)
+      {
+        bin++;
+        value >>= 1;
+      }
+    m_counts[bin]++;
+    m_total++;
+  }
+
+  void Print (std::ostream &os, std::string unit) const
+  {
+    for (uint32_t bin = 0; bin < m_counts.size (); bin++)
+      {
+        if (m_counts[bin] == 0)
+          {
+            continue;
+          }
+        std::ostringstream range;
+        if (bin == 0)
+          {
+            range << "0";
+          }
+        else
+          {
+            range << "[2^" << bin - 1 << ", 2^" << bin << ")";
+          }
+        os << "  " << std::setw (18) << std::left << range.str () << std::right
+           << std::setw (12) << m_counts[bin]
+           << std::setw (8) << std::fixed << std::setprecision (2)
+           << 100.0 * m_counts[bin] / m_total << "% " << unit << std::endl;
+      }
+  }
+
+private:
+  std::vector<uint64_t> m_counts;
+  uint64_t m_total;
+};
+
+// Drive the scheduler with the events of the trace, returns false if the trace
+// does not match the scheduler
+static bool
+Replay (const std::vector<EventTraceRecord> &records, Ptr<Scheduler> scheduler,
+        Log2Histogram *horizon, Log2Histogram *depth)
+{
+  uint64_t now = 0;
+  uint64_t size = 0;
+  Scheduler::Event event;
+  event.impl = 0;
+  for (std::vector<EventTraceRecord>::const_iterator i = records.begin (); i != records.end (); i++)
+    {
+      switch (i->type)
+        {
+        case EventTraceRecord::SCHEDULE:
+          event.key.m_ts = i->ts;
+          event.key.m_uid = i->uid;
+          event.key.m_context = i->context;
+          scheduler->Insert (event);
+          size++;
+          if (horizon != 0)
+            {
+              horizon->Add (i->ts - now);
+            }
+          break;
+        case EventTraceRecord::REMOVE:
+          event.key.m_ts = i->ts;
+          event.key.m_uid = i->uid;
+          event.key.m_context = i->context;
+          scheduler->Remove (event);
+          size--;
+          break;
+        case EventTraceRecord::INVOKE:
+          if (depth != 0)
+            {
+              depth->Add (size);
+            }
+          do
+            {
+              if (scheduler->IsEmpty ())
+                {
+                  return false;
+                }
+              event = scheduler->RemoveNext ();
+              size--;
+            }
+          while (event.key.m_uid != i->uid);
+          now = i->ts;
+          break;
+        default:
+          // the cancelled events are popped with the others
+          break;
+        }
+    }
+  return true;
+}
+
+static std::string
+GetUnitName (Time::Unit unit)
+{
+  const char *names[] = { "y", "d", "h", "min", "s", "ms", "us", "ns", "ps", "fs" };
+  return unit < Time::LAST ? names[unit] : "?";
+}
+
+int
+main (int argc, char *argv[])
+{
+  std::string trace = "events.trace";
+  std::string schedulers = "ns3::MapScheduler,ns3::HeapScheduler,ns3::CalendarScheduler,ns3::HierarchicalWheelScheduler";
+  uint32_t top = 10;
+
+  CommandLine cmd;
+  cmd.AddValue ("trace", "Event trace written by ns3::EventTraceSimulatorImpl", trace);
+  cmd.AddValue ("schedulers", "Comma-separated list of the Scheduler types to replay the trace with", schedulers);
+  cmd.AddValue ("top", "Number of classes of events to list", top);
+  cmd.Parse (argc, argv);
+
+  EventTraceReader reader;
+  if (!reader.Open (trace))
+    {
+      std::cerr << "Cannot read the event trace " << trace << std::endl;
+      return 1;
+    }
+
+  // the events of the destroy list are never in the scheduler
+  std::vector<EventTraceRecord> records;
+  records.reserve (reader.GetRecordCount ());
+  std::vector<uint64_t> types (4, 0);
+  std::vector<uint64_t> callbacks (reader.GetCallbackCount (), 0);
+  EventTraceRecord record;
+  while (reader.Read (record))
+    {
+      if ((record.type & EventTraceRecord::DESTROY) != 0)
+        {
+          continue;
+        }
+      records.push_back (record);
+      types[record.type & 3]++;
+      if (record.type == EventTraceRecord::SCHEDULE)
+        {
+          callbacks[record.callback]++;
+        }
+    }
+
+  std::string unit = GetUnitName (reader.GetResolution ());
+  std::cout << trace << ": " << reader.GetRecordCount () << " entries, "
+            << types[EventTraceRecord::SCHEDULE] << " events scheduled, "
+            << types[EventTraceRecord::INVOKE] << " invoked, "
+            << types[EventTraceRecord::CANCEL] << " cancelled, "
+            << types[EventTraceRecord::REMOVE] << " removed" << std::endl;
+
+  std::multimap<uint64_t, std::string, std::greater<uint64_t> > byCount;
+  for (uint32_t i = 0; i < callbacks.size (); i++)
+    {
+      byCount.insert (std::make_pair (callbacks[i], reader.GetCallbackName (i)));
+    }
+  std::cout << "Most scheduled classes of events:" << std::endl;
+  uint32_t listed = 0;
+  for (std::multimap<uint64_t, std::string>::const_iterator i = byCount.begin ();
+       i != byCount.end () && listed < top; i++, listed++)
+    {
+      std::cout << "  " << std::setw (12) << i->first << "  " << i->second << std::endl;
+    }
+
+  // histograms, from a replay which is not timed
+  Log2Histogram horizon;
+  Log2Histogram depth;
+  ObjectFactory factory;
+  factory.SetTypeId ("ns3::MapScheduler");
+  if (!Replay (records, factory.Create<Scheduler> (), &horizon, &depth))
+    {
+      std::cerr << "The trace is not consistent" << std::endl;
+      return 1;
+    }
+  std::cout << "Event horizon (time steps of 1 " << unit << "):" << std::endl;
+  horizon.Print (std::cout, "");
+  std::cout << "Events in the scheduler, when an event is invoked:" << std::endl;
+  depth.Print (std::cout, "");
+
+  std::istringstream list (schedulers);
+  std::string type;
+  while (std::getline (list, type, ','))
+    {
+      factory.SetTypeId (type);
+      Ptr<Scheduler> scheduler = factory.Create<Scheduler> ();
+      SystemWallClockMs time;
+      time.Start ();
+      bool ok = Replay (records, scheduler, 0, 0);
+      uint64_t ms = time.End ();
+      if (!ok)
+        {
+          std::cout << type << ": the trace does not match the scheduler" << std::endl;
+          continue;
+        }
+      std::cout << type << ": " << ms << " ms, "
+                << (ms == 0 ? 0 : records.size () / ms) << " entries/ms" << std::endl;
+    }
+
+  return 0;
+}